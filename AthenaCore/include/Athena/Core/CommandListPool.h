@@ -0,0 +1,87 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief プールが管理するコマンドアロケータとコマンドリストの組
+     */
+    struct PooledCommandList {
+        ComPtr<ID3D12CommandAllocator> allocator;
+        ComPtr<ID3D12GraphicsCommandList> commandList;
+        uint64_t fenceValue = 0;                   // 最後に送信したときのフェンス値（0 = 送信なし）
+    };
+
+    /**
+     * @brief コマンドアロケータ・コマンドリストのプール（キューの種類ごとに1つ）
+     *
+     * コマンドアロケータはGPUが実行を終えるまでリセットできないため、
+     * 送信時のフェンス値とともに返却し、完了したものから再利用する。
+     * 空きがない場合のみ新しい組を作成する（CreateCommandList の負荷を毎回払わない）。
+     *
+     * Acquire / Release はスレッドセーフで、ワーカースレッドから並行して記録できる。
+     * フェンス値は同じキュー（同じフェンス）のものを使うこと。
+     *
+     * 使い方:
+     *   PooledCommandList& list = pool.Acquire(queue.GetCompletedValue());
+     *   ... list.commandList に記録 ...
+     *   list.commandList->Close();
+     *   queue.ExecuteCommandLists(...);
+     *   pool.Release(list, queue.Signal());
+     */
+    class CommandListPool {
+    public:
+        CommandListPool() = default;
+        ~CommandListPool() = default;
+
+        CommandListPool(const CommandListPool&) = delete;
+        CommandListPool& operator=(const CommandListPool&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param type コマンドリストのタイプ（送信先キューと同じ）
+         */
+        void Initialize(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type);
+
+        /**
+         * @brief 終了処理（全ての送信済みリストの完了後に呼び出すこと）
+         */
+        void Shutdown();
+
+        /**
+         * @brief 記録可能な状態（リセット済み）のコマンドリストを取得
+         * @param completedFenceValue GPUが完了したフェンス値
+         * @param initialState 初期パイプラインステート（nullptr 可）
+         */
+        PooledCommandList& Acquire(uint64_t completedFenceValue, ID3D12PipelineState* initialState = nullptr);
+
+        /**
+         * @brief コマンドリストを返却（Close() 済みであること）
+         * @param fenceValue 送信後にシグナルしたフェンス値（送信しなかった場合は 0）
+         */
+        void Release(PooledCommandList& list, uint64_t fenceValue);
+
+        D3D12_COMMAND_LIST_TYPE GetType() const { return type; }
+        uint32_t GetCreatedCount() const;
+        uint32_t GetPendingCount() const;
+
+    private:
+        ComPtr<ID3D12Device> device;
+        D3D12_COMMAND_LIST_TYPE type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+        mutable std::mutex mutex;
+        std::deque<PooledCommandList> lists;       // 全ての組（deque のため参照は無効にならない）
+        std::vector<PooledCommandList*> available; // すぐに再利用できるもの
+        std::vector<PooledCommandList*> pending;   // GPUの完了待ち
+    };
+
+} // namespace Athena
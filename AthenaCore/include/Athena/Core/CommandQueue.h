@@ -62,8 +62,23 @@ namespace Athena {
          * @brief tFXɃVOi𑗂
          *
          * GPŨ݂R}hƂɒʒm悤ݒB
+         *
+         * @return VOitFXl
+         */
+        uint64_t Signal();
+
+        /**
+         * @brief w肵tFXlGPUB܂őҋ@
+         *
+         * WaitForGPU() ƈقȂVȃVOi͑ȂB
+         * 㑱̃t[̂܂܁AÂt[̊҂ꍇɎgpB
+         */
+        void WaitForFenceValue(uint64_t value);
+
+        /**
+         * @brief w肵tFXl܂ŊĂ邩
          */
-        void Signal();
+        bool IsFenceComplete(uint64_t value) const { return GetCompletedValue() >= value; }
 
         /**
          * @brief GPUtFXl擾
@@ -72,6 +87,13 @@ namespace Athena {
          */
         uint64_t GetCompletedValue() const;
 
+        /**
+         * @brief ŌɃVOi𑗂tFXl擾
+         *
+         * ̒l GetCompletedValue() ȉɂȂ΁A܂łɑMR}h͊ĂB
+         */
+        uint64_t GetLastSignaledValue() const { return fenceValue; }
+
         /**
          * @brief D3D12R}hL[ւ̃ANZX
          *
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief フェンスで管理するリソースの遅延解放キュー
+     *
+     * Release() に渡したオブジェクトは現在のバッチに入り、FinishBatch() でそのフレームの
+     * フェンス値に紐付けられる。ReleaseCompleted() にGPUが完了したフェンス値を渡すと、
+     * それ以前のバッチのオブジェクトが破棄される。
+     *
+     * グローバルに登録したキューがあれば、Buffer / Texture の解放や RenderGraph のプールは
+     * DeferRelease() を通じてこのキューに回される（未登録の場合は即時に破棄する）。
+     * スレッドセーフ。
+     */
+    class DeferredReleaseQueue {
+    public:
+        DeferredReleaseQueue() = default;
+        ~DeferredReleaseQueue() { Flush(); }
+
+        DeferredReleaseQueue(const DeferredReleaseQueue&) = delete;
+        DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+        /**
+         * @brief オブジェクトを現在のバッチに追加（所有権を移す）
+         */
+        template<typename T>
+        void Release(T&& object) {
+            Push(std::make_shared<std::decay_t<T>>(std::forward<T>(object)));
+        }
+
+        /**
+         * @brief 前回の FinishBatch() 以降に追加したオブジェクトをフェンス値に紐付ける
+         */
+        void FinishBatch(uint64_t fenceValue);
+
+        /**
+         * @brief 完了したバッチのオブジェクトを破棄
+         * @param completedFenceValue GPUが完了したフェンス値
+         */
+        void ReleaseCompleted(uint64_t completedFenceValue);
+
+        /**
+         * @brief 全てのオブジェクトを破棄（GPUの完了は呼び出し側で保証すること）
+         */
+        void Flush();
+
+        size_t GetPendingCount() const;
+
+        /**
+         * @brief Buffer / Texture などが使用するキューを登録（nullptr で解除）
+         */
+        static void SetGlobal(DeferredReleaseQueue* queue) { globalQueue.store(queue, std::memory_order_release); }
+        static DeferredReleaseQueue* GetGlobal() { return globalQueue.load(std::memory_order_acquire); }
+
+        /**
+         * @brief グローバルのキューに解放を依頼（未登録の場合は即時に破棄）
+         */
+        template<typename T>
+        static void DeferRelease(T&& object) {
+            if (DeferredReleaseQueue* queue = GetGlobal()) {
+                queue->Release(std::forward<T>(object));
+            } else {
+                std::decay_t<T> discarded(std::forward<T>(object));
+            }
+        }
+
+    private:
+        struct Batch {
+            uint64_t fenceValue;
+            std::vector<std::shared_ptr<void>> objects;
+        };
+
+        void Push(std::shared_ptr<void> object);
+
+        mutable std::mutex mutex;
+        std::vector<std::shared_ptr<void>> currentObjects;   // 未確定バッチ
+        std::deque<Batch> batches;                           // GPU使用中のバッチ（フェンス順）
+
+        static inline std::atomic<DeferredReleaseQueue*> globalQueue{ nullptr };
+    };
+
+} // namespace Athena
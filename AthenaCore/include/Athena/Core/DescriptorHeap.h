@@ -1,9 +1,9 @@
 #pragma once
 
+#include "DescriptorIndexAllocator.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <cstdint>
-#include <vector>
 
 namespace Athena {
 
@@ -49,14 +49,18 @@ namespace Athena {
          * @param capacity q[v̗eʁifXNv^j
          * @param shaderVisible VF[_[QƉ\ɂ邩
          *
+         * @param threadSafe Xbh犄蓖āE邩ibNt[łgpj
+         *
          * shader Visibletrueɂł̂́ACBV_SRV_UAVSampler̂݁B
          * RTVDSV͏ɃVF[_[słB
+         * threadSafe ̏ꍇAA͈͂̊蓖Ă ConcurrentDescriptorIndexAllocator::MaxRangeCount ܂ŁB
          */
         void Initialize(
             ID3D12Device* device,
             D3D12_DESCRIPTOR_HEAP_TYPE type,
             uint32_t capacity,
-            bool shaderVisible = false
+            bool shaderVisible = false,
+            bool threadSafe = false
         );
 
         /**
@@ -73,6 +77,16 @@ namespace Athena {
          */
         DescriptorHandle Allocate();
 
+        /**
+         * @brief AfXNv^蓖āifXNv^e[upj
+         *
+         * @param count fXNv^
+         * @return 擪̃fXNv^nhii Ԗڂ GetHandle(handle.index + i)j
+         *
+         * A󂫂Ȃꍇ͗OX[B
+         */
+        DescriptorHandle AllocateRange(uint32_t count);
+
         /**
          * @brief fXNv^
          *
@@ -82,6 +96,19 @@ namespace Athena {
          */
         void Free(const DescriptorHandle& handle);
 
+        /**
+         * @brief AfXNv^
+         *
+         * @param first AllocateRange() œ擪nh
+         * @param count fXNv^
+         */
+        void FreeRange(const DescriptorHandle& first, uint32_t count);
+
+        /**
+         * @brief CfbNXnhvZ
+         */
+        DescriptorHandle GetHandle(uint32_t index) const;
+
         /**
          * @brief D3D12fXNv^q[vւ̃ANZX
          */
@@ -96,6 +123,9 @@ namespace Athena {
          */
         uint32_t GetDescriptorSize() const { return descriptorSize; }
 
+        uint32_t GetCapacity() const { return capacity; }
+        uint32_t GetFreeCount() const;
+
     private:
         ComPtr<ID3D12DescriptorHeap> heap;      // q[v{
         D3D12_DESCRIPTOR_HEAP_TYPE type;        // q[ṽ^Cv
@@ -106,8 +136,9 @@ namespace Athena {
         D3D12_CPU_DESCRIPTOR_HANDLE cpuStart = {};  // CPŮJnnh
         D3D12_GPU_DESCRIPTOR_HANDLE gpuStart = {};  // GPŮJnnh
 
-        std::vector<bool> allocated;            // 蓖ď
-        uint32_t nextFreeIndex = 0;             // ̃t[ȃCfbNX
+        bool threadSafe = false;                // bNt[łgp邩
+        DescriptorIndexAllocator indexAllocator;                 // 蓖ď󋵁iPXbhj
+        ConcurrentDescriptorIndexAllocator concurrentAllocator;  // 蓖ď󋵁iXbhZ[tj
     };
 
 } // namespace Athena
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief デスクリプタヒープ内のインデックス割り当て（階層ビットマップ）
+     *
+     * DescriptorHeap が内部で使い、ハンドルの計算はヒープ側で行う。
+     * 64個単位の空きビット（1 = 空き）と、空きのあるワードを示す上位ビットマップの2段構成で、
+     * count-trailing-zeros により空きを探す。検索開始位置のヒントを保持するため、
+     * 単一の割り当ては償却 O(1)。
+     *
+     * デスクリプタテーブル用の連続範囲の割り当てにも対応する。スレッドセーフではない。
+     */
+    class DescriptorIndexAllocator {
+    public:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        DescriptorIndexAllocator() = default;
+        explicit DescriptorIndexAllocator(uint32_t capacity) { Reset(capacity); }
+
+        /**
+         * @brief 容量を設定し、全て空きにする
+         */
+        void Reset(uint32_t capacity);
+
+        /**
+         * @brief 1つ割り当て
+         * @return インデックス（空きがない場合は InvalidIndex）
+         */
+        uint32_t Allocate();
+
+        /**
+         * @brief 連続した範囲を割り当て（先頭に近い最初の空き範囲）
+         * @return 先頭インデックス（収まる範囲がない場合は InvalidIndex）
+         */
+        uint32_t AllocateRange(uint32_t count);
+
+        /**
+         * @brief 範囲を解放（割り当てられていないインデックスは無視）
+         */
+        void Free(uint32_t index, uint32_t count = 1);
+
+        bool IsAllocated(uint32_t index) const;
+        uint32_t GetCapacity() const { return capacity; }
+        uint32_t GetFreeCount() const { return freeCount; }
+
+    private:
+        uint32_t FindNextFree(uint32_t start) const;
+        uint32_t FindNextUsed(uint32_t start) const;
+        void MarkAllocated(uint32_t start, uint32_t count);
+
+        std::vector<uint64_t> freeBits;            // ワードごとの空きビット
+        std::vector<uint64_t> summaryBits;         // 空きのあるワード
+        uint32_t summaryHint = 0;                  // これより前の summaryBits は全て0
+        uint32_t capacity = 0;
+        uint32_t freeCount = 0;
+    };
+
+    /**
+     * @brief スレッドセーフなデスクリプタインデックス割り当て（ロックフリー）
+     *
+     * 空きビットのワードを atomic の compare-exchange で書き換えるため、
+     * ローダースレッドからヒープ全体のロックなしで割り当て・解放できる。
+     * 検索開始ワードのヒントを共有し、使い切ったワードは読み飛ばす。
+     * 連続範囲は1ワード（64個）以内に限る。
+     */
+    class ConcurrentDescriptorIndexAllocator {
+    public:
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+        static constexpr uint32_t MaxRangeCount = 64;
+
+        ConcurrentDescriptorIndexAllocator() = default;
+        explicit ConcurrentDescriptorIndexAllocator(uint32_t capacity) { Reset(capacity); }
+
+        /**
+         * @brief 容量を設定し、全て空きにする（他スレッドが使用していないときに呼び出すこと）
+         */
+        void Reset(uint32_t capacity);
+
+        uint32_t Allocate();
+
+        /**
+         * @brief 連続した範囲を割り当て（count は MaxRangeCount 以下）
+         */
+        uint32_t AllocateRange(uint32_t count);
+
+        void Free(uint32_t index, uint32_t count = 1);
+
+        uint32_t GetCapacity() const { return capacity; }
+        uint32_t GetFreeCount() const { return freeCount.load(std::memory_order_relaxed); }
+
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> freeBits;
+        uint32_t wordCount = 0;
+        uint32_t capacity = 0;
+        std::atomic<uint32_t> nextWord{ 0 };      // 検索開始ワードのヒント
+        std::atomic<uint32_t> freeCount{ 0 };
+    };
+
+} // namespace Athena
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "SwapChain.h"
+#include "DeferredReleaseQueue.h"
+#include "CommandListPool.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    class CommandQueue;
+
+    /**
+     * @brief 処理中の1フレーム分の状態
+     *
+     * コマンドアロケータと、そのフレームを送信したときのフェンス値を持つ。
+     * GPUが使用中の可能性があるリソースの解放は、リングの DeferredReleaseQueue が
+     * フレームのフェンス値で管理する。
+     */
+    struct FrameContext {
+        uint32_t index = 0;                                  // リング内のスロット番号
+        ComPtr<ID3D12CommandAllocator> commandAllocator;
+        uint64_t fenceValue = 0;                             // 最後に送信したフレームのフェンス値（0 = 未使用）
+    };
+
+    /**
+     * @brief フレームコンテキストのリング（フレームの並行処理）
+     *
+     * 毎フレームGPUの完了を待つ代わりに、スロットをフレーム数分用意して順に使う。
+     * CPUが待機するのは、再利用するスロットの前回のフレームがまだGPUで処理中の場合のみ。
+     * 遅延解放キューもフレームのフェンス値で進めるため、GPUを待たずにリソースを作り直せる。
+     * パスやワーカースレッドが追加で使うコマンドリストは GetCommandListPool() から取得する。
+     *
+     * 使い方:
+     *   FrameContext& frame = ring.BeginFrame();
+     *   commandList->Reset(frame.commandAllocator.Get(), nullptr);
+     *   ... 記録・送信・Present ...
+     *   ring.EndFrame();
+     */
+    class FrameContextRing {
+    public:
+        FrameContextRing() = default;
+        ~FrameContextRing() = default;
+
+        FrameContextRing(const FrameContextRing&) = delete;
+        FrameContextRing& operator=(const FrameContextRing&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param queue フレームを送信するコマンドキュー
+         * @param frameCount 同時に処理するフレーム数
+         */
+        void Initialize(ID3D12Device* device, CommandQueue* queue, uint32_t frameCount = SwapChain::BufferCount);
+
+        /**
+         * @brief 終了処理（全フレームの完了を待ってから解放）
+         */
+        void Shutdown();
+
+        /**
+         * @brief 次のスロットでフレームを開始
+         *
+         * スロットの前回のフレームが完了するまで待機し、
+         * コマンドアロケータのリセットと、完了したフレームの遅延解放を行う。
+         */
+        FrameContext& BeginFrame();
+
+        /**
+         * @brief フレームを終了（コマンドリスト送信後に呼び出す）
+         * @return このフレームのフェンス値
+         */
+        uint64_t EndFrame();
+
+        /**
+         * @brief 全フレームの完了を待ち、遅延解放を全て実行
+         */
+        void WaitForIdle();
+
+        FrameContext& GetCurrentFrame() { return frames[currentFrame]; }
+        DeferredReleaseQueue& GetReleaseQueue() { return releaseQueue; }
+        CommandListPool& GetCommandListPool() { return commandListPool; }
+        uint32_t GetFrameCount() const { return static_cast<uint32_t>(frames.size()); }
+
+        /**
+         * @brief スロットの再利用でCPUが待機した回数
+         */
+        uint64_t GetStallCount() const { return stallCount; }
+
+    private:
+        CommandQueue* queue = nullptr;
+        std::vector<FrameContext> frames;
+        DeferredReleaseQueue releaseQueue;
+        CommandListPool commandListPool;           // 同じキューに送信する追加のコマンドリスト
+        uint32_t currentFrame = 0;
+        uint64_t stallCount = 0;
+    };
+
+} // namespace Athena
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief GPUタイムスタンプによる区間計測クラス
+     *
+     * タイムスタンプクエリを使ってパス単位のGPU実行時間を計測する。
+     * 結果は frameLatency フレーム後に読み戻されるため、CPUはGPUを待機しない。
+     *
+     * 使用例：
+     *   timer.BeginFrame();
+     *   uint32_t scope = timer.BeginScope(cmdList, "Geometry");
+     *   ...描画...
+     *   timer.EndScope(cmdList, scope);
+     *   timer.EndFrame(cmdList);   // Close() 前に呼び出す
+     *
+     * 同じスロットを再利用する BeginFrame() の時点で、frameLatency フレーム前の
+     * コマンドリストはGPUで完了している必要がある。
+     */
+    class GpuTimer {
+    public:
+        static constexpr uint32_t InvalidScope = 0xFFFFFFFF;
+
+        GpuTimer() = default;
+        ~GpuTimer() = default;
+
+        /**
+         * @brief タイマーを初期化
+         *
+         * @param device D3D12デバイス
+         * @param commandQueue 計測対象のコマンドキュー（タイムスタンプ周波数の取得用）
+         * @param maxScopesPerFrame 1フレームあたりの最大計測区間数
+         * @param frameLatency 読み戻しまでのフレーム数
+         */
+        void Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue,
+                        uint32_t maxScopesPerFrame = 32, uint32_t frameLatency = 3);
+
+        /**
+         * @brief タイマーをシャットダウン
+         */
+        void Shutdown();
+
+        /**
+         * @brief フレームの計測を開始
+         *
+         * 再利用するスロットに残っている計測結果を読み戻す。
+         * 以前の結果は破棄されるため、そのフレームで計測しなかった区間は結果なしになる。
+         */
+        void BeginFrame();
+
+        /**
+         * @brief 計測区間を開始
+         * @return 区間ID（区間数の上限を超えた場合は InvalidScope）
+         */
+        uint32_t BeginScope(ID3D12GraphicsCommandList* commandList, const std::string& name);
+
+        /**
+         * @brief 計測区間を終了
+         */
+        void EndScope(ID3D12GraphicsCommandList* commandList, uint32_t scope);
+
+        /**
+         * @brief フレームの計測を終了（クエリをリードバックバッファへ解決）
+         */
+        void EndFrame(ID3D12GraphicsCommandList* commandList);
+
+        /**
+         * @brief 最新の計測結果を取得
+         * @return ミリ秒（読み戻したフレームで計測されていない場合は負の値）
+         */
+        float GetScopeMs(const std::string& name) const;
+
+        /**
+         * @brief 最新の計測結果をすべて取得
+         */
+        const std::unordered_map<std::string, float>& GetResults() const { return results; }
+
+        bool IsInitialized() const { return queryHeap != nullptr; }
+
+    private:
+        struct FrameSlot {
+            std::vector<std::string> scopeNames;   // 区間名（区間ID順）
+            bool resolved = false;                 // EndFrame() で解決済みか
+        };
+
+        uint32_t GetQueryBase(uint32_t slot) const { return slot * maxScopes * 2; }
+
+        ComPtr<ID3D12QueryHeap> queryHeap;
+        ComPtr<ID3D12Resource> readbackBuffer;
+
+        std::vector<FrameSlot> slots;
+        std::unordered_map<std::string, float> results;
+
+        uint64_t timestampFrequency = 0;           // ティック/秒
+        uint32_t maxScopes = 0;
+        uint32_t currentSlot = 0;
+        bool frameActive = false;
+    };
+
+} // namespace Athena
\ No newline at end of file
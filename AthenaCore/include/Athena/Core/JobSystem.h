@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief フレーム内の並列処理用のワーカースレッドプール
+     *
+     * ParallelFor でジョブ番号 0..jobCount-1 をワーカーと呼び出し元のスレッドで分け合い、
+     * すべて終わるまで戻らない。ジョブ番号の割り当ては実行ごとに変わるため、
+     * 結果の順序を固定したい場合はジョブ番号ごとの出力先に書き、後で番号順に結合する。
+     *
+     * ジョブの中から ParallelFor を呼んだ場合はそのスレッドで順に実行する。
+     * ジョブが例外を投げた場合は、残りのジョブの完了を待ってから最初の例外を呼び出し元で投げ直す。
+     */
+    class JobSystem {
+    public:
+        JobSystem() = default;
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief ワーカースレッドを起動（0 の場合はワーカーなしで呼び出し元だけが実行する）
+         */
+        void Initialize(uint32_t workerThreadCount);
+        void Shutdown();
+
+        /**
+         * @brief 既定のワーカー数（論理コア数 - 1、呼び出し元のスレッドと合わせてコア数になる）
+         */
+        static uint32_t GetDefaultWorkerCount();
+
+        /**
+         * @brief 処理に参加するスレッド数（ワーカー + 呼び出し元）
+         */
+        uint32_t GetThreadCount() const { return static_cast<uint32_t>(workers.size()) + 1; }
+
+        /**
+         * @brief job(jobIndex) を jobCount 回並列に実行し、完了を待つ
+         */
+        void ParallelFor(uint32_t jobCount, const std::function<void(uint32_t)>& job);
+
+        /**
+         * @brief シーンなどが使用するジョブシステムを設定（nullptr で解除）
+         */
+        static void SetGlobal(JobSystem* jobSystem) { globalJobSystem.store(jobSystem, std::memory_order_release); }
+        static JobSystem* GetGlobal() { return globalJobSystem.load(std::memory_order_acquire); }
+
+        /**
+         * @brief グローバルのジョブシステムで実行（未設定の場合は呼び出し元で順に実行）
+         */
+        static void Run(uint32_t jobCount, const std::function<void(uint32_t)>& job);
+
+    private:
+        struct Batch {
+            const std::function<void(uint32_t)>* job = nullptr;
+            uint32_t jobCount = 0;
+            std::atomic<uint32_t> nextJob{ 0 };
+            std::mutex errorMutex;
+            std::exception_ptr error;
+        };
+
+        void WorkerLoop();
+        static void RunJobs(Batch& batch);
+
+        std::vector<std::thread> workers;
+        std::mutex dispatchMutex;               // ParallelFor の同時呼び出しを直列化
+        std::mutex mutex;
+        std::condition_variable batchAvailable;
+        std::condition_variable workersIdle;
+        Batch* currentBatch = nullptr;
+        uint64_t batchSerial = 0;
+        uint32_t activeWorkers = 0;
+        bool stopping = false;
+
+        static inline std::atomic<JobSystem*> globalJobSystem{ nullptr };
+    };
+
+} // namespace Athena
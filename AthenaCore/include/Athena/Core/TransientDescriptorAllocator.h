@@ -0,0 +1,112 @@
+#pragma once
+
+#include "DescriptorHeap.h"
+#include "SwapChain.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief フレーム単位で使い捨てるシェーダー可視デスクリプタの線形アロケータ
+     *
+     * シェーダー可視ヒープを1つ作成し、フレーム数分のパーティションに分割する。
+     * 描画・パスごとのSRVテーブルはパーティション内でポインタを進めるだけで割り当て、
+     * CPU専用ヒープ（シェーダー不可視）のデスクリプタを CopyDescriptorsSimple で書き込む。
+     * 個別の解放はなく、パーティションのフェンスが完了した時点で丸ごと再利用する。
+     *
+     * 使い方:
+     *   allocator.BeginFrame(queue.GetCompletedValue());
+     *   auto table = allocator.CopyTable(stagingHandle, 3);
+     *   commandList->SetGraphicsRootDescriptorTable(1, table.gpu);
+     *   ... 送信後 ...
+     *   allocator.EndFrame(signaledFenceValue);
+     */
+    class TransientDescriptorAllocator {
+    public:
+        static constexpr uint32_t DefaultDescriptorsPerFrame = 1024;
+
+        TransientDescriptorAllocator() = default;
+        ~TransientDescriptorAllocator() = default;
+
+        TransientDescriptorAllocator(const TransientDescriptorAllocator&) = delete;
+        TransientDescriptorAllocator& operator=(const TransientDescriptorAllocator&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param type ヒープのタイプ（CBV_SRV_UAV または Sampler）
+         * @param descriptorsPerFrame 1フレームで使用できるデスクリプタ数
+         * @param frameCount パーティション数（同時に処理中のフレーム数。フレームのリングと同じ数にする）
+         */
+        void Initialize(
+            ID3D12Device* device,
+            D3D12_DESCRIPTOR_HEAP_TYPE type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+            uint32_t descriptorsPerFrame = DefaultDescriptorsPerFrame,
+            uint32_t frameCount = SwapChain::BufferCount
+        );
+
+        void Shutdown();
+
+        /**
+         * @brief 次のパーティションが再利用可能か（前回使用したフレームのフェンスが完了しているか）
+         */
+        bool CanBeginFrame(uint64_t completedFenceValue) const;
+
+        /**
+         * @brief 次のパーティションに切り替えて先頭から使い直す
+         * @param completedFenceValue GPUが完了したフェンス値
+         *
+         * パーティションを前回使用したフレームのフェンスが未完了の場合は例外をスロー（現在のパーティションはそのまま）。
+         */
+        void BeginFrame(uint64_t completedFenceValue);
+
+        /**
+         * @brief 現在のパーティションをフェンス値に紐付ける（コマンドリスト送信後に呼び出す）
+         */
+        void EndFrame(uint64_t fenceValue);
+
+        /**
+         * @brief 連続したデスクリプタを割り当て
+         *
+         * パーティションが満杯の場合は例外をスロー。
+         */
+        DescriptorHandle Allocate(uint32_t count = 1);
+
+        /**
+         * @brief 連続したCPUデスクリプタをテーブルとしてコピー
+         * @param source コピー元の先頭（シェーダー不可視ヒープ）
+         * @param count デスクリプタ数
+         */
+        DescriptorHandle CopyTable(D3D12_CPU_DESCRIPTOR_HANDLE source, uint32_t count);
+
+        /**
+         * @brief 離れた位置にあるCPUデスクリプタを1つのテーブルにまとめてコピー
+         */
+        DescriptorHandle CopyTable(const D3D12_CPU_DESCRIPTOR_HANDLE* sources, uint32_t count);
+
+        ID3D12DescriptorHeap* GetD3D12DescriptorHeap() const { return heap.Get(); }
+        uint32_t GetDescriptorsPerFrame() const { return descriptorsPerFrame; }
+        uint32_t GetUsedCount() const { return usedCount; }
+        uint32_t GetPeakUsedCount() const { return peakUsedCount; }
+
+    private:
+        ComPtr<ID3D12Device> device;
+        ComPtr<ID3D12DescriptorHeap> heap;
+        D3D12_DESCRIPTOR_HEAP_TYPE type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        uint32_t descriptorSize = 0;
+        D3D12_CPU_DESCRIPTOR_HANDLE cpuStart = {};
+        D3D12_GPU_DESCRIPTOR_HANDLE gpuStart = {};
+
+        uint32_t descriptorsPerFrame = 0;
+        std::vector<uint64_t> partitionFences;     // パーティションを最後に使用したフレームのフェンス値
+        uint32_t currentPartition = 0;
+        uint32_t usedCount = 0;                    // 現在のパーティションで割り当て済みの数
+        uint32_t peakUsedCount = 0;
+    };
+
+} // namespace Athena
\ No newline at end of file
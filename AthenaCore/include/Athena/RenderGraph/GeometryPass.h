@@ -5,6 +5,8 @@
 #include "../Resources/Texture.h"
 #include "../Utils/Math.h"
 #include "../Core/DescriptorHeap.h"
+#include "../Resources/PipelineCache.h"
+#include "../Resources/ShaderPermutation.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <memory>
@@ -125,6 +127,11 @@ namespace Athena {
          */
         void SetRenderMode(RenderMode mode) { renderMode = mode; }
 
+        /**
+         * @brief 頂点/インデックスバッファの作成に使用するGPUメモリアロケータを設定
+         */
+        void SetMemoryAllocator(GpuMemoryAllocator* allocator) { memoryAllocator = allocator; }
+
         /**
          * @brief G-Bufferテクスチャを設定（ディファードモード用）
          */
@@ -169,15 +176,24 @@ namespace Athena {
          */
         uint32_t AddTextureToBindlessHeap(std::shared_ptr<Texture> texture, ID3D12Device* device);
 
+        /**
+         * @brief ピクセルシェーダーのバリアント（キーワード DEFERRED, USE_TEXTURE）
+         */
+        static ShaderPermutationDesc GetPixelShaderPermutations();
+
     private:
         // パイプライン状態
         ComPtr<ID3D12RootSignature> rootSignature;
-        ComPtr<ID3D12PipelineState> pipelineState;
+        ComPtr<ID3DBlob> vertexShader;
+        ShaderPermutationSet pixelShaders;
+        std::vector<PipelineHandle> pipelines;               // キーがインデックス（完了まで描画を省略）
+        ShaderPermutationKey deferredKeyword = 0;
+        ShaderPermutationKey textureKeyword = 0;
 
         // バッファ
         std::unique_ptr<Buffer> vertexBuffer;
         std::unique_ptr<Buffer> indexBuffer;
-        std::unique_ptr<Buffer> constantBuffer;
+        GpuMemoryAllocator* memoryAllocator = nullptr;
 
         // テクスチャ
         std::shared_ptr<Texture> mainTexture;
@@ -221,19 +237,14 @@ namespace Athena {
         RenderMode renderMode = RenderMode::Forward;
 
         /**
-         * @brief パイプライン状態を作成（モード別）
-         */
-        void CreatePipelineState(ID3D12Device* device);
-        void CreateForwardPipelineState(ID3D12Device* device);
-        void CreateDeferredPipelineState(ID3D12Device* device);
-
-        /**
-         * @brief ルートシグネチャを作成
+         * @brief バリアントのパイプライン状態を要求（DEFERRED の場合は G-Buffer の MRT）
          */
-        void CreateRootSignature(ID3D12Device* device);
+        void CreatePipelineState(ID3D12Device* device, ShaderPermutationKey key);
 
         /**
          * @brief 頂点/インデックスバッファを更新
+         *
+         * 古いバッファは DeferredReleaseQueue を通じてGPUの完了後に解放される。
          */
         void UpdateBuffers(ID3D12Device* device);
 
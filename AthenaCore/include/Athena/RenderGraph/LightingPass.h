@@ -113,6 +113,11 @@ namespace Athena {
          */
         void ClearLights() { lightCount = 0; }
 
+        /**
+         * @brief 登録済みのライト数を取得
+         */
+        uint32_t GetLightCount() const { return lightCount; }
+
         /**
          * @brief レンダーターゲットサイズを設定
          */
@@ -126,9 +131,6 @@ namespace Athena {
         ComPtr<ID3D12RootSignature> rootSignature;
         ComPtr<ID3D12PipelineState> pipelineState;
 
-        // バッファ
-        std::unique_ptr<Buffer> constantBuffer;
-
         // G-Bufferテクスチャ
         std::shared_ptr<Texture> gbufferAlbedo;  // アルベド + メタリック
         std::shared_ptr<Texture> gbufferNormal;  // 法線 + ラフネス
@@ -153,11 +155,6 @@ namespace Athena {
          */
         void CreatePipelineState(ID3D12Device* device);
 
-        /**
-         * @brief ルートシグネチャを作成
-         */
-        void CreateRootSignature(ID3D12Device* device);
-
         /**
          * @brief シェーダーをコンパイル
          */
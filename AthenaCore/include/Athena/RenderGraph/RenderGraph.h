@@ -1,11 +1,16 @@
 #pragma once
 #include "ResourceHandle.h"
 #include "RenderPass.h"
+#include "StaticRenderPipeline.h"
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
+#include <optional>
 #include <functional>
+#include <mutex>
+#include <thread>
+#include <atomic>
 
 namespace Athena {
 
@@ -61,14 +66,31 @@ namespace Athena {
      * @brief パス実行情報
      */
     struct PassInfo {
-        std::unique_ptr<RenderPass> pass;
+        std::shared_ptr<RenderPass> pass;      // コンパイル済みグラフと共有するため shared_ptr
         uint32_t passIndex;
         std::vector<ResourceHandle> inputs;    // 入力リソース
         std::vector<ResourceHandle> outputs;   // 出力リソース
-        std::vector<ResourceStateTransition> preBarriers;   // パス実行前のバリア
-        std::vector<ResourceStateTransition> postBarriers;  // パス実行後のバリア
         PassSetupData setupData;
         bool enabled = true;
+        bool isSetup = false;                  // Setup() 実行済みかどうか
+    };
+
+    /**
+     * @brief コンパイル済みパス情報
+     *
+     * コンパイル時点のパス記述のスナップショットと、算出されたバリアを保持する。
+     * 実行中に宣言側（PassInfo）が変更されても影響を受けない。
+     */
+    struct CompiledPass {
+        std::shared_ptr<RenderPass> pass;
+        uint32_t passIndex = 0;
+        std::vector<ResourceHandle> inputs;
+        std::vector<ResourceHandle> outputs;
+        std::vector<ResourceStateTransition> preBarriers;   // パス実行前のバリア
+        std::vector<ResourceStateTransition> postBarriers;  // パス実行後のバリア
+        std::unordered_map<std::string, float> floatParams;
+        std::unordered_map<std::string, int> intParams;
+        std::unordered_map<std::string, bool> boolParams;
     };
 
     /**
@@ -94,6 +116,21 @@ namespace Athena {
         size_t memoryUsage = 0;                 // バイト単位
         float compileTime = 0.0f;               // 秒
         float executeTime = 0.0f;               // 秒
+        uint64_t compiledVersion = 0;           // 実行中のコンパイル済みグラフの世代
+    };
+
+    /**
+     * @brief コンパイル済みレンダーグラフ
+     *
+     * Compile() の成果物をまとめた不変データ。Execute() はこれだけを参照するため、
+     * ワーカースレッドで次のグラフをコンパイルしている間も現在のグラフを安全に実行できる。
+     */
+    struct CompiledRenderGraph {
+        std::vector<CompiledPass> passes;                        // 実行順に並んだパス
+        std::unordered_map<uint32_t, ResourceInfo> resources;    // ライフタイム・実体を含むリソース
+        std::unordered_set<ResourceHandle> finalOutputs;
+        RenderGraphStats stats;                                  // コンパイル時の統計
+        uint64_t version = 0;
     };
 
     /**
@@ -129,6 +166,31 @@ namespace Athena {
          */
         uint32_t AddPass(std::unique_ptr<RenderPass> pass);
 
+        /**
+         * @brief パスの有効／無効を切り替え
+         *
+         * 無効なパスは次回のコンパイルから実行対象外になる。
+         * 反映するには Compile() または CompileAsync() を呼び出すこと。
+         *
+         * @param passIndex AddPass() が返したパスインデックス
+         * @param enabled 有効にする場合true
+         * @return 状態が変化した場合true
+         */
+        bool SetPassEnabled(uint32_t passIndex, bool enabled);
+
+        /**
+         * @brief パスが有効か
+         */
+        bool IsPassEnabled(uint32_t passIndex) const;
+
+        /**
+         * @brief 全パスの Setup() を次のコンパイルでやり直す（画面サイズの変更時など）
+         *
+         * GPUがパスのリソースを使い終えてから呼び出すこと。進行中のバックグラウンドコンパイルは
+         * 完了を待つ。
+         */
+        void InvalidatePassSetup();
+
         /**
          * @brief 外部リソースを登録
          * @param handle 外部リソースハンドル
@@ -160,6 +222,61 @@ namespace Athena {
          */
         bool Compile();
 
+        /**
+         * @brief グラフをワーカースレッドでコンパイル
+         *
+         * 現在のコンパイル済みグラフは実行を続け、完了した結果は次のフレーム境界
+         * （ApplyPendingCompile() / Execute() の先頭）で差し替えられる。
+         * 既にコンパイル中の場合は何もせず false を返す。
+         * 未セットアップのパスの Setup() は、ワーカーを開始する前に呼び出し側のスレッドで実行する。
+         *
+         * @return コンパイルを開始した場合true
+         */
+        bool CompileAsync();
+
+        /**
+         * @brief バックグラウンドコンパイルが進行中か
+         */
+        bool IsCompiling() const { return compileInProgress.load(); }
+
+        /**
+         * @brief バックグラウンドコンパイルの完了を待機
+         * @return 最後のコンパイルが成功した場合true
+         */
+        bool WaitForCompile();
+
+        /**
+         * @brief 完了したコンパイル結果を実行用グラフに差し替え
+         *
+         * フレーム境界（コマンドリスト記録前）で呼び出すこと。Execute() も先頭で呼び出す。
+         *
+         * @return 差し替えが行われた場合true
+         */
+        bool ApplyPendingCompile();
+
+        /**
+         * @brief 実行中のコンパイル済みグラフを取得
+         */
+        std::shared_ptr<const CompiledRenderGraph> GetCompiledGraph() const;
+
+        /**
+         * @brief コンパイル時に計算された静的スケジュールを取り込む
+         *
+         * 依存関係・ライフタイム・バリアの解析を行わず、StaticRenderPipeline の
+         * 事前計算結果からコンパイル済みグラフを直接構築する。既存のパス・リソースはクリアされる。
+         * 動的な構築（AddPass + Compile）はエディタやツール用にそのまま利用できる。
+         *
+         * @param schedule StaticRenderPipeline<...>::Schedule.View()
+         * @param passes パス宣言と同じ順序のパス実体
+         * @param externalTextures 外部リソース名 → テクスチャ
+         * @param outHandles リソース宣言順のハンドル（不要ならnullptr）
+         * @return 成功時true
+         */
+        bool ImportStaticSchedule(const StaticScheduleView& schedule,
+                                  std::vector<std::unique_ptr<RenderPass>> passes,
+                                  const std::unordered_map<std::string, std::shared_ptr<Texture>>& externalTextures = {},
+                                  std::vector<ResourceHandle>* outHandles = nullptr);
+
         /**
          * @brief グラフを実行
          * @param renderContext レンダリングコンテキスト
@@ -174,15 +291,17 @@ namespace Athena {
 
         /**
          * @brief リソース情報を取得
+         *
+         * コンパイル済みグラフのリソースを優先して返す。グラフの差し替えで無効にならないよう値で返す。
          */
-        const ResourceInfo* GetResourceInfo(const ResourceHandle& handle) const;
+        std::optional<ResourceInfo> GetResourceInfo(const ResourceHandle& handle) const;
 
         /**
          * @brief 実際のリソースを取得
          */
         template<typename T>
         std::shared_ptr<T> GetResource(const ResourceHandle& handle) const {
-            const ResourceInfo* info = GetResourceInfo(handle);
+            std::optional<ResourceInfo> info = GetResourceInfo(handle);
             return info ? info->GetResource<T>() : nullptr;
         }
 
@@ -208,15 +327,28 @@ namespace Athena {
         RenderGraphSettings settings;
         RenderGraphStats stats;
 
-        // パス管理
+        // パス管理（宣言側：AddPass などで変更される）
         std::vector<PassInfo> passes;
-        std::vector<uint32_t> executionOrder;      // 実行順序
 
-        // リソース管理
+        // リソース管理（宣言側）
         std::unordered_map<uint32_t, ResourceInfo> resources;
         std::unordered_set<ResourceHandle> finalOutputs;
         uint32_t nextResourceId = 1;
 
+        // 宣言側データの保護（ワーカースレッドのスナップショット取得・CreateResource 用）
+        mutable std::mutex declarationMutex;
+
+        // コンパイル済みグラフ（実行側）と差し替え待ちのグラフ
+        std::shared_ptr<const CompiledRenderGraph> compiledGraph;
+        std::shared_ptr<const CompiledRenderGraph> pendingGraph;
+        mutable std::mutex compiledMutex;
+
+        // バックグラウンドコンパイル
+        std::thread compileThread;
+        std::atomic<bool> compileInProgress{ false };
+        std::atomic<bool> lastCompileSucceeded{ true };
+        uint64_t nextCompiledVersion = 1;
+
         // 一時リソースプール
         std::vector<std::shared_ptr<Texture>> texturePool;
         std::vector<std::shared_ptr<Buffer>> bufferPool;
@@ -226,42 +358,70 @@ namespace Athena {
          */
         uint32_t GenerateResourceId() { return nextResourceId++; }
 
+        /**
+         * @brief コンパイル処理本体（スレッドを問わず呼び出し可能）
+         *
+         * パスの Setup() は行わないため、呼び出し前に SetupPendingPasses() を済ませておくこと。
+         * @return 成功時はコンパイル済みグラフ、失敗時はnullptr
+         */
+        std::shared_ptr<CompiledRenderGraph> BuildCompiledGraph();
+
+        /**
+         * @brief 未セットアップのパスに対して Setup() を実行
+         */
+        void SetupPendingPasses();
+
+        /**
+         * @brief 宣言側データのスナップショットを作成
+         */
+        std::shared_ptr<CompiledRenderGraph> SnapshotDeclaration();
+
+        /**
+         * @brief コンパイル済みグラフを実行用として設定し、統計を更新
+         */
+        void InstallCompiledGraph(std::shared_ptr<const CompiledRenderGraph> compiled);
+
+        /**
+         * @brief コンパイル済みグラフのリソース統計を集計
+         */
+        void UpdateResourceStats(CompiledRenderGraph& graph) const;
+
         /**
          * @brief 依存関係を解析し、実行順序を決定
          */
-        bool AnalyzeDependencies();
+        bool AnalyzeDependencies(CompiledRenderGraph& graph);
 
         /**
          * @brief トポロジカルソート（カーンのアルゴリズム）
          */
-        bool TopologicalSort(const std::vector<uint32_t>& enabledPasses);
+        bool TopologicalSort(CompiledRenderGraph& graph);
 
         /**
          * @brief 依存関係グラフを構築
          */
-        void BuildDependencyGraph(const std::vector<uint32_t>& enabledPasses,
-                                 std::unordered_map<uint32_t, uint32_t>& inDegree,
-                                 std::unordered_map<uint32_t, std::vector<uint32_t>>& adjacencyList);
+        void BuildDependencyGraph(const std::vector<CompiledPass>& compiledPasses,
+                                 std::vector<uint32_t>& inDegree,
+                                 std::vector<std::vector<uint32_t>>& adjacencyList);
 
         /**
          * @brief 未使用パスを除去
          */
-        void CullUnusedPasses();
+        void CullUnusedPasses(CompiledRenderGraph& graph);
 
         /**
          * @brief リソースライフタイムを解析
          */
-        void AnalyzeResourceLifetime();
+        void AnalyzeResourceLifetime(CompiledRenderGraph& graph);
 
         /**
          * @brief リソース配置を最適化
          */
-        void OptimizeResourceAllocation();
+        void OptimizeResourceAllocation(CompiledRenderGraph& graph);
 
         /**
          * @brief リソースバリアを解析・挿入
          */
-        void AnalyzeResourceBarriers();
+        void AnalyzeResourceBarriers(CompiledRenderGraph& graph);
 
         /**
          * @brief リソースの互換性をチェック
@@ -277,12 +437,13 @@ namespace Athena {
          * @brief リソースバリアをコマンドリストに挿入
          */
         void InsertResourceBarriers(ID3D12GraphicsCommandList* commandList,
+                                   const CompiledRenderGraph& graph,
                                    const std::vector<ResourceStateTransition>& barriers);
 
         /**
          * @brief 一時リソースを作成・配置
          */
-        bool AllocateTransientResources();
+        bool AllocateTransientResources(CompiledRenderGraph& graph);
 
         /**
          * @brief 実際のリソースオブジェクトを作成
@@ -305,8 +466,8 @@ namespace Athena {
         /**
          * @brief バリデーション
          */
-        bool ValidateGraph() const;
-        bool ValidatePass(const PassInfo& passInfo) const;
+        bool ValidateGraph(const CompiledRenderGraph& graph) const;
+        bool ValidatePass(const CompiledPass& compiledPass) const;
         bool ValidateResource(const ResourceInfo& resourceInfo) const;
     };
 
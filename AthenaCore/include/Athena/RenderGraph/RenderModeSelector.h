@@ -0,0 +1,136 @@
+#pragma once
+#include "GeometryPass.h"
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    class RenderGraph;
+
+    /**
+     * @brief モード選択に使う1フレーム分の入力
+     *
+     * パス時間は measuredMode で実際に描画したパスの計測値（GPU時間）。
+     * 計測値がない場合は負の値のままにしておくと、コストモデルの予測のみで判断する。
+     */
+    struct RenderModeFrameInfo {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t lightCount = 1;
+        GeometryPass::RenderMode measuredMode = GeometryPass::RenderMode::Forward;
+        float geometryPassMs = -1.0f;              // Forward: シェーディング込み / Deferred: G-Buffer生成
+        float lightingPassMs = -1.0f;              // Deferred のライティングパスのみ
+    };
+
+    /**
+     * @brief 解像度とライト数からパスコストを予測する係数（ミリ秒 / 100万ピクセル）
+     *
+     * フォワードはピクセルごとに全ライトを評価し、ディファードは G-Buffer の書き込み帯域を
+     * 払う代わりにライト1灯あたりのコストが小さい。初期値はライト数本程度で逆転する目安で、
+     * 実行中は計測値で補正される。
+     */
+    struct RenderModeCostModel {
+        float forwardPerPixel = 0.6f;
+        float forwardPerPixelLight = 0.35f;
+        float gbufferPerPixel = 1.2f;
+        float deferredLightingPerPixel = 0.3f;
+        float deferredLightingPerPixelLight = 0.08f;
+    };
+
+    /**
+     * @brief モード選択の設定（ヒステリシス）
+     */
+    struct RenderModeSelectorSettings {
+        float switchThreshold = 0.15f;             // 予測コストがこの割合以上安い場合のみ切り替え候補にする
+        uint32_t confirmFrames = 10;               // 切り替え候補が連続したフレーム数
+        uint32_t minFramesBetweenSwitches = 60;    // 切り替え後の最低維持フレーム数
+        float calibrationSmoothing = 0.1f;         // 計測値による補正の指数移動平均係数
+    };
+
+    /**
+     * @brief モードごとに有効化するパスの集合（RenderGraph のパスインデックス）
+     *
+     * どちらにも含まれないパス（トーンマッピング等）は変更しない。
+     */
+    struct RenderModePassSets {
+        std::vector<uint32_t> forwardPasses;
+        std::vector<uint32_t> deferredPasses;
+    };
+
+    /**
+     * @brief コストモデルによるフォワード／ディファード自動選択
+     *
+     * 毎フレーム Update() に計測値を渡すと、現在のモードの補正係数を更新し、
+     * 両モードの予測コストを比較する。もう一方のモードが switchThreshold 以上安い状態が
+     * confirmFrames 連続し、かつ前回の切り替えから minFramesBetweenSwitches 経過した場合のみ
+     * 切り替える。選択結果は ApplyToGraph() でパスの有効／無効として RenderGraph に反映する。
+     */
+    class RenderModeSelector {
+    public:
+        explicit RenderModeSelector(GeometryPass::RenderMode initialMode = GeometryPass::RenderMode::Forward,
+                                    const RenderModeSelectorSettings& settings = RenderModeSelectorSettings{});
+
+        /**
+         * @brief フレームの計測値を反映してモードを選択
+         * @return このフレーム以降に使用するモード
+         */
+        GeometryPass::RenderMode Update(const RenderModeFrameInfo& info);
+
+        /**
+         * @brief 補正込みの予測コストを取得（ミリ秒）
+         */
+        float PredictCost(GeometryPass::RenderMode mode, const RenderModeFrameInfo& info) const;
+
+        /**
+         * @brief 選択中のパスのみを有効化
+         *
+         * 有効状態が変化した場合は RenderGraph::CompileAsync() を呼び出す。
+         *
+         * @return パスの有効状態が変化した場合true
+         */
+        bool ApplyToGraph(RenderGraph& graph, const RenderModePassSets& passSets) const;
+
+        /**
+         * @brief 選択状態と補正係数をリセット
+         */
+        void Reset(GeometryPass::RenderMode mode);
+
+        GeometryPass::RenderMode GetMode() const { return currentMode; }
+        bool IsDeferred() const { return currentMode == GeometryPass::RenderMode::Deferred; }
+        uint32_t GetSwitchCount() const { return switchCount; }
+
+        void SetSettings(const RenderModeSelectorSettings& settings) { this->settings = settings; }
+        const RenderModeSelectorSettings& GetSettings() const { return settings; }
+
+        void SetCostModel(const RenderModeCostModel& model) { costModel = model; }
+        const RenderModeCostModel& GetCostModel() const { return costModel; }
+
+    private:
+        /**
+         * @brief 補正前の予測コスト（ミリ秒）
+         */
+        float ForwardBaseCost(const RenderModeFrameInfo& info) const;
+        float GBufferBaseCost(const RenderModeFrameInfo& info) const;
+        float DeferredLightingBaseCost(const RenderModeFrameInfo& info) const;
+
+        /**
+         * @brief 計測値 / 予測値の比で補正係数を更新
+         */
+        void Calibrate(float& scale, float measuredMs, float predictedMs) const;
+
+        RenderModeSelectorSettings settings;
+        RenderModeCostModel costModel;
+
+        GeometryPass::RenderMode currentMode;
+
+        // 計測値による補正係数（1.0 = 予測どおり）
+        float forwardScale = 1.0f;
+        float gbufferScale = 1.0f;
+        float deferredLightingScale = 1.0f;
+
+        uint32_t framesSinceSwitch = 0;
+        uint32_t pendingSwitchFrames = 0;
+        uint32_t switchCount = 0;
+    };
+
+} // namespace Athena
\ No newline at end of file
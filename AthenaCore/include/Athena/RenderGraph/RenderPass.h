@@ -12,6 +12,7 @@ namespace Athena {
     // Forward declarations
     class RenderContext;
     class RenderGraphBuilder;
+    class ConstantBufferAllocator;
 
     /**
      * @brief レンダーパスの実行データ
@@ -31,6 +32,8 @@ namespace Athena {
         // D3D12関連
         ID3D12GraphicsCommandList* commandList = nullptr;
         ID3D12DescriptorHeap* srvHeap = nullptr;
+        D3D12_GPU_DESCRIPTOR_HANDLE srvTable = {};     // srvHeap 内のSRVテーブル（0 の場合はヒープ先頭）
+        ConstantBufferAllocator* constantAllocator = nullptr;  // 描画ごとの定数（必須。未設定の場合パスは例外をスロー）
         
         // 実行時パラメータ（パス固有の設定値など）
         std::unordered_map<std::string, float> floatParams;
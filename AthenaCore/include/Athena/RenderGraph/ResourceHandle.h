@@ -34,19 +34,46 @@ namespace Athena {
         CopyDestination = 1 << 5,   // コピー先として使用
     };
 
-    // ビット演算子のオーバーロード
-    inline ResourceUsage operator|(ResourceUsage a, ResourceUsage b) {
+    // ビット演算子のオーバーロード（静的パイプラインの定数評価でも使用するため constexpr）
+    constexpr ResourceUsage operator|(ResourceUsage a, ResourceUsage b) {
         return static_cast<ResourceUsage>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
     }
 
-    inline ResourceUsage operator&(ResourceUsage a, ResourceUsage b) {
+    constexpr ResourceUsage operator&(ResourceUsage a, ResourceUsage b) {
         return static_cast<ResourceUsage>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b));
     }
 
-    inline bool HasUsage(ResourceUsage usage, ResourceUsage flag) {
+    constexpr bool HasUsage(ResourceUsage usage, ResourceUsage flag) {
         return (usage & flag) == flag;
     }
 
+    /**
+     * @brief 使用方法から必要なリソース状態を求める
+     *
+     * 実行時のRenderGraphと静的パイプライン（StaticRenderPipeline）で同じ規則を使う。
+     */
+    constexpr D3D12_RESOURCE_STATES GetResourceStateForUsage(ResourceUsage usage, bool isWrite) {
+        if (HasUsage(usage, ResourceUsage::RenderTarget)) {
+            return D3D12_RESOURCE_STATE_RENDER_TARGET;
+        }
+        if (HasUsage(usage, ResourceUsage::DepthStencil)) {
+            return isWrite ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_DEPTH_READ;
+        }
+        if (HasUsage(usage, ResourceUsage::ShaderResource)) {
+            return D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+        }
+        if (HasUsage(usage, ResourceUsage::UnorderedAccess)) {
+            return D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+        }
+        if (HasUsage(usage, ResourceUsage::CopyDestination)) {
+            return D3D12_RESOURCE_STATE_COPY_DEST;
+        }
+        if (HasUsage(usage, ResourceUsage::CopySource)) {
+            return D3D12_RESOURCE_STATE_COPY_SOURCE;
+        }
+        return D3D12_RESOURCE_STATE_COMMON;
+    }
+
     /**
      * @brief リソースの詳細情報
      */
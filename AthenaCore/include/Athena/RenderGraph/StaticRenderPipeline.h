@@ -0,0 +1,285 @@
+#pragma once
+#include "ResourceHandle.h"
+#include <array>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+namespace Athena {
+
+    /**
+     * @brief 静的パイプラインのリソース宣言
+     *
+     * ビルド時に構成が決まるパイプライン用。文字列は文字列リテラルを指すこと。
+     */
+    struct StaticResourceDesc {
+        const char* name = "";
+        ResourceType type = ResourceType::Texture2D;
+        ResourceUsage usage = ResourceUsage::None;
+        uint32_t width = 0;                        // テクスチャ幅 / バッファサイズ
+        uint32_t height = 1;
+        DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+        bool isExternal = false;                   // 外部から供給されるリソース（バックバッファ等）
+        bool isFinalOutput = false;                // 最終出力（ライフタイムをグラフ末尾まで延長）
+    };
+
+    /**
+     * @brief パスとリソースの間のエッジ（読み込み／書き込み）
+     */
+    struct StaticEdge {
+        uint32_t pass = 0;                         // パス宣言のインデックス
+        uint32_t resource = 0;                     // リソース宣言のインデックス
+        bool isWrite = false;
+    };
+
+    /**
+     * @brief 事前計算されたリソースライフタイム（実行順序内の位置）
+     */
+    struct StaticResourceLifetime {
+        uint32_t firstPass = 0xFFFFFFFF;
+        uint32_t lastPass = 0xFFFFFFFF;
+    };
+
+    /**
+     * @brief 事前計算されたリソースバリア
+     */
+    struct StaticBarrier {
+        uint32_t orderIndex = 0;                   // 何番目に実行されるパスの前に発行するか
+        uint32_t resource = 0;
+        D3D12_RESOURCE_STATES fromState = D3D12_RESOURCE_STATE_COMMON;
+        D3D12_RESOURCE_STATES toState = D3D12_RESOURCE_STATE_COMMON;
+    };
+
+    /**
+     * @brief 静的パイプラインの宣言（パス・リソース・エッジ）
+     */
+    template<size_t PassCount, size_t ResourceCount, size_t EdgeCount>
+    struct StaticPipelineDesc {
+        std::array<const char*, PassCount> passes{};
+        std::array<StaticResourceDesc, ResourceCount> resources{};
+        std::array<StaticEdge, EdgeCount> edges{};
+    };
+
+    /**
+     * @brief 型を消去したスケジュールの参照（RenderGraph::ImportStaticSchedule 用）
+     */
+    struct StaticScheduleView {
+        std::span<const char* const> passNames;
+        std::span<const StaticResourceDesc> resources;
+        std::span<const StaticEdge> edges;
+        std::span<const uint32_t> order;
+        std::span<const StaticResourceLifetime> lifetimes;
+        std::span<const StaticBarrier> barriers;
+    };
+
+    /**
+     * @brief コンパイラが算出した実行スケジュール
+     *
+     * 実行順序・リソースライフタイム・バリア計画を保持する。
+     * 実行時の RenderGraph と異なり、パスの宣言順ではなくエッジのみから順序を決定する。
+     * ライフタイムとバリアの計算規則は実行時と同一である。
+     */
+    template<size_t PassCount, size_t ResourceCount, size_t EdgeCount>
+    struct StaticPipelineSchedule {
+        StaticPipelineDesc<PassCount, ResourceCount, EdgeCount> desc{};
+        bool indicesValid = false;                 // エッジのインデックスが範囲内か
+        bool acyclic = false;                      // 循環依存がないか
+        std::array<uint32_t, PassCount> order{};
+        std::array<StaticResourceLifetime, ResourceCount> lifetimes{};
+        std::array<StaticBarrier, EdgeCount> barriers{};  // エッジ1本につき最大1バリア
+        uint32_t barrierCount = 0;
+
+        constexpr bool IsValid() const { return indicesValid && acyclic; }
+
+        StaticScheduleView View() const {
+            StaticScheduleView view;
+            view.passNames = std::span<const char* const>(desc.passes.data(), PassCount);
+            view.resources = std::span<const StaticResourceDesc>(desc.resources.data(), ResourceCount);
+            view.edges = std::span<const StaticEdge>(desc.edges.data(), EdgeCount);
+            view.order = std::span<const uint32_t>(order.data(), PassCount);
+            view.lifetimes = std::span<const StaticResourceLifetime>(lifetimes.data(), ResourceCount);
+            view.barriers = std::span<const StaticBarrier>(barriers.data(), barrierCount);
+            return view;
+        }
+    };
+
+    /**
+     * @brief 宣言からパイプライン記述を作成（配列要素数から型を推論する）
+     */
+    template<size_t PassCount, size_t ResourceCount, size_t EdgeCount>
+    constexpr StaticPipelineDesc<PassCount, ResourceCount, EdgeCount> MakeStaticPipeline(
+        const std::array<const char*, PassCount>& passes,
+        const std::array<StaticResourceDesc, ResourceCount>& resources,
+        const std::array<StaticEdge, EdgeCount>& edges) {
+        return StaticPipelineDesc<PassCount, ResourceCount, EdgeCount>{ passes, resources, edges };
+    }
+
+    /**
+     * @brief 静的パイプラインをコンパイル（定数評価可能）
+     *
+     * 1. 依存関係の構築（書き込みの直列化 / 書き込み→読み込み）
+     * 2. カーンのアルゴリズムによる実行順序の決定
+     * 3. リソースライフタイムの計算
+     * 4. バリア計画の作成（全リソースは COMMON から開始）
+     */
+    template<size_t PassCount, size_t ResourceCount, size_t EdgeCount>
+    constexpr StaticPipelineSchedule<PassCount, ResourceCount, EdgeCount> CompileStaticPipeline(
+        const StaticPipelineDesc<PassCount, ResourceCount, EdgeCount>& desc) {
+
+        constexpr uint32_t Invalid = 0xFFFFFFFF;
+        StaticPipelineSchedule<PassCount, ResourceCount, EdgeCount> schedule{};
+        schedule.desc = desc;
+
+        // インデックスの範囲チェック
+        schedule.indicesValid = true;
+        for (const StaticEdge& edge : desc.edges) {
+            if (edge.pass >= PassCount || edge.resource >= ResourceCount) {
+                schedule.indicesValid = false;
+            }
+        }
+        if (!schedule.indicesValid) {
+            return schedule;
+        }
+
+        // 依存関係グラフ（隣接行列）を構築
+        // 宣言順に依存しないデータフロー規則：
+        //   - 同じリソースへの書き込みパスは宣言順に直列化する
+        //   - 読み込みのみのパスは、そのリソースを書き込む全パスの後に実行する
+        std::array<std::array<bool, PassCount>, PassCount> adjacency{};
+        for (uint32_t resource = 0; resource < ResourceCount; ++resource) {
+            std::array<bool, PassCount> writes{};
+            std::array<bool, PassCount> reads{};
+            for (const StaticEdge& edge : desc.edges) {
+                if (edge.resource != resource) continue;
+                (edge.isWrite ? writes : reads)[edge.pass] = true;
+            }
+
+            uint32_t previousWriter = Invalid;
+            for (uint32_t pass = 0; pass < PassCount; ++pass) {
+                if (!writes[pass]) continue;
+                if (previousWriter != Invalid) {
+                    adjacency[previousWriter][pass] = true;
+                }
+                previousWriter = pass;
+            }
+
+            for (uint32_t reader = 0; reader < PassCount; ++reader) {
+                if (!reads[reader] || writes[reader]) continue;
+                for (uint32_t writer = 0; writer < PassCount; ++writer) {
+                    if (writes[writer]) {
+                        adjacency[writer][reader] = true;
+                    }
+                }
+            }
+        }
+
+        // トポロジカルソート（カーンのアルゴリズム、FIFO）
+        std::array<uint32_t, PassCount> inDegree{};
+        for (uint32_t from = 0; from < PassCount; ++from) {
+            for (uint32_t to = 0; to < PassCount; ++to) {
+                if (adjacency[from][to]) {
+                    inDegree[to]++;
+                }
+            }
+        }
+
+        std::array<uint32_t, PassCount> queue{};
+        size_t head = 0;
+        size_t tail = 0;
+        for (uint32_t pass = 0; pass < PassCount; ++pass) {
+            if (inDegree[pass] == 0) {
+                queue[tail++] = pass;
+            }
+        }
+
+        size_t sortedCount = 0;
+        while (head < tail) {
+            uint32_t current = queue[head++];
+            schedule.order[sortedCount++] = current;
+            for (uint32_t to = 0; to < PassCount; ++to) {
+                if (adjacency[current][to] && --inDegree[to] == 0) {
+                    queue[tail++] = to;
+                }
+            }
+        }
+
+        schedule.acyclic = (sortedCount == PassCount);
+        if (!schedule.acyclic) {
+            return schedule;
+        }
+
+        // リソースライフタイム（実行順序内の位置）
+        for (uint32_t position = 0; position < PassCount; ++position) {
+            for (const StaticEdge& edge : desc.edges) {
+                if (edge.pass != schedule.order[position]) continue;
+
+                StaticResourceLifetime& lifetime = schedule.lifetimes[edge.resource];
+                if (lifetime.firstPass == Invalid || position < lifetime.firstPass) {
+                    lifetime.firstPass = position;
+                }
+                if (lifetime.lastPass == Invalid || position > lifetime.lastPass) {
+                    lifetime.lastPass = position;
+                }
+            }
+        }
+        for (size_t resource = 0; resource < ResourceCount; ++resource) {
+            if (desc.resources[resource].isFinalOutput) {
+                schedule.lifetimes[resource].lastPass = static_cast<uint32_t>(PassCount);
+            }
+        }
+
+        // バリア計画（実行時と同じく入力→出力の順で状態遷移を記録）
+        std::array<D3D12_RESOURCE_STATES, ResourceCount> currentState{};
+        for (D3D12_RESOURCE_STATES& state : currentState) {
+            state = D3D12_RESOURCE_STATE_COMMON;
+        }
+
+        for (uint32_t position = 0; position < PassCount; ++position) {
+            const uint32_t pass = schedule.order[position];
+            for (int writePhase = 0; writePhase < 2; ++writePhase) {
+                for (const StaticEdge& edge : desc.edges) {
+                    if (edge.pass != pass || edge.isWrite != (writePhase == 1)) continue;
+
+                    D3D12_RESOURCE_STATES required =
+                        GetResourceStateForUsage(desc.resources[edge.resource].usage, edge.isWrite);
+                    if (currentState[edge.resource] != required) {
+                        StaticBarrier& barrier = schedule.barriers[schedule.barrierCount++];
+                        barrier.orderIndex = position;
+                        barrier.resource = edge.resource;
+                        barrier.fromState = currentState[edge.resource];
+                        barrier.toState = required;
+                        currentState[edge.resource] = required;
+                    }
+                }
+            }
+        }
+
+        return schedule;
+    }
+
+    /**
+     * @brief 静的パイプライン
+     *
+     * 宣言（静的記憶域の constexpr 変数）を参照し、スケジュールをコンパイル時に確定させる。
+     * 循環依存や範囲外インデックスは static_assert でビルドエラーになる。
+     *
+     * 使用例：
+     *   constexpr auto kForwardDesc = MakeStaticPipeline(
+     *       std::array{ "Geometry", "ToneMapping" },
+     *       std::array{ StaticResourceDesc{ "HDR", ... }, StaticResourceDesc{ "BackBuffer", ... } },
+     *       std::array{ StaticEdge{ 0, 0, true }, StaticEdge{ 1, 0, false }, StaticEdge{ 1, 1, true } });
+     *   using ForwardPipeline = StaticRenderPipeline<kForwardDesc>;
+     *   renderGraph.ImportStaticSchedule(ForwardPipeline::Schedule.View(), std::move(passes));
+     */
+    template<const auto& Desc>
+    struct StaticRenderPipeline {
+        static constexpr auto Schedule = CompileStaticPipeline(Desc);
+
+        static_assert(Schedule.indicesValid, "Static render pipeline references an out-of-range pass or resource");
+        static_assert(Schedule.acyclic, "Static render pipeline contains a cyclic dependency");
+
+        static constexpr size_t PassCount = Schedule.order.size();
+        static constexpr size_t ResourceCount = Schedule.lifetimes.size();
+    };
+
+} // namespace Athena
\ No newline at end of file
@@ -110,13 +110,11 @@ namespace Athena {
         ComPtr<ID3D12RootSignature> rootSignature;
         ComPtr<ID3D12PipelineState> pipelineState;
 
-        // バッファ
-        std::unique_ptr<Buffer> constantBuffer;
-
         // HDRテクスチャ
         std::shared_ptr<Texture> hdrTexture;
 
         // トーンマッピングパラメータ
+        ToneMappingConstants constants = {};
         float exposure = 1.0f;
         float gamma = 2.2f;
         ToneMappingMethod toneMappingMethod = ToneMappingMethod::ACES;
@@ -130,11 +128,6 @@ namespace Athena {
          */
         void CreatePipelineState(ID3D12Device* device);
 
-        /**
-         * @brief ルートシグネチャを作成
-         */
-        void CreateRootSignature(ID3D12Device* device);
-
         /**
          * @brief シェーダーをコンパイル
          */
@@ -143,7 +136,7 @@ namespace Athena {
                                       const std::string& target);
 
         /**
-         * @brief 定数バッファを更新
+         * @brief パラメータから定数を作成
          */
         void UpdateConstants();
     };
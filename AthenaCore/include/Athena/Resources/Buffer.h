@@ -1,5 +1,7 @@
 #pragma once
 
+#include "GpuMemoryAllocator.h"
+#include "StreamingUploadQueue.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <cstdint>
@@ -8,6 +10,8 @@ namespace Athena {
 
     using Microsoft::WRL::ComPtr;
 
+    class UploadScheduler;
+
     /**
      * @brief �o�b�t�@�̎��
      */
@@ -35,12 +39,14 @@ namespace Athena {
          * @param size �o�b�t�@�T�C�Y�i�o�C�g�j
          * @param type �o�b�t�@�̎��
          * @param heapType �q�[�v�^�C�v�iDEFAULT or UPLOAD�j
+         * @param memoryAllocator 配置リソース用アロケータ（nullptr の場合はコミット済みリソース）
          */
         void Initialize(
             ID3D12Device* device,
             uint64_t size,
             BufferType type,
-            D3D12_HEAP_TYPE heapType = D3D12_HEAP_TYPE_DEFAULT
+            D3D12_HEAP_TYPE heapType = D3D12_HEAP_TYPE_DEFAULT,
+            GpuMemoryAllocator* memoryAllocator = nullptr
         );
 
         /**
@@ -57,11 +63,22 @@ namespace Athena {
         void Upload(const void* data, uint64_t size, uint64_t offset = 0);
 
         /**
-         * @brief DEFAULTヒープ用のアップロード（デバイスとコマンドキュー指定）
+         * @brief コピーキューで非同期にアップロード（DEFAULTヒープ用）
+         * @param scheduler アップロードスケジューラ（BeginBatch() 済みであること）
+         * @param finalState グラフィックスキューで使用する状態（AcquireUploads() で遷移）
+         */
+        void UploadWithScheduler(const void* data, uint64_t size, UploadScheduler& scheduler,
+                                 uint64_t offset = 0,
+                                 D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_COMMON);
+
+        /**
+         * @brief ストリーミングキューに分割して登録（予算内で数フレームに分けて転送）
+         *
+         * データはキューにコピーされる。完了するまでバッファを描画に使用しないこと。
          */
-        void UploadWithDevice(const void* data, uint64_t size, 
-                            ID3D12Device* device, ID3D12CommandQueue* commandQueue,
-                            uint64_t offset = 0);
+        void EnqueueUpload(const void* data, uint64_t size, StreamingUploadQueue& queue, UploadPriority priority,
+                           D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_COMMON,
+                           std::function<void()> onComplete = nullptr);
 
         /**
          * @brief �o�b�t�@���}�b�v�iCPU�A�N�Z�X�\�ɂ���j
@@ -81,6 +98,11 @@ namespace Athena {
         uint64_t GetSize() const { return size; }
         BufferType GetType() const { return type; }
 
+        /**
+         * @brief 現在のフレームで使用したことをメモリ予算管理に記録（退避中なら復帰）
+         */
+        void MarkUsed() const;
+
         // �r���[�擾
         D3D12_VERTEX_BUFFER_VIEW GetVertexBufferView() const;
         D3D12_INDEX_BUFFER_VIEW GetIndexBufferView() const;
@@ -92,9 +114,11 @@ namespace Athena {
         BufferType type;
         D3D12_HEAP_TYPE heapType;
         void* mappedData = nullptr;
+        uint32_t residencyId = UINT32_MAX;         // MemoryBudgetManager の登録ID
+        GpuAllocation allocation;                  // アロケータ使用時のヒープ内の割り当て
 
     private:
-        void CreateResource(ID3D12Device* device);
+        void CreateResource(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator);
     };
 
 } // namespace Athena
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "FrameLinearAllocator.h"
+#include "Athena/Core/SwapChain.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <cstring>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief 定数バッファ領域の割り当て結果
+     */
+    struct ConstantAllocation {
+        uint8_t* cpuAddress = nullptr;             // 書き込み先（マップ済み）
+        D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;  // SetGraphicsRootConstantBufferView に渡すアドレス
+        uint64_t size = 0;
+    };
+
+    /**
+     * @brief フレーム単位の定数バッファ割り当て
+     *
+     * UPLOADヒープのバッファを1つだけ作成して常時マップし、FrameLinearAllocator で
+     * 256バイト単位に切り出す。描画ごとに新しい領域へ書き込むため、1フレームで
+     * 複数の描画を発行しても、処理中の前フレームの定数を上書きしない。
+     *
+     * 使い方:
+     *   allocator.BeginFrame(queue.GetCompletedValue());
+     *   auto cb = allocator.Allocate(constants);
+     *   commandList->SetGraphicsRootConstantBufferView(0, cb.gpuAddress);
+     *   ... 送信後 ...
+     *   allocator.EndFrame(signaledFenceValue);
+     */
+    class ConstantBufferAllocator {
+    public:
+        static constexpr uint64_t Alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+        static constexpr uint64_t DefaultBytesPerFrame = 2ull * 1024 * 1024;
+
+        ConstantBufferAllocator() = default;
+        ~ConstantBufferAllocator();
+
+        ConstantBufferAllocator(const ConstantBufferAllocator&) = delete;
+        ConstantBufferAllocator& operator=(const ConstantBufferAllocator&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param bytesPerFrame 1フレームで使用できるサイズ（256バイト単位に切り上げ）
+         * @param frameCount パーティション数（同時に処理中のフレーム数。フレームのリングと同じ数にする）
+         */
+        void Initialize(ID3D12Device* device,
+                        uint64_t bytesPerFrame = DefaultBytesPerFrame,
+                        uint32_t frameCount = SwapChain::BufferCount);
+
+        /**
+         * @brief 終了処理（GPUの完了は呼び出し側で保証すること）
+         */
+        void Shutdown();
+
+        /**
+         * @brief 次のパーティションに切り替える（使用中の場合は例外をスロー）
+         */
+        void BeginFrame(uint64_t completedFenceValue) { allocator.BeginFrame(completedFenceValue); }
+
+        /**
+         * @brief 現在のパーティションをフェンス値に紐付ける
+         */
+        void EndFrame(uint64_t fenceValue) { allocator.EndFrame(fenceValue); }
+
+        /**
+         * @brief 定数バッファ領域を割り当て
+         *
+         * パーティションが満杯の場合は例外をスロー。
+         */
+        ConstantAllocation Allocate(uint64_t size);
+
+        /**
+         * @brief 割り当ててデータを書き込む
+         */
+        template<typename T>
+        ConstantAllocation Allocate(const T& data) {
+            ConstantAllocation allocation = Allocate(sizeof(T));
+            std::memcpy(allocation.cpuAddress, &data, sizeof(T));
+            return allocation;
+        }
+
+        bool IsInitialized() const { return resource != nullptr; }
+        uint64_t GetBytesPerFrame() const { return allocator.GetBytesPerFrame(); }
+        uint64_t GetUsedSize() const { return allocator.GetUsedSize(); }
+        uint64_t GetPeakUsedSize() const { return allocator.GetPeakUsedSize(); }
+
+    private:
+        ComPtr<ID3D12Resource> resource;
+        uint8_t* mappedData = nullptr;
+        D3D12_GPU_VIRTUAL_ADDRESS gpuStart = 0;
+        FrameLinearAllocator allocator;
+    };
+
+} // namespace Athena
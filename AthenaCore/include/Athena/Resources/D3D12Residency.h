@@ -0,0 +1,42 @@
+#pragma once
+
+#include "MemoryBudgetManager.h"
+#include <d3d12.h>
+#include <dxgi1_6.h>
+#include <wrl/client.h>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief DXGIのビデオメモリ予算（QueryVideoMemoryInfo のローカルセグメント）
+     */
+    class DxgiMemoryBudgetSource : public IMemoryBudgetSource {
+    public:
+        explicit DxgiMemoryBudgetSource(IDXGIAdapter4* adapter) : adapter(adapter) {}
+
+        MemoryBudgetInfo QueryBudget() override;
+
+    private:
+        ComPtr<IDXGIAdapter4> adapter;
+    };
+
+    /**
+     * @brief ID3D12Device::Evict / MakeResident による退避・復帰
+     *
+     * 登録オブジェクトは ID3D12Pageable* として扱う。
+     * MakeResident は常駐するまでCPUを待機させるため、描画直前の復帰は避けられない遅延になる。
+     */
+    class D3D12ResidencyBackend : public IResidencyBackend {
+    public:
+        explicit D3D12ResidencyBackend(ID3D12Device* device) : device(device) {}
+
+        bool Evict(void* object) override;
+        bool MakeResident(void* object) override;
+
+    private:
+        ComPtr<ID3D12Device> device;
+    };
+
+} // namespace Athena
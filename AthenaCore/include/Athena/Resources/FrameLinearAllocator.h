@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief フレームごとのパーティションを持つ線形（バンプ）アロケータ
+     *
+     * 扱うのはオフセットのみ（マップ済みバッファは ConstantBufferAllocator が持つ）。
+     * 領域を処理中のフレーム数分のパーティションに分割し、各フレームでは
+     * 1つのパーティション内でオフセットを進めるだけで割り当てる。個別の解放はなく、
+     * BeginFrame() でパーティションを切り替える際、前回そのパーティションを使用した
+     * フレームのフェンスが完了していれば先頭から使い直す。
+     */
+    class FrameLinearAllocator {
+    public:
+        static constexpr uint64_t InvalidOffset = UINT64_MAX;
+
+        FrameLinearAllocator() = default;
+        FrameLinearAllocator(uint64_t bytesPerFrame, uint32_t frameCount) { Reset(bytesPerFrame, frameCount); }
+
+        /**
+         * @brief パーティションサイズと数を設定し、全割り当てを破棄
+         */
+        void Reset(uint64_t bytesPerFrame, uint32_t frameCount);
+
+        /**
+         * @brief 次のパーティションが再利用可能か（前回使用したフレームのフェンスが完了しているか）
+         */
+        bool CanBeginFrame(uint64_t completedFenceValue) const;
+
+        /**
+         * @brief 次のパーティションに切り替えて先頭から使い直す
+         * @param completedFenceValue GPUが完了したフェンス値
+         *
+         * パーティションがまだGPUで使用中の場合は例外をスロー。
+         */
+        void BeginFrame(uint64_t completedFenceValue);
+
+        /**
+         * @brief 現在のパーティションをフェンス値に紐付ける（コマンドリスト送信後に呼び出す）
+         */
+        void EndFrame(uint64_t fenceValue);
+
+        /**
+         * @brief 現在のパーティションから領域を割り当て
+         * @param size サイズ（バイト）
+         * @param alignment アライメント（2の累乗）
+         * @return 全体の先頭からのオフセット（パーティションに収まらない場合は InvalidOffset）
+         */
+        uint64_t Allocate(uint64_t size, uint64_t alignment);
+
+        uint64_t GetCapacity() const { return bytesPerFrame * partitionFences.size(); }
+        uint64_t GetBytesPerFrame() const { return bytesPerFrame; }
+        uint32_t GetFrameCount() const { return static_cast<uint32_t>(partitionFences.size()); }
+        uint32_t GetCurrentPartition() const { return currentPartition; }
+        uint64_t GetUsedSize() const { return usedSize; }
+        uint64_t GetPeakUsedSize() const { return peakUsedSize; }
+
+    private:
+        uint64_t bytesPerFrame = 0;
+        std::vector<uint64_t> partitionFences;     // パーティションを最後に使用したフレームのフェンス値
+        uint32_t currentPartition = 0;
+        uint64_t usedSize = 0;                     // 現在のパーティションで割り当て済みのサイズ
+        uint64_t peakUsedSize = 0;
+    };
+
+} // namespace Athena
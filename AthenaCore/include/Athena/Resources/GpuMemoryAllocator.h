@@ -0,0 +1,179 @@
+#pragma once
+
+#include "TlsfAllocator.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief ヒープに配置するリソースの種別
+     *
+     * リソースヒープTier1ではバッファ・テクスチャ・RT/DSテクスチャを同じヒープに置けないため、
+     * 種別ごとに別のプールを使用する。
+     */
+    enum class GpuResourceCategory : uint8_t {
+        Buffer,
+        Texture,
+        RenderTargetDepth
+    };
+
+    /**
+     * @brief ID3D12Heap 1つ分のメモリブロック
+     *
+     * TlsfAllocator でヒープ内のオフセットを管理する。
+     * 割り当て側が shared_ptr で参照を保持するため、アロケータより長く生存してよい。
+     */
+    class GpuMemoryBlock {
+    public:
+        GpuMemoryBlock(ComPtr<ID3D12Heap> heap, uint64_t size);
+
+        TlsfAllocator::Allocation Allocate(uint64_t size, uint64_t alignment);
+        void Free(const TlsfAllocator::Allocation& allocation);
+
+        TlsfAllocator::Stats GetStats() const;
+        bool IsEmpty() const;
+        ID3D12Heap* GetHeap() const { return heap.Get(); }
+
+    private:
+        ComPtr<ID3D12Heap> heap;
+        TlsfAllocator allocator;
+        mutable std::mutex mutex;
+    };
+
+    /**
+     * @brief GpuMemoryAllocator で作成したリソース
+     *
+     * 破棄時（または Release() 時）にリソースを解放してからヒープの領域を返却する。
+     * GPUがリソースを使用し終えていることは呼び出し側で保証すること。
+     */
+    class GpuAllocation {
+    public:
+        GpuAllocation() = default;
+        ~GpuAllocation();
+
+        GpuAllocation(GpuAllocation&& other) noexcept;
+        GpuAllocation& operator=(GpuAllocation&& other) noexcept;
+        GpuAllocation(const GpuAllocation&) = delete;
+        GpuAllocation& operator=(const GpuAllocation&) = delete;
+
+        /**
+         * @brief リソースを解放し、ヒープの領域を返却
+         */
+        void Release();
+
+        ID3D12Resource* GetResource() const { return resource.Get(); }
+        bool IsValid() const { return resource != nullptr; }
+        bool IsPlaced() const { return block != nullptr; }
+        uint64_t GetOffset() const { return range.offset; }
+        uint64_t GetSize() const { return range.size; }
+
+    private:
+        friend class GpuMemoryAllocator;
+
+        ComPtr<ID3D12Resource> resource;
+        std::shared_ptr<GpuMemoryBlock> block;     // nullptr の場合はコミット済みリソース
+        TlsfAllocator::Allocation range;
+    };
+
+    /**
+     * @brief プールごとの使用状況
+     */
+    struct GpuMemoryPoolStats {
+        D3D12_HEAP_TYPE heapType = D3D12_HEAP_TYPE_DEFAULT;
+        GpuResourceCategory category = GpuResourceCategory::Buffer;
+        uint64_t alignment = 0;                    // アライメントクラス
+        uint32_t blockCount = 0;
+        TlsfAllocator::Stats usage;                // 全ブロックの合計（largestFreeBlock はブロック内の最大値）
+    };
+
+    /**
+     * @brief 配置リソース（Placed Resource）用のGPUメモリアロケータ
+     *
+     * 大きな ID3D12Heap ブロックを確保し、CreatePlacedResource でリソースを切り出す。
+     * コミット済みリソースごとの暗黙ヒープ作成を避け、作成・破棄のコストを下げる。
+     *
+     * プールはヒープタイプ・リソース種別・アライメントクラス
+     * （4KB の小さなテクスチャ / 64KB / 4MB のMSAA）の組み合わせごとに分ける。
+     * ブロックサイズの半分を超えるリソースはコミット済みリソースで作成する。
+     *
+     * 配置した RT/DS テクスチャは最初の使用前に Clear / Discard / Copy で初期化すること。
+     */
+    class GpuMemoryAllocator {
+    public:
+        static constexpr uint64_t DefaultBlockSize = 64ull * 1024 * 1024;
+
+        GpuMemoryAllocator() = default;
+        ~GpuMemoryAllocator();
+
+        GpuMemoryAllocator(const GpuMemoryAllocator&) = delete;
+        GpuMemoryAllocator& operator=(const GpuMemoryAllocator&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param blockSize ヒープブロックのサイズ（4MBの倍数に切り上げ）
+         */
+        void Initialize(ID3D12Device* device, uint64_t blockSize = DefaultBlockSize);
+
+        /**
+         * @brief 終了処理
+         *
+         * プールの参照を手放す。残っている割り当てのブロックは、その割り当てが解放されるまで維持される。
+         */
+        void Shutdown();
+
+        /**
+         * @brief リソースを作成
+         * @param desc リソース記述（Alignment は無視される）
+         * @param heapType ヒープタイプ
+         * @param initialState 初期状態
+         * @param clearValue 最適化クリア値（RT/DSのみ）
+         */
+        GpuAllocation CreateResource(
+            const D3D12_RESOURCE_DESC& desc,
+            D3D12_HEAP_TYPE heapType,
+            D3D12_RESOURCE_STATES initialState,
+            const D3D12_CLEAR_VALUE* clearValue = nullptr
+        );
+
+        /**
+         * @brief 空になったブロックを解放（各プールの先頭ブロックは残す）
+         * @return 解放したブロック数
+         */
+        uint32_t TrimEmptyBlocks();
+
+        std::vector<GpuMemoryPoolStats> GetStats() const;
+        void LogStats() const;
+
+        uint64_t GetBlockSize() const { return blockSize; }
+        uint64_t GetCommittedFallbackCount() const { return committedFallbackCount; }
+
+    private:
+        struct Pool {
+            D3D12_HEAP_TYPE heapType;
+            GpuResourceCategory category;
+            uint64_t alignment;
+            std::vector<std::shared_ptr<GpuMemoryBlock>> blocks;
+        };
+
+        static GpuResourceCategory GetCategory(const D3D12_RESOURCE_DESC& desc);
+        Pool& GetPool(D3D12_HEAP_TYPE heapType, GpuResourceCategory category, uint64_t alignment);
+        std::shared_ptr<GpuMemoryBlock> CreateBlock(const Pool& pool);
+        GpuAllocation CreateCommitted(const D3D12_RESOURCE_DESC& desc, D3D12_HEAP_TYPE heapType,
+                                      D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue);
+
+        ComPtr<ID3D12Device> device;
+        uint64_t blockSize = DefaultBlockSize;
+        std::vector<Pool> pools;
+        uint64_t committedFallbackCount = 0;
+        mutable std::mutex mutex;
+    };
+
+} // namespace Athena
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief 予算管理上のリソース分類
+     */
+    enum class BudgetCategory : uint32_t {
+        Buffer,
+        Texture,
+        RenderTarget,       // レンダーターゲット・深度（退避しない）
+        Count
+    };
+
+    /**
+     * @brief OSから取得したビデオメモリの予算
+     */
+    struct MemoryBudgetInfo {
+        uint64_t budget = 0;                       // アプリケーションが使用してよい量
+        uint64_t currentUsage = 0;                 // 現在の使用量
+    };
+
+    /**
+     * @brief 予算の取得元（Windowsでは QueryVideoMemoryInfo、テストでは固定値）
+     */
+    class IMemoryBudgetSource {
+    public:
+        virtual ~IMemoryBudgetSource() = default;
+        virtual MemoryBudgetInfo QueryBudget() = 0;
+    };
+
+    /**
+     * @brief リソースの退避・復帰を行う実装（D3D12では Evict / MakeResident）
+     */
+    class IResidencyBackend {
+    public:
+        virtual ~IResidencyBackend() = default;
+
+        /**
+         * @brief リソースを退避（失敗した場合は false）
+         */
+        virtual bool Evict(void* object) = 0;
+
+        /**
+         * @brief 退避したリソースを使用可能にする（戻るまで待機する）
+         */
+        virtual bool MakeResident(void* object) = 0;
+    };
+
+    /**
+     * @brief テスト・シミュレーション用の予算（値を直接設定する）
+     */
+    class FakeMemoryBudgetSource : public IMemoryBudgetSource {
+    public:
+        FakeMemoryBudgetSource(uint64_t budget = 0, uint64_t usage = 0) { info.budget = budget; info.currentUsage = usage; }
+
+        MemoryBudgetInfo QueryBudget() override { return info; }
+
+        void SetBudget(uint64_t budget) { info.budget = budget; }
+        void SetUsage(uint64_t usage) { info.currentUsage = usage; }
+
+    private:
+        MemoryBudgetInfo info;
+    };
+
+    /**
+     * @brief 退避の設定
+     */
+    struct MemoryBudgetSettings {
+        float evictThreshold = 0.9f;               // 退避を開始する使用率
+        float targetRatio = 0.8f;                  // 退避後の目標使用率
+        uint32_t minIdleFrames = 8;                // 退避の対象になるまでの未使用フレーム数
+    };
+
+    /**
+     * @brief GPUメモリ予算の管理（使用状況の追跡と退避）
+     *
+     * 予算の取得と退避の実行は IMemoryBudgetSource / IResidencyBackend に任せる。
+     * Buffer / Texture の割り当てを分類・サイズ・最終使用フレームとともに登録し、
+     * Update() で予算を取得する。使用量が予算の evictThreshold を超えた場合、
+     * 使われていない期間が長いものから退避し、targetRatio まで下げる。
+     * 退避したリソースは MarkUsed() の時点で復帰する。
+     *
+     * MarkUsed() を一度も呼ばれていないリソースは使用状況が分からないため、
+     * 集計のみ行い退避の対象にしない。minIdleFrames は処理中のフレーム数より
+     * 大きくすること（GPUが参照中のリソースを退避しないため）。スレッドセーフ。
+     */
+    class MemoryBudgetManager {
+    public:
+        static constexpr uint32_t InvalidId = UINT32_MAX;
+
+        using Settings = MemoryBudgetSettings;
+
+        struct CategoryStats {
+            uint64_t totalSize = 0;
+            uint64_t residentSize = 0;
+            uint32_t count = 0;
+            uint32_t evictedCount = 0;
+        };
+
+        struct Stats {
+            MemoryBudgetInfo budget;               // 最後に取得した予算
+            std::array<CategoryStats, static_cast<size_t>(BudgetCategory::Count)> categories{};
+            uint64_t totalEvictions = 0;
+            uint64_t totalRestores = 0;
+        };
+
+        MemoryBudgetManager() = default;
+
+        MemoryBudgetManager(const MemoryBudgetManager&) = delete;
+        MemoryBudgetManager& operator=(const MemoryBudgetManager&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param source 予算の取得元
+         * @param backend 退避・復帰の実装
+         */
+        void Initialize(IMemoryBudgetSource* source, IResidencyBackend* backend, const Settings& settings = Settings());
+
+        /**
+         * @brief 使用量削減時に呼び出す処理を設定（空きブロックの解放など）
+         */
+        void SetTrimCallback(std::function<void()> callback);
+
+        /**
+         * @brief リソースを登録
+         * @param object 退避・復帰時にバックエンドへ渡すオブジェクト
+         * @param evictable 個別に退避できるか（ヒープ内に配置したリソースは false）
+         * @return 登録ID
+         */
+        uint32_t Register(void* object, BudgetCategory category, uint64_t size, bool evictable);
+
+        void Unregister(uint32_t id);
+
+        /**
+         * @brief 現在のフレームで使用したことを記録（退避中なら復帰）
+         */
+        void MarkUsed(uint32_t id);
+
+        /**
+         * @brief フレームを進めて予算を確認し、必要なら退避
+         * @return このフレームで退避したリソース数
+         */
+        uint32_t Update(uint64_t frameIndex);
+
+        bool IsResident(uint32_t id) const;
+        Stats GetStats() const;
+        void LogStats() const;
+
+        /**
+         * @brief Buffer / Texture が登録に使用するマネージャーを設定（nullptr で解除）
+         */
+        static void SetGlobal(MemoryBudgetManager* manager) { globalManager.store(manager, std::memory_order_release); }
+        static MemoryBudgetManager* GetGlobal() { return globalManager.load(std::memory_order_acquire); }
+
+    private:
+        struct Entry {
+            void* object = nullptr;
+            uint64_t size = 0;
+            uint64_t lastUsedFrame = 0;
+            BudgetCategory category = BudgetCategory::Buffer;
+            bool inUse = false;                    // 登録中か
+            bool evictable = false;
+            bool usageTracked = false;             // MarkUsed() が呼ばれたか
+            bool resident = true;
+        };
+
+        IMemoryBudgetSource* source = nullptr;
+        IResidencyBackend* backend = nullptr;
+        Settings settings;
+        std::function<void()> trimCallback;
+
+        mutable std::mutex mutex;
+        std::vector<Entry> entries;
+        std::vector<uint32_t> freeIds;
+        uint64_t currentFrame = 0;
+        MemoryBudgetInfo lastBudget;
+        uint64_t totalEvictions = 0;
+        uint64_t totalRestores = 0;
+
+        static inline std::atomic<MemoryBudgetManager*> globalManager{ nullptr };
+    };
+
+} // namespace Athena
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief パイプライン記述のコピー
+     *
+     * シェーダーのバイトコード、入力レイアウト（セマンティクス名を含む）、ストリーム出力の
+     * 参照先も保持するため、呼び出し元のデータが解放された後もワーカースレッドで使用できる。
+     * 内部を指すポインタを持つためコピー・ムーブは不可。
+     */
+    class GraphicsPipelineDescStorage {
+    public:
+        GraphicsPipelineDescStorage() = default;
+        explicit GraphicsPipelineDescStorage(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) { Assign(desc); }
+
+        GraphicsPipelineDescStorage(const GraphicsPipelineDescStorage&) = delete;
+        GraphicsPipelineDescStorage& operator=(const GraphicsPipelineDescStorage&) = delete;
+
+        /**
+         * @brief 記述をコピー（CachedPSO は破棄、ルートシグネチャはポインタのみ）
+         */
+        void Assign(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+        void SetRootSignature(ID3D12RootSignature* rootSignature) { desc.pRootSignature = rootSignature; }
+
+        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Get() const { return desc; }
+
+        /**
+         * @brief バイト列に書き出す（ルートシグネチャは含まない）
+         */
+        void Serialize(std::vector<char>& output) const;
+
+        /**
+         * @brief Serialize の出力から復元（cursor は読んだ分だけ進む）
+         * @return データが不正な場合は false
+         */
+        bool Deserialize(const char*& cursor, const char* end);
+
+    private:
+        void FixupPointers();
+
+        D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
+        std::vector<uint8_t> shaders[5];                   // VS, PS, DS, HS, GS
+        std::vector<D3D12_INPUT_ELEMENT_DESC> inputElements;
+        std::vector<std::string> inputSemantics;
+        std::vector<D3D12_SO_DECLARATION_ENTRY> streamOutputEntries;
+        std::vector<std::string> streamOutputSemantics;
+        std::vector<UINT> streamOutputStrides;
+    };
+
+    enum class PipelineStatus : uint32_t {
+        Pending,
+        Ready,
+        Failed,
+    };
+
+    /**
+     * @brief 非同期に作成される PSO の要求
+     *
+     * 作成完了までは Get() が nullptr を返すので、パスは描画を省略するか代替の PSO を使う。
+     */
+    class PipelineRequest {
+    public:
+        PipelineStatus GetStatus() const { return status.load(std::memory_order_acquire); }
+        bool IsReady() const { return GetStatus() == PipelineStatus::Ready; }
+        bool IsFailed() const { return GetStatus() == PipelineStatus::Failed; }
+
+        /**
+         * @brief 作成済みの PSO（未完了・失敗時は nullptr）
+         */
+        ID3D12PipelineState* Get() const { return IsReady() ? pipelineState.Get() : nullptr; }
+
+        /**
+         * @brief 完了（成功・失敗）まで待機
+         */
+        void Wait() const;
+
+        uint64_t GetHash() const { return hash; }
+
+    private:
+        friend class PipelineCache;
+
+        void Finish(PipelineStatus result);
+
+        GraphicsPipelineDescStorage desc;
+        ComPtr<ID3D12RootSignature> rootSignature;         // キーのポインタが再利用されないよう参照を保持
+        ComPtr<ID3D12PipelineState> pipelineState;
+        uint64_t hash = 0;                                 // ComputeHash の値
+        uint64_t libraryKey = 0;                           // ライブラリ内の名前（登録済みルートシグネチャを含む）
+        uint64_t rootSignatureHash = 0;                    // 未登録の場合は0
+        bool prewarmed = false;
+        std::atomic<PipelineStatus> status{ PipelineStatus::Pending };
+    };
+
+    using PipelineHandle = std::shared_ptr<PipelineRequest>;
+
+    /**
+     * @brief パイプライン状態オブジェクト（PSO）のキャッシュ
+     *
+     * D3D12_GRAPHICS_PIPELINE_STATE_DESC の内容（シェーダーのバイトコード、入力レイアウト、
+     * フォーマット、各ステート）からハッシュを計算し、同じ記述の PSO を使い回す。
+     * ルートシグネチャは RegisterRootSignature でシリアライズ済みのデータを登録すると
+     * その内容で、未登録の場合はポインタで区別する。
+     *
+     * ID3D12PipelineLibrary をディスクに保存し、次回起動時はドライバーのコンパイルを省略する。
+     * ドライバー・GPU が変わってライブラリを読めない場合は空のライブラリから作り直す。
+     *
+     * RequestGraphicsPipeline はワーカースレッドで PSO を作成し、すぐにハンドルを返す。
+     * 登録済みのルートシグネチャを使う PSO は終了時にプリウォーム用のリストへ記録され、
+     * 次回起動時に Prewarm() でバックグラウンド作成される。スレッドセーフ。
+     */
+    class PipelineCache {
+    public:
+        struct Settings {
+            std::filesystem::path libraryPath = L"PipelineLibrary.bin";
+            std::filesystem::path prewarmPath = L"PipelinePrewarm.bin";
+            bool useLibrary = true;
+            uint32_t workerThreadCount = 2;                // 0 の場合は要求したスレッドで作成
+        };
+
+        struct Stats {
+            uint64_t memoryHits = 0;
+            uint64_t libraryHits = 0;
+            uint64_t creates = 0;
+            uint64_t failures = 0;
+            uint64_t prewarmed = 0;
+        };
+
+        PipelineCache() = default;
+        ~PipelineCache();
+
+        PipelineCache(const PipelineCache&) = delete;
+        PipelineCache& operator=(const PipelineCache&) = delete;
+
+        /**
+         * @brief 初期化（ディスクからパイプラインライブラリを読み込み、ワーカーを起動）
+         */
+        void Initialize(ID3D12Device1* device, const Settings& settings);
+
+        /**
+         * @brief ワーカーを停止し、ライブラリ・プリウォームリストを保存して解放
+         *
+         * 作成待ちの要求は失敗として完了する。
+         */
+        void Shutdown();
+
+        /**
+         * @brief 新しく作成した PSO があればライブラリとプリウォームリストをディスクに保存
+         */
+        void Save();
+
+        /**
+         * @brief 前回の実行で記録した PSO の作成をバックグラウンドで開始
+         * @return 要求した数
+         */
+        uint32_t Prewarm();
+
+        /**
+         * @brief ルートシグネチャのシリアライズ済みデータを登録
+         *
+         * 登録するとキャッシュのキーが実行ごとに変わらなくなり、プリウォームの対象になる。
+         */
+        void RegisterRootSignature(ID3D12RootSignature* rootSignature, const void* serialized, size_t size);
+
+        /**
+         * @brief PSO の作成を要求（キャッシュになければワーカースレッドで作成）
+         *
+         * 記述はコピーされるため、呼び出し後にシェーダーなどを解放してよい。
+         */
+        PipelineHandle RequestGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+        /**
+         * @brief PSO を取得（キャッシュになければ呼び出したスレッドで作成）
+         *
+         * 作成に失敗した場合は例外をスロー。
+         */
+        ComPtr<ID3D12PipelineState> GetGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+        /**
+         * @brief パイプライン記述のハッシュ（ルートシグネチャ・CachedPSO を除く）
+         *
+         * シェーダーはポインタではなくバイトコードの内容、入力レイアウトはセマンティクス名の文字列で比較する。
+         * NumRenderTargets を超える RTVFormats は無視する。
+         */
+        static uint64_t ComputeHash(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+        /**
+         * @brief ライブラリ内の名前（ハッシュの16進表記）
+         */
+        static std::wstring MakePipelineName(uint64_t hash);
+
+        /**
+         * @brief 作成待ち・作成中の要求数
+         */
+        uint32_t GetPendingCount() const { return pendingCount.load(std::memory_order_relaxed); }
+
+        Stats GetStats() const;
+        void LogStats() const;
+
+        /**
+         * @brief パスが使用するキャッシュを設定（nullptr で解除）
+         */
+        static void SetGlobal(PipelineCache* cache) { globalCache.store(cache, std::memory_order_release); }
+        static PipelineCache* GetGlobal() { return globalCache.load(std::memory_order_acquire); }
+
+        /**
+         * @brief グローバルのキャッシュから取得（未設定の場合はキャッシュせずに作成）
+         */
+        static ComPtr<ID3D12PipelineState> LoadGraphicsPipeline(ID3D12Device* device,
+                                                                const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+        /**
+         * @brief グローバルのキャッシュに非同期で要求（未設定の場合はその場で作成した完了済みのハンドル）
+         */
+        static PipelineHandle LoadGraphicsPipelineAsync(ID3D12Device* device,
+                                                        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+
+    private:
+        struct RootSignatureInfo {
+            ComPtr<ID3D12RootSignature> rootSignature;
+            uint64_t hash = 0;
+            std::vector<char> serialized;
+        };
+
+        using Key = std::pair<uint64_t, uint64_t>;     // (記述のハッシュ, ルートシグネチャ)
+
+        PipelineHandle FindOrAddRequest(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, bool prewarm, bool& created);
+        void Enqueue(const PipelineHandle& request);
+        void Build(PipelineRequest& request);
+        void WorkerLoop();
+        void StopWorkers();
+        void CreateLibrary();
+        void SavePrewarmList();
+
+        ComPtr<ID3D12Device1> device;
+        Settings settings;
+
+        mutable std::mutex mutex;
+        std::map<Key, PipelineHandle> requests;
+        std::unordered_map<ID3D12RootSignature*, RootSignatureInfo> rootSignatures;
+        Stats stats;
+        bool prewarmDirty = false;
+
+        // ワーカースレッド
+        std::vector<std::thread> workers;
+        std::deque<PipelineHandle> jobs;
+        std::condition_variable jobAvailable;
+        bool stopping = false;
+        std::atomic<uint32_t> pendingCount{ 0 };
+
+        std::mutex libraryMutex;
+        ComPtr<ID3D12PipelineLibrary> library;
+        std::vector<char> libraryData;             // ライブラリが参照するため解放まで保持
+        bool libraryDirty = false;
+
+        static inline std::atomic<PipelineCache*> globalCache{ nullptr };
+    };
+
+} // namespace Athena
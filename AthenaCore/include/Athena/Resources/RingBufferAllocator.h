@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+namespace Athena {
+
+    /**
+     * @brief フェンスで管理するリングバッファのオフセット割り当て
+     *
+     * オフセットを返すだけで、バッファのマップや書き込みは UploadRingBuffer が行う。
+     * 割り当てはヘッドから進み、FinishBatch() でそれまでの割り当てをフェンス値に紐付ける。
+     * ReleaseCompleted() にGPUが完了したフェンス値を渡すと、テールが進み領域が再利用可能になる。
+     *
+     * 末尾に収まらない割り当ては先頭へ折り返し、残りの領域は捨てる（折り返しの無駄も使用量に含める）。
+     */
+    class RingBufferAllocator {
+    public:
+        static constexpr uint64_t InvalidOffset = UINT64_MAX;
+
+        RingBufferAllocator() = default;
+        explicit RingBufferAllocator(uint64_t capacity) { Reset(capacity); }
+
+        /**
+         * @brief 容量を設定し、全割り当てを破棄
+         */
+        void Reset(uint64_t capacity);
+
+        /**
+         * @brief 領域を割り当て
+         * @param size サイズ（バイト）
+         * @param alignment アライメント（2の累乗）
+         * @return バッファ先頭からのオフセット（空きがない場合は InvalidOffset）
+         */
+        uint64_t Allocate(uint64_t size, uint64_t alignment);
+
+        /**
+         * @brief 前回の FinishBatch() 以降の割り当てをフェンス値に紐付ける
+         */
+        void FinishBatch(uint64_t fenceValue);
+
+        /**
+         * @brief 完了したバッチの領域を解放
+         * @param completedFenceValue GPUが完了したフェンス値
+         */
+        void ReleaseCompleted(uint64_t completedFenceValue);
+
+        /**
+         * @brief 最も古い未完了バッチのフェンス値（なければ0）
+         */
+        uint64_t GetOldestPendingFence() const { return batches.empty() ? 0 : batches.front().fenceValue; }
+
+        bool HasPendingBatches() const { return !batches.empty(); }
+        uint64_t GetCapacity() const { return capacity; }
+        uint64_t GetUsedSize() const { return head - tail; }
+        uint64_t GetFreeSize() const { return capacity - GetUsedSize(); }
+
+    private:
+        struct Batch {
+            uint64_t fenceValue;
+            uint64_t headPosition;                 // バッチ終了時のヘッド位置
+        };
+
+        uint64_t capacity = 0;
+        uint64_t head = 0;                         // 累積位置（割り当て済みの末尾）
+        uint64_t tail = 0;                         // 累積位置（GPU使用中の先頭）
+        uint64_t batchStart = 0;                   // 未確定バッチの開始位置
+        std::deque<Batch> batches;
+    };
+
+} // namespace Athena
\ No newline at end of file
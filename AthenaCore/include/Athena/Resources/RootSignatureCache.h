@@ -0,0 +1,99 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief ルートシグネチャのレジストリ
+     *
+     * D3D12_ROOT_SIGNATURE_DESC の内容（パラメータ、デスクリプタ範囲、静的サンプラー、フラグ）から
+     * ハッシュを計算し、同じレイアウトのルートシグネチャを1つにまとめる。
+     * 作成したルートシグネチャはシリアライズ済みのデータとともに PipelineCache に登録する。
+     *
+     * ラスターパスは GetGlobalRootSignature() の共通ルートシグネチャを使うため、
+     * パス間でルートシグネチャが切り替わらない。スレッドセーフ。
+     */
+    class RootSignatureCache {
+    public:
+        /**
+         * @brief 共通ルートシグネチャのパラメータ
+         *
+         * Constants      : ルート CBV（b0、全ステージ）
+         * Textures       : SRV テーブル（t0 - t2、ピクセルシェーダー）
+         * BindlessTextures: サイズ無制限の SRV テーブル（t0, space1、ピクセルシェーダー）
+         *
+         * 静的サンプラー: s0 リニア・ラップ、s1 ポイント・クランプ、s2 リニア・クランプ
+         */
+        enum GlobalParameter : UINT {
+            Constants = 0,
+            Textures = 1,
+            BindlessTextures = 2,
+            GlobalParameterCount
+        };
+
+        static constexpr UINT GlobalTextureCount = 3;
+
+        struct Stats {
+            uint64_t hits = 0;
+            uint64_t creates = 0;
+        };
+
+        RootSignatureCache() = default;
+
+        RootSignatureCache(const RootSignatureCache&) = delete;
+        RootSignatureCache& operator=(const RootSignatureCache&) = delete;
+
+        void Initialize(ID3D12Device* device);
+        void Shutdown();
+
+        /**
+         * @brief ルートシグネチャを取得（なければシリアライズして作成、失敗した場合は例外をスロー）
+         */
+        ComPtr<ID3D12RootSignature> GetRootSignature(const D3D12_ROOT_SIGNATURE_DESC& desc);
+
+        /**
+         * @brief 全ラスターパス共通のルートシグネチャ
+         */
+        ComPtr<ID3D12RootSignature> GetGlobalRootSignature();
+
+        /**
+         * @brief レイアウトのハッシュ（デスクリプタ範囲・静的サンプラーはポインタではなく内容）
+         */
+        static uint64_t ComputeHash(const D3D12_ROOT_SIGNATURE_DESC& desc);
+
+        Stats GetStats() const;
+        void LogStats() const;
+
+        /**
+         * @brief パスが使用するレジストリを設定（nullptr で解除）
+         */
+        static void SetGlobal(RootSignatureCache* cache) { globalCache.store(cache, std::memory_order_release); }
+        static RootSignatureCache* GetGlobal() { return globalCache.load(std::memory_order_acquire); }
+
+        /**
+         * @brief グローバルのレジストリから取得（未設定の場合はキャッシュせずに作成）
+         */
+        static ComPtr<ID3D12RootSignature> LoadRootSignature(ID3D12Device* device, const D3D12_ROOT_SIGNATURE_DESC& desc);
+        static ComPtr<ID3D12RootSignature> LoadGlobalRootSignature(ID3D12Device* device);
+
+    private:
+        static ComPtr<ID3D12RootSignature> Create(ID3D12Device* device, const D3D12_ROOT_SIGNATURE_DESC& desc);
+
+        ComPtr<ID3D12Device> device;
+
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, ComPtr<ID3D12RootSignature>> rootSignatures;
+        Stats stats;
+
+        static inline std::atomic<RootSignatureCache*> globalCache{ nullptr };
+    };
+
+} // namespace Athena
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <d3d12.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief シェーダーバリアントのキー（宣言したキーワードの i 番目がビット i）
+     */
+    using ShaderPermutationKey = uint32_t;
+
+    /**
+     * @brief 事前コンパイル済みシェーダーのアーカイブ（読み込み側）
+     *
+     * ファイルをメモリマップし、(パーミュテーションセットID, キー) でソートされた目次を二分探索する。
+     * 返すバイトコードはマップした領域を直接指すため、Close() まで有効。
+     *
+     * ファイル構成: Header, SetRecord[setCount], EntryRecord[entryCount], バイトコード（16バイト境界）
+     */
+    class ShaderArchive {
+    public:
+        static constexpr uint32_t Magic = 0x41505341;      // "ASPA"
+        static constexpr uint32_t Version = 1;
+
+        struct Header {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t setCount;
+            uint32_t entryCount;
+        };
+
+        struct SetRecord {
+            uint64_t setId;
+            uint64_t sourceHash;                           // 作成時のソース（#include を含む）のハッシュ
+        };
+
+        struct EntryRecord {
+            uint64_t setId;
+            ShaderPermutationKey key;
+            uint32_t reserved;
+            uint64_t offset;                               // ファイル先頭からの位置
+            uint64_t size;
+        };
+
+        ShaderArchive() = default;
+        ~ShaderArchive() { Close(); }
+
+        ShaderArchive(const ShaderArchive&) = delete;
+        ShaderArchive& operator=(const ShaderArchive&) = delete;
+
+        /**
+         * @brief ファイルをメモリマップして開く
+         * @return ファイルがない・形式が不正な場合は false
+         */
+        bool Open(const std::filesystem::path& path);
+
+        /**
+         * @brief メモリ上のアーカイブを開く（data は Close() まで呼び出し元が保持）
+         */
+        bool OpenMemory(const void* data, size_t size);
+
+        void Close();
+        bool IsOpen() const { return data != nullptr; }
+
+        /**
+         * @brief バイトコードを検索（見つからない場合は空）
+         */
+        D3D12_SHADER_BYTECODE Find(uint64_t setId, ShaderPermutationKey key) const;
+
+        /**
+         * @brief セット作成時のソースのハッシュを取得
+         */
+        bool FindSourceHash(uint64_t setId, uint64_t& sourceHash) const;
+
+        uint32_t GetShaderCount() const { return entryCount; }
+
+        /**
+         * @brief パスが使用するアーカイブを設定（nullptr で解除）
+         */
+        static void SetGlobal(ShaderArchive* archive) { globalArchive.store(archive, std::memory_order_release); }
+        static ShaderArchive* GetGlobal() { return globalArchive.load(std::memory_order_acquire); }
+
+    private:
+        bool Parse(const void* data, size_t size);
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        const SetRecord* sets = nullptr;
+        uint32_t setCount = 0;
+        const EntryRecord* entries = nullptr;
+        uint32_t entryCount = 0;
+
+        // メモリマップ（HANDLE）
+        void* file = nullptr;
+        void* mapping = nullptr;
+
+        static inline std::atomic<ShaderArchive*> globalArchive{ nullptr };
+    };
+
+    /**
+     * @brief アーカイブの作成（オフラインでの事前コンパイル用）
+     */
+    class ShaderArchiveWriter {
+    public:
+        void AddSet(uint64_t setId, uint64_t sourceHash);
+        void AddShader(uint64_t setId, ShaderPermutationKey key, const void* bytecode, size_t size);
+
+        /**
+         * @brief ファイルの内容を作成（目次はソート済み）
+         */
+        std::vector<char> Build() const;
+
+        /**
+         * @brief ファイルに書き出す（一時ファイルに書いてから置き換える）
+         */
+        bool Write(const std::filesystem::path& path) const;
+
+        size_t GetShaderCount() const { return shaders.size(); }
+
+    private:
+        struct Shader {
+            uint64_t setId;
+            ShaderPermutationKey key;
+            std::vector<char> bytecode;
+        };
+
+        std::vector<ShaderArchive::SetRecord> sets;
+        std::vector<Shader> shaders;
+    };
+
+} // namespace Athena
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief シェーダーのマクロ定義
+     */
+    struct ShaderDefine {
+        std::string name;
+        std::string value = "1";
+    };
+
+    /**
+     * @brief コンパイルするシェーダーの指定
+     */
+    struct ShaderDesc {
+        std::wstring filepath;
+        std::string entryPoint = "main";
+        std::string target;                        // vs_5_1, ps_5_1 など
+        std::vector<ShaderDefine> defines;
+    };
+
+    /**
+     * @brief シェーダーバイトコードのキャッシュ（メモリ・ディスク）
+     *
+     * ソースと #include で参照するファイルの内容、エントリポイント、ターゲット、
+     * マクロ定義、コンパイルフラグからハッシュを計算し、メモリ → ディスクの順に
+     * コンパイル済みのバイトコードを探す。どちらにもない場合のみコンパイルし、両方に保存する。
+     * ファイルの内容をキーにするため、シェーダーを編集すれば自動的に再コンパイルされる。
+     * ファイルごとのハッシュは更新時刻が変わるまで再利用し、毎回ディスクから読み直さない。
+     *
+     * 既定では最適化してコンパイルする（debugShaders でデバッグ情報付き・最適化なし）。
+     * スレッドセーフ（コンパイル自体はロックの外で行う）。
+     */
+    class ShaderCache {
+    public:
+        struct Settings {
+            std::filesystem::path cacheDirectory = L"ShaderCache";
+            bool debugShaders = false;             // D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION
+            bool useDiskCache = true;
+        };
+
+        struct Stats {
+            uint64_t memoryHits = 0;
+            uint64_t diskHits = 0;
+            uint64_t compiles = 0;
+        };
+
+        ShaderCache() = default;
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        /**
+         * @brief 初期化（キャッシュディレクトリを作成）
+         */
+        void Initialize(const Settings& settings);
+
+        /**
+         * @brief メモリ上のキャッシュを破棄（ディスクのキャッシュは残る）
+         */
+        void Clear();
+
+        /**
+         * @brief ソースファイルのハッシュを破棄し、次の取得時に読み直す
+         *
+         * 更新時刻が変わらない書き換え（バージョン管理での差し戻しなど）を反映する場合に呼び出す。
+         */
+        void ReloadSources();
+
+        /**
+         * @brief バイトコードを取得（キャッシュになければコンパイル）
+         *
+         * コンパイルに失敗した場合は例外をスロー。
+         */
+        ComPtr<ID3DBlob> GetShader(const ShaderDesc& desc);
+
+        /**
+         * @brief キャッシュのキーを計算
+         *
+         * コメント内と #if 0 のブロック内の #include は辿らない。
+         * 見つからないファイルはパスだけをキーに含める（作成されればキーが変わる）。
+         */
+        uint64_t ComputeHash(const ShaderDesc& desc) const;
+
+        /**
+         * @brief ソースと #include で参照するファイルの内容のみのハッシュ（ソース自体が読めない場合は例外をスロー）
+         */
+        static uint64_t ComputeSourceHash(const std::filesystem::path& filepath);
+
+        Stats GetStats() const;
+        void LogStats() const;
+
+        /**
+         * @brief パスが使用するキャッシュを設定（nullptr で解除）
+         */
+        static void SetGlobal(ShaderCache* cache) { globalCache.store(cache, std::memory_order_release); }
+        static ShaderCache* GetGlobal() { return globalCache.load(std::memory_order_acquire); }
+
+        /**
+         * @brief グローバルのキャッシュから取得（未設定の場合はキャッシュせずにコンパイル）
+         */
+        static ComPtr<ID3DBlob> LoadShader(const std::wstring& filepath, const std::string& entryPoint,
+                                           const std::string& target, const std::vector<ShaderDefine>& defines = {});
+
+    private:
+        /**
+         * @brief ソースファイル1つ分の内容のハッシュと、辿る #include の解決済みパス
+         */
+        struct SourceFile {
+            std::filesystem::file_time_type lastWriteTime;
+            uint64_t contentHash = 0;
+            std::vector<std::filesystem::path> includes;
+        };
+        using SourceFileMap = std::unordered_map<std::filesystem::path::string_type, SourceFile>;
+
+        /**
+         * @brief ファイルとその #include の内容をハッシュへ加える（files の更新時刻が同じファイルは読まない）
+         */
+        static void HashSourceTree(uint64_t& hash, const std::filesystem::path& root, SourceFileMap& files);
+
+        uint32_t GetCompileFlags() const;
+        std::filesystem::path GetCachePath(uint64_t hash) const;
+        ComPtr<ID3DBlob> LoadFromDisk(uint64_t hash) const;
+        void SaveToDisk(uint64_t hash, ID3DBlob* blob) const;
+
+        static ComPtr<ID3DBlob> Compile(const ShaderDesc& desc, uint32_t flags);
+
+        Settings settings;
+
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, ComPtr<ID3DBlob>> blobs;
+        Stats stats;
+
+        mutable std::mutex sourceMutex;
+        mutable SourceFileMap sourceFiles;     // 正規化したパス → ファイルのハッシュ
+
+        static inline std::atomic<ShaderCache*> globalCache{ nullptr };
+    };
+
+} // namespace Athena
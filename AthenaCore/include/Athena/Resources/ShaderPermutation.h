@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ShaderArchive.h"
+#include "ShaderCache.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief パーミュテーションセットの指定
+     */
+    struct ShaderPermutationDesc {
+        std::wstring filepath;
+        std::string entryPoint = "main";
+        std::string target;
+        std::vector<std::string> keywords;         // i 番目がキーのビット i
+    };
+
+    /**
+     * @brief 1つのシェーダーソースをキーワードの組み合わせでコンパイルしたバリアントの集合
+     *
+     * キーワードは必ず 0/1 で定義されるため、シェーダー側は #if KEYWORD で分岐する。
+     * バリアントはキーをインデックスとする表で管理し、Get() は表を引くだけで済む。
+     *
+     * アーカイブにこのセットが含まれ、作成時のソースのハッシュが現在のソースと一致する場合は
+     * アーカイブのバイトコードを使う（ソースがない配布環境ではハッシュを比較せずに使う）。
+     * アーカイブにないバリアントは初回の Get() で ShaderCache 経由でコンパイルする。
+     */
+    class ShaderPermutationSet {
+    public:
+        static constexpr uint32_t MaxKeywords = 8;
+
+        /**
+         * @brief 初期化（キーワードが多すぎる場合は例外をスロー）
+         */
+        void Initialize(const ShaderPermutationDesc& desc, const ShaderArchive* archive = nullptr);
+
+        bool IsInitialized() const { return !variants.empty(); }
+
+        /**
+         * @brief キーワードのビット（宣言していないキーワードの場合は例外をスロー）
+         */
+        ShaderPermutationKey GetKeywordMask(const std::string& keyword) const;
+
+        /**
+         * @brief バリアントのバイトコード（未作成の場合はコンパイル、失敗した場合は例外をスロー）
+         */
+        D3D12_SHADER_BYTECODE Get(ShaderPermutationKey key);
+
+        /**
+         * @brief 作成済みか（アーカイブから読んだ場合を含む）
+         */
+        bool IsLoaded(ShaderPermutationKey key) const;
+
+        /**
+         * @brief キーに対応するマクロ定義（全キーワードを 0/1 で定義）
+         */
+        std::vector<ShaderDefine> MakeDefines(ShaderPermutationKey key) const;
+
+        uint32_t GetPermutationCount() const { return static_cast<uint32_t>(variants.size()); }
+        uint64_t GetId() const { return id; }
+
+        /**
+         * @brief アーカイブ内でセットを識別するID（ソースのパス・エントリポイント・ターゲット・キーワードのハッシュ）
+         */
+        static uint64_t ComputeId(const ShaderPermutationDesc& desc);
+
+        /**
+         * @brief 全バリアントをコンパイルしてアーカイブに追加（オフラインの事前コンパイル用）
+         */
+        void CompileAll(ShaderArchiveWriter& writer);
+
+    private:
+        struct Variant {
+            ComPtr<ID3DBlob> blob;                 // コンパイルした場合のみ（アーカイブの場合はマップした領域を指す）
+            D3D12_SHADER_BYTECODE bytecode = {};
+        };
+
+        ShaderPermutationDesc desc;
+        uint64_t id = 0;
+        std::vector<Variant> variants;             // キーがインデックス
+    };
+
+} // namespace Athena
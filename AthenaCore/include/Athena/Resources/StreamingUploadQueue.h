@@ -0,0 +1,138 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    class UploadScheduler;
+
+    /**
+     * @brief ストリーミングアップロードの優先度（小さいほど先に処理）
+     */
+    enum class UploadPriority : uint32_t {
+        Visible,        // 現在表示中のもの
+        Prefetch,       // まもなく必要になるもの
+        Background,     // 余裕のあるときに読み込むもの
+        Count
+    };
+
+    /**
+     * @brief 1フレームで処理する量の上限
+     */
+    struct StreamingUploadSettings {
+        uint64_t bytesPerFrame = 8ull * 1024 * 1024;    // 1フレームでコピーする最大バイト数
+        double millisecondsPerFrame = 2.0;              // 1フレームで記録に使う最大時間
+        uint64_t chunkSize = 1ull * 1024 * 1024;        // バッファ分割の単位・テクスチャをまとめる目安
+    };
+
+    /**
+     * @brief 時間・容量の予算付きアップロードキュー（ストリーミング時のヒッチ防止）
+     *
+     * 実行中に読み込んだリソースを即座に全てアップロードせず、チャンクに分割して
+     * キューに積み、毎フレーム ProcessFrame() で予算内の分だけ UploadScheduler に記録する。
+     * バッファはバイト範囲、テクスチャはサブリソース（ミップ・配列要素）単位で分割する。
+     * 予算を超えるチャンクでも、1フレームに最低1つは処理する（進行を止めないため）。
+     *
+     * 要求の完了コールバックは、最後のチャンクを含むバッチの完了後に
+     * UploadScheduler::ProcessCompletions() の中で呼び出される。
+     * スレッドセーフではない（レンダリングスレッドから使用すること）。
+     */
+    class StreamingUploadQueue {
+    public:
+        using RequestId = uint64_t;
+
+        /**
+         * @brief 1回で記録するアップロードの単位
+         */
+        struct UploadChunk {
+            uint64_t size = 0;
+            std::function<void(UploadScheduler&)> record;
+        };
+
+        struct Stats {
+            std::array<uint64_t, static_cast<size_t>(UploadPriority::Count)> pendingBytes{};
+            uint32_t pendingRequests = 0;
+            uint64_t lastFrameBytes = 0;
+            uint32_t lastFrameChunks = 0;
+            double lastFrameMilliseconds = 0.0;
+            uint64_t totalBytes = 0;
+            uint64_t completedRequests = 0;
+        };
+
+        StreamingUploadQueue() = default;
+
+        StreamingUploadQueue(const StreamingUploadQueue&) = delete;
+        StreamingUploadQueue& operator=(const StreamingUploadQueue&) = delete;
+
+        void SetSettings(const StreamingUploadSettings& settings) { this->settings = settings; }
+        const StreamingUploadSettings& GetSettings() const { return settings; }
+
+        /**
+         * @brief 分割済みのアップロードを登録
+         * @param onComplete 全チャンクのコピー完了後に呼び出す処理
+         */
+        RequestId Enqueue(UploadPriority priority, std::vector<UploadChunk> chunks,
+                          std::function<void()> onComplete = nullptr);
+
+        /**
+         * @brief バッファへのアップロードを chunkSize ごとに分割して登録
+         * @param data アップロードするデータ（キューが保持する）
+         * @param finalState 最後のチャンクで遷移させる状態
+         */
+        RequestId EnqueueBuffer(ID3D12Resource* destination, std::vector<uint8_t> data,
+                                UploadPriority priority,
+                                D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_COMMON,
+                                std::function<void()> onComplete = nullptr);
+
+        /**
+         * @brief テクスチャへのアップロードをサブリソース単位で分割して登録
+         * @param subresources 全サブリソースのデータ
+         * @param sourceData subresources が指すデータの所有者（完了まで保持する）
+         * @param finalState 最後のチャンクで遷移させる状態（途中のチャンクは COMMON のまま）
+         */
+        RequestId EnqueueTexture(ID3D12Resource* destination, std::vector<D3D12_SUBRESOURCE_DATA> subresources,
+                                 std::shared_ptr<void> sourceData, UploadPriority priority,
+                                 D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                 std::function<void()> onComplete = nullptr);
+
+        /**
+         * @brief 予算内のチャンクを記録して送信（毎フレーム呼び出す）
+         * @param scheduler 記録先（nullptr の場合は記録せずに予算の消費のみ行う）
+         * @return 処理したチャンク数
+         */
+        uint32_t ProcessFrame(UploadScheduler* scheduler);
+
+        bool IsPending(RequestId id) const;
+        bool IsEmpty() const;
+        Stats GetStats() const;
+        void LogStats() const;
+
+    private:
+        struct Request {
+            RequestId id = 0;
+            std::vector<UploadChunk> chunks;
+            size_t nextChunk = 0;
+            std::function<void()> onComplete;
+        };
+
+        StreamingUploadSettings settings;
+        std::array<std::deque<Request>, static_cast<size_t>(UploadPriority::Count)> queues;
+        RequestId nextRequestId = 1;
+
+        uint64_t lastFrameBytes = 0;
+        uint32_t lastFrameChunks = 0;
+        double lastFrameMilliseconds = 0.0;
+        uint64_t totalBytes = 0;
+        uint64_t completedRequests = 0;
+    };
+
+} // namespace Athena
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "GpuMemoryAllocator.h"
+#include "StreamingUploadQueue.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <cstdint>
@@ -12,6 +14,8 @@ namespace Athena {
 
     // �O���錾
     class UploadContext;
+    class UploadScheduler;
+    struct UploadTicket;
 
     /**
      * @brief �e�N�X�`���̎��
@@ -57,6 +61,24 @@ namespace Athena {
          */
         void UploadToGPU(UploadContext* uploadContext);
 
+        /**
+         * @brief コピーキューで非同期にアップロード
+         * @param scheduler アップロードスケジューラ（BeginBatch() 済みであること）
+         *
+         * コピーの記録のみ行い、送信は Submit() でバッチ単位に行う。
+         * PIXEL_SHADER_RESOURCE への遷移は UploadScheduler::AcquireUploads() で記録される。
+         */
+        void UploadToGPU(UploadScheduler& scheduler);
+
+        /**
+         * @brief ストリーミングキューにサブリソース単位で分割して登録（予算内で数フレームに分けて転送）
+         * @param onComplete 全てのサブリソースの転送完了後に呼び出す処理
+         *
+         * 完了するまでテクスチャを描画に使用しないこと。画像データはキューに移る。
+         */
+        void EnqueueUpload(StreamingUploadQueue& queue, UploadPriority priority,
+                           std::function<void()> onComplete = nullptr);
+
         /**
          * @brief ����������e�N�X�`�����쐬
          * @param device DirectX 12�f�o�C�X
@@ -92,6 +114,14 @@ namespace Athena {
             uint32_t height
         );
 
+        /**
+         * @brief リソース作成に使用するGPUメモリアロケータを設定
+         *
+         * 以降の LoadFromFile() / CreateFromMemory() / CreateRenderTarget() / CreateDepthStencil() で
+         * ヒープブロックに配置リソースとして作成する（nullptr の場合はコミット済みリソース）。
+         */
+        void SetMemoryAllocator(GpuMemoryAllocator* allocator) { memoryAllocator = allocator; }
+
         /**
          * @brief �e�N�X�`���̏I������
          */
@@ -130,8 +160,16 @@ namespace Athena {
         bool IsRenderTarget() const { return type == TextureType::RenderTarget; }
         bool IsDepthStencil() const { return type == TextureType::DepthStencil; }
 
+        /**
+         * @brief 現在のフレームで使用したことをメモリ予算管理に記録（退避中なら復帰）
+         */
+        void MarkUsed() const;
+
     private:
         ComPtr<ID3D12Resource> resource;
+        GpuAllocation allocation;                   // アロケータ使用時のヒープ内の割り当て
+        GpuMemoryAllocator* memoryAllocator = nullptr;
+        uint32_t residencyId = UINT32_MAX;          // MemoryBudgetManager の登録ID
         ComPtr<ID3D12Resource> uploadBuffer; // �A�b�v���[�h�p�ꎞ�o�b�t�@
 
         uint32_t width = 0;
@@ -152,6 +190,27 @@ namespace Athena {
             D3D12_RESOURCE_STATES initialState,
             const D3D12_CLEAR_VALUE* clearValue = nullptr
         );
+
+        /**
+         * @brief 記述からリソースを作成（アロケータ設定時は配置リソース）
+         */
+        void AllocateResource(
+            ID3D12Device* device,
+            const D3D12_RESOURCE_DESC& resourceDesc,
+            D3D12_RESOURCE_STATES initialState,
+            const D3D12_CLEAR_VALUE* clearValue
+        );
+
+        /**
+         * @brief リソースを遅延解放キューに回す
+         */
+        void ReleaseResources();
+
+        /**
+         * @brief メモリ予算管理への登録・解除
+         */
+        void RegisterResidency(ID3D12Device* device, const D3D12_RESOURCE_DESC& resourceDesc);
+        void UnregisterResidency();
     };
 
 } // namespace Athena
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief TLSF（Two-Level Segregated Fit）によるオフセット割り当て
+     *
+     * GpuMemoryAllocator がヒープブロックごとに1つ持ち、配置リソースのオフセットを決める。
+     * 空きブロックをサイズの2段階クラス（2の累乗 × 16分割）ごとのリストで管理し、
+     * ビットマップ検索で割り当て・解放ともに O(1) で行う。
+     * 解放時は物理的に隣接する空きブロックと即座に結合する。
+     *
+     * 全てのサイズとオフセットは granularity の倍数に切り上げられる。
+     */
+    class TlsfAllocator {
+    public:
+        static constexpr uint64_t InvalidOffset = UINT64_MAX;
+        static constexpr uint32_t InvalidNode = UINT32_MAX;
+        static constexpr uint64_t DefaultGranularity = 256;
+
+        /**
+         * @brief 割り当て結果（Free() に渡す）
+         */
+        struct Allocation {
+            uint64_t offset = InvalidOffset;
+            uint64_t size = 0;                     // 切り上げ後のサイズ
+            uint32_t node = InvalidNode;           // 内部ブロック番号
+
+            bool IsValid() const { return offset != InvalidOffset; }
+        };
+
+        /**
+         * @brief 使用状況の統計
+         */
+        struct Stats {
+            uint64_t totalSize = 0;
+            uint64_t usedSize = 0;
+            uint64_t freeSize = 0;
+            uint64_t largestFreeBlock = 0;
+            uint32_t allocationCount = 0;
+            uint32_t freeBlockCount = 0;
+
+            /**
+             * @brief 断片化率（0 = 空き領域が1ブロックに集約、1に近いほど細切れ）
+             */
+            float GetFragmentation() const {
+                return freeSize > 0 ? 1.0f - static_cast<float>(largestFreeBlock) / static_cast<float>(freeSize) : 0.0f;
+            }
+
+            float GetUtilization() const {
+                return totalSize > 0 ? static_cast<float>(usedSize) / static_cast<float>(totalSize) : 0.0f;
+            }
+        };
+
+        TlsfAllocator() = default;
+        explicit TlsfAllocator(uint64_t size, uint64_t granularity = DefaultGranularity) { Reset(size, granularity); }
+
+        /**
+         * @brief 管理する領域サイズを設定し、全割り当てを破棄
+         * @param granularity 最小割り当て単位（2の累乗）
+         */
+        void Reset(uint64_t size, uint64_t granularity = DefaultGranularity);
+
+        /**
+         * @brief 領域を割り当て
+         * @param size サイズ（バイト）
+         * @param alignment アライメント（2の累乗）
+         * @return 割り当て結果（空きがない場合は IsValid() == false）
+         */
+        Allocation Allocate(uint64_t size, uint64_t alignment = 1);
+
+        /**
+         * @brief 領域を解放
+         */
+        void Free(const Allocation& allocation);
+
+        /**
+         * @brief 統計を取得（最大空きブロックの検索は最上位クラスのリストのみ走査）
+         */
+        Stats GetStats() const;
+
+        /**
+         * @brief 内部構造の整合性を検証（テスト・ファジング用）
+         *
+         * 物理ブロックの連続性、隣接空きブロックの未結合、空きリストとビットマップの一致を確認する。
+         */
+        bool Validate() const;
+
+        bool IsEmpty() const { return allocationCount == 0; }
+        uint64_t GetSize() const { return totalSize; }
+        uint64_t GetUsedSize() const { return usedSize; }
+        uint32_t GetAllocationCount() const { return allocationCount; }
+
+    private:
+        static constexpr uint32_t SecondLevelLog2 = 4;
+        static constexpr uint32_t SecondLevelCount = 1u << SecondLevelLog2;
+        static constexpr uint32_t FirstLevelCount = 64;
+
+        struct Node {
+            uint64_t offset = 0;
+            uint64_t size = 0;
+            uint32_t prevPhysical = InvalidNode;
+            uint32_t nextPhysical = InvalidNode;
+            uint32_t prevFree = InvalidNode;
+            uint32_t nextFree = InvalidNode;
+            bool isFree = false;
+            bool isAlive = false;                  // ノードプール上で使用中か
+        };
+
+        void MapInsert(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const;
+        void MapSearch(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const;
+        uint32_t FindFreeNode(uint64_t size) const;
+        void InsertFree(uint32_t node);
+        void RemoveFree(uint32_t node);
+        uint32_t CreateNode(uint64_t offset, uint64_t size);
+        void DestroyNode(uint32_t node);
+
+        std::vector<Node> nodes;
+        std::vector<uint32_t> unusedNodes;         // 再利用可能なノード番号
+
+        uint64_t firstLevelBitmap = 0;
+        uint32_t secondLevelBitmap[FirstLevelCount] = {};
+        uint32_t freeHeads[FirstLevelCount][SecondLevelCount] = {};
+
+        uint64_t totalSize = 0;
+        uint64_t granularity = DefaultGranularity;
+        uint64_t usedSize = 0;
+        uint32_t allocationCount = 0;
+        uint32_t freeBlockCount = 0;
+    };
+
+} // namespace Athena
\ No newline at end of file
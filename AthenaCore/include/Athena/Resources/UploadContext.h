@@ -1,5 +1,7 @@
 #pragma once
 
+#include "UploadRingBuffer.h"
+#include "Athena/Core/CommandListPool.h"
 #include <d3d12.h>
 #include <wrl/client.h>
 #include <cstdint>
@@ -15,6 +17,9 @@ namespace Athena {
      *
      * eNX`obt@GPUɃAbv[h邽߂
      * ꎞIȃR}hXgƃ\[XǗs
+     *
+     * Xe[WÖ͉i}bvꂽOobt@؂o߁A
+     * Abv[hƂɃ\[X쐬ȂB
      */
     class UploadContext {
     public:
@@ -25,8 +30,10 @@ namespace Athena {
          * @brief 
          * @param device DirectX 12foCX
          * @param commandQueue R}hL[
+         * @param ringBufferSize Xe[WOpOobt@̗eʁi0̏ꍇ͖pobt@j
          */
-        void Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue);
+        void Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue,
+                        uint64_t ringBufferSize = UploadRingBuffer::DefaultCapacity);
 
         /**
          * @brief I
@@ -82,25 +89,36 @@ namespace Athena {
         void End();
 
         /**
-         * @brief R}hXgւ̃ANZX
+         * @brief L^̃R}hXgւ̃ANZXiBegin()  End() ̊Ԃ̂ݗLj
+         */
+        ID3D12GraphicsCommandList* GetCommandList() const { return currentList ? currentList->commandList.Get() : nullptr; }
+
+        /**
+         * @brief Xe[WOpOobt@ւ̃ANZXivpj
          */
-        ID3D12GraphicsCommandList* GetCommandList() const { return commandList.Get(); }
+        const UploadRingBuffer& GetRingBuffer() const { return ringBuffer; }
 
     private:
         ComPtr<ID3D12Device> device;
         ComPtr<ID3D12CommandQueue> commandQueue;
-        ComPtr<ID3D12CommandAllocator> commandAllocator;
-        ComPtr<ID3D12GraphicsCommandList> commandList;
+
+        // Begin() ƂɃv[擾AEnd() ŃtFXlƂƂɕԋp
+        CommandListPool commandListPool;
+        PooledCommandList* currentList = nullptr;
 
         ComPtr<ID3D12Fence> fence;
         HANDLE fenceEvent = nullptr;
         uint64_t fenceValue = 0;
 
-        // ꎞIȃAbv[hobt@iEnd()Ŏ폜j
-        std::vector<ComPtr<ID3D12Resource>> uploadBuffers;
+        // Xe[WOpOobt@itFXŗ̈ėpj
+        UploadRingBuffer ringBuffer;
+
+        /**
+         * @brief Xe[WÖ蓖āi󂫂ȂΌÂob`̊҂j
+         */
+        UploadAllocation AllocateStaging(uint64_t size, uint64_t alignment);
 
-        void WaitForGPU();
-        void ResetCommandList();
+        void WaitForFenceValue(uint64_t value);
     };
 
 } // namespace Athena
\ No newline at end of file
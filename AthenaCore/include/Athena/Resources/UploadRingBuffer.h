@@ -0,0 +1,102 @@
+#pragma once
+
+#include "RingBufferAllocator.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief ステージング領域の割り当て結果
+     */
+    struct UploadAllocation {
+        ID3D12Resource* resource = nullptr;        // コピー元リソース
+        uint64_t offset = 0;                       // リソース先頭からのオフセット
+        uint8_t* cpuAddress = nullptr;             // 書き込み先（マップ済み）
+        uint64_t size = 0;
+        bool isDedicated = false;                  // 専用バッファへのフォールバックか
+    };
+
+    /**
+     * @brief 永続マップされたアップロード用リングバッファ
+     *
+     * UPLOADヒープのバッファを1つだけ作成して常時マップし、RingBufferAllocator で
+     * ステージング領域を切り出す。容量の半分を超える大きなアップロードのみ
+     * 専用バッファを作成し、同じフェンスで解放する。
+     */
+    class UploadRingBuffer {
+    public:
+        static constexpr uint64_t DefaultCapacity = 16ull * 1024 * 1024;
+        static constexpr uint64_t BufferAlignment = 256;
+        static constexpr uint64_t TextureAlignment = D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
+
+        UploadRingBuffer() = default;
+        ~UploadRingBuffer();
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param capacity リングバッファ容量（0の場合は全て専用バッファ）
+         */
+        void Initialize(ID3D12Device* device, uint64_t capacity = DefaultCapacity);
+
+        /**
+         * @brief 終了処理（GPUの完了は呼び出し側で保証すること）
+         */
+        void Shutdown();
+
+        /**
+         * @brief リングバッファから割り当て
+         *
+         * 大きすぎるアップロードは専用バッファで割り当てる。
+         * リングに空きがない場合は false を返すので、呼び出し側は
+         * GetOldestPendingFence() の完了を待って ReleaseCompleted() 後に再試行する。
+         */
+        bool TryAllocate(uint64_t size, uint64_t alignment, UploadAllocation& allocation);
+
+        /**
+         * @brief 専用バッファを割り当て
+         */
+        UploadAllocation AllocateDedicated(uint64_t size);
+
+        /**
+         * @brief 現在の割り当てをフェンス値に紐付ける（コマンドリスト送信後に呼び出す）
+         */
+        void FinishBatch(uint64_t fenceValue);
+
+        /**
+         * @brief 完了したフェンス値までの領域と専用バッファを解放
+         */
+        void ReleaseCompleted(uint64_t completedFenceValue);
+
+        uint64_t GetOldestPendingFence() const;
+        bool HasPendingBatches() const;
+
+        uint64_t GetCapacity() const { return allocator.GetCapacity(); }
+        uint64_t GetUsedSize() const { return allocator.GetUsedSize(); }
+        uint64_t GetDedicatedAllocationCount() const { return dedicatedAllocationCount; }
+
+    private:
+        ComPtr<ID3D12Resource> CreateUploadBuffer(uint64_t size);
+
+        struct DedicatedBatch {
+            uint64_t fenceValue;
+            std::vector<ComPtr<ID3D12Resource>> buffers;
+        };
+
+        ComPtr<ID3D12Device> device;
+        ComPtr<ID3D12Resource> ringResource;
+        uint8_t* mappedData = nullptr;
+        RingBufferAllocator allocator;
+
+        std::vector<ComPtr<ID3D12Resource>> currentDedicated;    // 未確定バッチの専用バッファ
+        std::deque<DedicatedBatch> pendingDedicated;             // GPU使用中の専用バッファ
+        uint64_t dedicatedAllocationCount = 0;
+    };
+
+} // namespace Athena
\ No newline at end of file
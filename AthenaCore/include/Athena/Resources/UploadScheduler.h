@@ -0,0 +1,177 @@
+#pragma once
+
+#include "UploadRingBuffer.h"
+#include "Athena/Core/CommandListPool.h"
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Athena {
+
+    using Microsoft::WRL::ComPtr;
+
+    /**
+     * @brief アップロードバッチの完了チケット（コピーキューのフェンス値）
+     */
+    struct UploadTicket {
+        uint64_t fenceValue = 0;
+
+        bool IsValid() const { return fenceValue != 0; }
+    };
+
+    /**
+     * @brief 専用コピーキューによる非同期アップロードスケジューラ
+     *
+     * BeginBatch() 〜 Submit() の間に記録したコピーをコピーキューへ送信し、
+     * バッチごとにチケット（フェンス値）を返す。CPUは待機せず、完了は
+     * IsComplete() / OnComplete() で確認する。
+     *
+     * キュー間の所有権移行：
+     *   コピーキューで書き込んだリソースは実行完了時に COMMON へ減衰する。
+     *   グラフィックスキュー側では AcquireUploads() を呼び出すと、コピーキューの
+     *   フェンスをGPU上で待機し、COMMON から指定の最終状態へのバリアを記録する。
+     *   転送先リソースは COMMON または COPY_DEST 状態で渡すこと。
+     *
+     * スレッドセーフではない（ロード処理とレンダリングは同じスレッドから呼び出すこと）。
+     */
+    class UploadScheduler {
+    public:
+        UploadScheduler() = default;
+        ~UploadScheduler();
+
+        UploadScheduler(const UploadScheduler&) = delete;
+        UploadScheduler& operator=(const UploadScheduler&) = delete;
+
+        /**
+         * @brief 初期化
+         * @param device D3D12デバイス
+         * @param graphicsQueue アップロード結果を使用するグラフィックスキュー
+         * @param ringBufferSize ステージング用リングバッファの容量
+         */
+        void Initialize(ID3D12Device* device, ID3D12CommandQueue* graphicsQueue,
+                        uint64_t ringBufferSize = UploadRingBuffer::DefaultCapacity);
+
+        /**
+         * @brief 終了処理（全バッチの完了を待機）
+         */
+        void Shutdown();
+
+        /**
+         * @brief バッチの記録を開始
+         */
+        void BeginBatch();
+
+        /**
+         * @brief バッファへのアップロードを記録
+         * @param destination 転送先バッファ（DEFAULTヒープ）
+         * @param data アップロードするデータ
+         * @param dataSize データサイズ
+         * @param destinationOffset 転送先オフセット
+         * @param finalState グラフィックスキューで使用する状態
+         */
+        void UploadBuffer(ID3D12Resource* destination, const void* data, uint64_t dataSize,
+                          uint64_t destinationOffset = 0,
+                          D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_COMMON);
+
+        /**
+         * @brief テクスチャへのアップロードを記録
+         * @param subresourceData firstSubresource から numSubresources 個分のデータ
+         * @param firstSubresource 最初のサブリソース番号（ミップ単位で分割して送る場合）
+         *
+         * 分割して送る場合、途中のバッチの finalState は COMMON にすること
+         * （グラフィックスキューで遷移させるとコピーキューから書き込めなくなる）。
+         */
+        void UploadTexture(ID3D12Resource* destination, const D3D12_SUBRESOURCE_DATA* subresourceData,
+                           uint32_t numSubresources,
+                           D3D12_RESOURCE_STATES finalState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                           uint32_t firstSubresource = 0);
+
+        /**
+         * @brief バッチをコピーキューへ送信
+         * @return バッチの完了チケット（記録が空の場合は無効なチケット）
+         */
+        UploadTicket Submit();
+
+        /**
+         * @brief バッチが完了したか
+         */
+        bool IsComplete(const UploadTicket& ticket) const;
+
+        /**
+         * @brief バッチの完了をCPUで待機（ロード画面など、待機してよい場合のみ）
+         */
+        void Wait(const UploadTicket& ticket);
+
+        /**
+         * @brief バッチ完了時に呼び出す処理を登録
+         *
+         * ProcessCompletions() の中で呼び出される。既に完了している場合は次回呼び出し時に実行。
+         */
+        void OnComplete(const UploadTicket& ticket, std::function<void()> callback);
+
+        /**
+         * @brief 完了したバッチのステージング領域を解放し、コールバックを実行
+         *
+         * 毎フレーム呼び出すこと。
+         */
+        void ProcessCompletions();
+
+        /**
+         * @brief 送信済みのアップロードをグラフィックスキューへ移行
+         *
+         * グラフィックスキューにコピーキューのフェンス待機を挿入し、
+         * 最終状態へのバリアを commandList に記録する。同じリソースは最後の最終状態へ1回だけ遷移させる。
+         * commandList はこの呼び出し後にグラフィックスキューへ送信すること。
+         * 最終状態が全て COMMON の場合は commandList に nullptr を渡してよい（キュー待機のみ）。
+         * それ以外で nullptr を渡すと std::invalid_argument をスローし、何も移行しない。
+         *
+         * @return 移行したリソース数
+         */
+        uint32_t AcquireUploads(ID3D12GraphicsCommandList* commandList);
+
+        /**
+         * @brief 指定キューにチケットの完了をGPU上で待機させる（バリアは記録しない）
+         */
+        void WaitOnQueue(const UploadTicket& ticket, ID3D12CommandQueue* queue) const;
+
+        ID3D12CommandQueue* GetCopyQueue() const { return copyQueue.Get(); }
+        uint64_t GetCompletedFenceValue() const;
+        const UploadRingBuffer& GetRingBuffer() const { return ringBuffer; }
+
+    private:
+        struct PendingAcquire {
+            uint64_t fenceValue;
+            ComPtr<ID3D12Resource> resource;
+            D3D12_RESOURCE_STATES finalState;
+        };
+
+        struct PendingCallback {
+            uint64_t fenceValue;
+            std::function<void()> callback;
+        };
+
+        UploadAllocation AllocateStaging(uint64_t size, uint64_t alignment);
+        void WaitForFenceValue(uint64_t value);
+
+        ComPtr<ID3D12Device> device;
+        ComPtr<ID3D12CommandQueue> graphicsQueue;
+        ComPtr<ID3D12CommandQueue> copyQueue;
+        ComPtr<ID3D12Fence> fence;
+        HANDLE fenceEvent = nullptr;
+        uint64_t nextFenceValue = 1;
+
+        UploadRingBuffer ringBuffer;
+
+        // コマンドアロケータはGPU完了まで再利用できないためプールする
+        CommandListPool commandListPool;
+        PooledCommandList* currentContext = nullptr;
+
+        // 記録中バッチのリソース（Submit() でフェンス値を確定する）
+        std::vector<PendingAcquire> batchAcquires;
+        std::vector<PendingAcquire> submittedAcquires;
+        std::vector<PendingCallback> callbacks;
+    };
+
+} // namespace Athena
\ No newline at end of file
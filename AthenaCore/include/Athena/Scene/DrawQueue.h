@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief 64bit のソートキー付きの描画リスト
+     *
+     * キーを昇順に並べると描画順になるよう、優先するものから上位ビットに詰める。
+     *   不透明: パイプライン(8) | マテリアル(16) | メッシュ(24) | 深度の上位(16)
+     *           → 状態ごとにまとめ、同じ状態の中は手前から（オーバードローを減らすだけなので粗くてよい）
+     *   半透明: 深度を反転(24) | パイプライン(8) | マテリアル(16) | メッシュ(16)
+     *           → 奥から手前（同じ深度の中は状態ごと）
+     * 各番号は幅を超えた上位ビットを捨てる。まとまりが粗くなるだけで、深度の順は崩れない。
+     *
+     * Sort() は比較を行わない LSD 基数ソートで、全要素で値が変わるビットだけを桁にする。
+     * 番号の範囲が小さいほど桁が減り、パスの回数が少なくなる。
+     * 安定なので、同じキーの要素は追加した順のまま残る。
+     */
+    class DrawQueue {
+    public:
+        struct Item {
+            uint64_t key;
+            uint32_t componentIndex;    // SceneComponents の位置
+        };
+
+        static constexpr uint32_t PipelineBits = 8;
+        static constexpr uint32_t MaterialBits = 16;
+        static constexpr uint32_t DepthBits = 24;              // QuantizeDepth() の幅
+        static constexpr uint32_t OpaqueMeshBits = 24;
+        static constexpr uint32_t OpaqueDepthBits = 16;
+        static constexpr uint32_t TransparentMeshBits = 16;
+        static_assert(PipelineBits + MaterialBits + OpaqueMeshBits + OpaqueDepthBits == 64, "Opaque key fields must fill 64 bits");
+        static_assert(DepthBits + PipelineBits + MaterialBits + TransparentMeshBits == 64, "Transparent key fields must fill 64 bits");
+
+        /**
+         * @brief ビュー空間の深度（カメラの前方への距離）を DepthBits に量子化
+         *
+         * 正の float のビット列は値の順に並ぶので、その上位ビットをそのまま使う。
+         * 近くほど細かい対数的な刻みになり、ニア・ファーの範囲を必要としない。0 以下は 0。
+         */
+        static uint32_t QuantizeDepth(float viewDepth);
+
+        static uint64_t MakeOpaqueKey(uint32_t pipelineId, uint32_t materialId, uint32_t meshId, uint32_t depth);
+        static uint64_t MakeTransparentKey(uint32_t pipelineId, uint32_t materialId, uint32_t meshId, uint32_t depth);
+
+        void Clear() { items.clear(); }
+        void Reserve(size_t count) { items.reserve(count); }
+        void Push(uint64_t key, uint32_t componentIndex) { items.push_back({ key, componentIndex }); }
+        bool Empty() const { return items.empty(); }
+        uint32_t Size() const { return static_cast<uint32_t>(items.size()); }
+
+        /**
+         * @brief 要素（並列に書き込む場合は先に resize してから位置ごとに書く）
+         */
+        std::vector<Item>& GetItems() { return items; }
+        const std::vector<Item>& GetItems() const { return items; }
+
+        /**
+         * @brief キーの昇順に並べ替える
+         */
+        void Sort();
+
+    private:
+        static constexpr uint32_t MaxRadixBits = 11;
+        static constexpr uint32_t MaxPassCount = (64 + MaxRadixBits - 1) / MaxRadixBits;
+        static constexpr uint32_t MaxBitRuns = 4;
+
+        /**
+         * @brief 1パスの桁を作るキーのビット範囲（key >> shift の下位 bitCount ビットを桁の offset に置く）
+         */
+        struct DigitPart {
+            uint32_t shift;
+            uint32_t bitCount;
+            uint32_t offset;
+        };
+
+        struct DigitLayout {
+            DigitPart parts[MaxBitRuns];
+            uint32_t partCount = 0;
+        };
+
+        static uint32_t ExtractDigit(uint64_t key, const DigitLayout& layout) {
+            uint32_t digit = 0;
+            for (uint32_t i = 0; i < layout.partCount; ++i) {
+                const DigitPart& part = layout.parts[i];
+                digit |= static_cast<uint32_t>((key >> part.shift) & ((uint64_t(1) << part.bitCount) - 1)) << part.offset;
+            }
+            return digit;
+        }
+
+        std::vector<Item> items;
+        std::vector<Item> scratch;         // 並べ替えの作業領域（フレームをまたいで再利用する）
+        std::vector<uint32_t> histograms;  // パスごとの桁の度数
+    };
+
+} // namespace Athena
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "../Utils/Math.h"
+#include <cstdint>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief AABB のフラスタムカリング（SIMD）
+     *
+     * バウンディングを軸ごとの float 配列（SoA）に写して持ち、6平面に対して
+     * 4 個（SSE / NEON）または 8 個（AVX）ずつまとめて判定する。
+     * 平面の法線の符号で min / max のどちらの配列を読むかを平面ごとに決めるため、
+     * レーンごとの分岐や選択は発生しない。
+     */
+    class FrustumCuller {
+    public:
+        enum class Kernel {
+            Scalar,
+            SSE,
+            AVX,
+            NEON,
+        };
+
+        static constexpr uint32_t LaneCount = 8;    // 配列はこの倍数まで詰め物をする
+
+        /**
+         * @brief バウンディングを SoA に写す（boundsMin[i], boundsMax[i] が要素 i の AABB）
+         */
+        void Assign(const Vector3* boundsMin, const Vector3* boundsMax, uint32_t count);
+
+        /**
+         * @brief 要素1個のバウンディングを書き換える（移動したオブジェクトだけを反映する用）
+         */
+        void Update(uint32_t index, const Vector3& boundsMin, const Vector3& boundsMax) {
+            minX[index] = boundsMin.x;
+            minY[index] = boundsMin.y;
+            minZ[index] = boundsMin.z;
+            maxX[index] = boundsMax.x;
+            maxY[index] = boundsMax.y;
+            maxZ[index] = boundsMax.z;
+        }
+
+        void Clear();
+
+        uint32_t GetCount() const { return count; }
+
+        /**
+         * @brief 6平面（内側が正）と交差する要素のインデックスを昇順に書き出す
+         *
+         * outIndices には GetCount() 個分の領域が必要。戻り値は書き出した個数。
+         */
+        uint32_t Cull(const Vector4 planes[6], uint32_t* outIndices) const;
+        uint32_t Cull(const Vector4 planes[6], uint32_t* outIndices, Kernel kernel) const;
+
+        /**
+         * @brief [begin, end) の要素だけを判定（並列化用、begin は LaneCount の倍数）
+         *
+         * outIndices には end - begin 個分の領域が必要。書き出すのは要素のインデックスそのもの。
+         */
+        uint32_t CullRange(const Vector4 planes[6], uint32_t begin, uint32_t end,
+                           uint32_t* outIndices, Kernel kernel = GetBestKernel()) const;
+
+        /**
+         * @brief 実行中の CPU で使える最も広いカーネル
+         */
+        static Kernel GetBestKernel();
+        static bool IsKernelSupported(Kernel kernel);
+        static const char* GetKernelName(Kernel kernel);
+
+        /**
+         * @brief ビュー・プロジェクション行列（行ベクトル、v * View * Proj）から6平面を取り出す
+         *
+         * 順序は左・右・下・上・近・遠。法線は正規化し、内側を正とする。
+         */
+        static void ExtractPlanes(const Matrix4x4& viewProjection, Vector4 outPlanes[6]);
+
+        /**
+         * @brief AABB 1個の判定（カーネルのスカラー版と同じ結果）
+         */
+        static bool Intersects(const Vector4 planes[6], const Vector3& boundsMin, const Vector3& boundsMax);
+
+    private:
+        std::vector<float> minX, minY, minZ;
+        std::vector<float> maxX, maxY, maxZ;
+        uint32_t count = 0;
+    };
+
+} // namespace Athena
@@ -114,7 +114,7 @@ namespace Athena {
         /**
          * @brief GPU�o�b�t�@���쐬���ăf�[�^���A�b�v���[�h
          */
-        void UploadToGPU(ID3D12Device* device);
+        void UploadToGPU(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator = nullptr);
 
         /**
          * @brief �T�u���b�V����ǉ�
@@ -151,7 +151,7 @@ namespace Athena {
         // ===== Model Loading Support =====
         void SetVertexData(const void* data, size_t dataSize, size_t stride);
         void SetIndexData(const void* data, size_t dataSize, size_t indexCount);
-        void CreateBuffers(ID3D12Device* device);
+        void CreateBuffers(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator = nullptr);
         
         // Raw data access methods for RenderGraph integration
         size_t GetRawVertexDataSize() const { return rawVertexData.size(); }
@@ -56,11 +56,24 @@ namespace Athena {
         std::shared_ptr<Texture> aoTexture;
     };
 
+    /**
+     * @brief モデルファイル内のノード（親の座標系での変換と、そのノードが描画する Mesh）
+     */
+    struct ModelNode {
+        static constexpr uint32_t InvalidParent = UINT32_MAX;
+        
+        std::string name;
+        Matrix4x4 localMatrix;             // 列ベクトル（平行移動は m[i][3]）
+        uint32_t parent = InvalidParent;   // Model::nodes の位置（親は常に子より前）
+        std::vector<uint32_t> meshes;      // Model::meshes の位置
+    };
+
     /**
      * @brief 読み込まれたモデルデータ
      */
     struct Model {
         std::vector<std::shared_ptr<Mesh>> meshes;
+        std::vector<ModelNode> nodes;      // 深さ優先の順
         std::vector<MaterialData> materials;
         std::string directory;     // モデルファイルのディレクトリ
         std::string filename;      // モデルファイル名
@@ -132,6 +145,7 @@ namespace Athena {
         static void ProcessNode(
             const aiScene* scene,
             aiNode* node,
+            uint32_t parentNode,
             Model* model,
             std::shared_ptr<Device> device,
             const std::string& directory
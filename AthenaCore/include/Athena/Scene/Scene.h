@@ -1,6 +1,10 @@
 #pragma once
 
 #include "SceneObject.h"
+#include "SceneComponents.h"
+#include "SceneBVH.h"
+#include "FrustumCuller.h"
+#include "DrawQueue.h"
 #include "Camera.h"
 #include "CameraController.h"
 #include "../Utils/Math.h"
@@ -76,6 +80,17 @@ namespace Athena {
      * 
      * 3Dシーン内のオブジェクト、ライト、カメラ、環境設定を管理し、
      * フラスタムカリング、ソート、バッチング等の最適化を提供する。
+     *
+     * オブジェクトは SceneComponents のコンポーネント配列に格納し、SceneHandle で参照する。
+     * Mesh と Material はシーンの表に1つずつ登録し、オブジェクトは表のインデックスを持つ。
+     * 名前による検索は名前 → ハンドルの索引で行う。
+     *
+     * レイ判定・最近傍探索はワールド AABB の BVH で行う。BVH は最初のクエリで構築し、
+     * 以降は UpdateTransforms() で移動したオブジェクトをリフィットで反映する。
+     * 可視判定は AABB を SoA に写した FrustumCuller で全オブジェクトを SIMD でまとめて判定する。
+     *
+     * オブジェクトは親を持てる。位置・回転・スケールは親の座標系で表し、
+     * ワールド行列は親のワールド行列 × ローカル行列で求める。
      */
     class Scene {
     public:
@@ -89,36 +104,105 @@ namespace Athena {
         // ===== オブジェクト管理 =====
         
         /**
-         * @brief SceneObjectを追加
+         * @brief SceneObjectを追加（Transform・Mesh・Materialをコンポーネント配列にコピー）
+         *
+         * 同じ名前のオブジェクトがすでにある場合、名前の索引は新しいオブジェクトを指す。
+         * parent を指定した場合、Transform は親の座標系として扱う。
          */
-        void AddObject(std::shared_ptr<SceneObject> object);
+        SceneHandle AddObject(const SceneObject& object, SceneHandle parent = {});
+        SceneHandle AddObject(std::shared_ptr<SceneObject> object, SceneHandle parent = {});
         
         /**
-         * @brief ModelObjectを追加（自動的にSceneObjectに展開）
+         * @brief ModelObjectを追加（自動的にSceneObjectに展開、ノードの親子関係を保つ）
          */
-        void AddModel(std::shared_ptr<ModelObject> model);
+        std::vector<SceneHandle> AddModel(std::shared_ptr<ModelObject> model);
         
         /**
-         * @brief オブジェクトを削除
+         * @brief オブジェクトを子孫ごと削除（無効なハンドルの場合は何もしない）
          */
         void RemoveObject(const std::string& name);
-        void RemoveObject(std::shared_ptr<SceneObject> object);
+        void RemoveObject(SceneHandle handle);
         
         /**
-         * @brief オブジェクトを検索
+         * @brief オブジェクトを検索（見つからない場合は無効なハンドル）
          */
-        std::shared_ptr<SceneObject> FindObject(const std::string& name) const;
+        SceneHandle FindObject(const std::string& name) const;
         
         /**
-         * @brief 全オブジェクトを取得
+         * @brief ハンドルが存在するオブジェクトを指しているか
          */
-        std::vector<std::shared_ptr<SceneObject>> GetObjects() const;
+        bool IsAlive(SceneHandle handle) const;
+        
+        /**
+         * @brief 全オブジェクトを取得（コンポーネント配列の順）
+         */
+        std::vector<SceneHandle> GetObjects() const;
+        uint32_t GetObjectCount() const { return components.Size(); }
         
         /**
          * @brief オブジェクトをクリア
          */
         void ClearObjects();
 
+        // ===== オブジェクトのコンポーネント =====
+        // 削除済みのハンドルを渡した場合は例外をスロー
+
+        Vector3 GetPosition(SceneHandle handle) const;
+        Vector3 GetRotation(SceneHandle handle) const;
+        Vector3 GetScale(SceneHandle handle) const;
+        void SetPosition(SceneHandle handle, const Vector3& position);
+        void SetRotation(SceneHandle handle, const Vector3& rotation);
+        void SetScale(SceneHandle handle, const Vector3& scale);
+
+        /**
+         * @brief ワールド行列・AABB（Set* で変更した場合は UpdateTransforms() 後に反映）
+         */
+        const Matrix4x4& GetWorldMatrix(SceneHandle handle) const;
+        void GetWorldBounds(SceneHandle handle, Vector3& outMin, Vector3& outMax) const;
+
+        std::shared_ptr<Mesh> GetMesh(SceneHandle handle) const;
+        const MaterialData& GetMaterial(SceneHandle handle) const;
+        void SetMaterial(SceneHandle handle, const MaterialData& material);
+
+        const std::string& GetObjectName(SceneHandle handle) const;
+
+        /**
+         * @brief 親を変更（無効なハンドルでルートにする、子孫を親にすると例外をスロー）
+         *
+         * ローカルの位置・回転・スケールはそのまま新しい親の座標系で解釈する。
+         */
+        void SetParent(SceneHandle handle, SceneHandle parent);
+        SceneHandle GetParent(SceneHandle handle) const;
+        std::vector<SceneHandle> GetChildren(SceneHandle handle) const;
+
+        void SetVisible(SceneHandle handle, bool visible);
+        bool IsVisible(SceneHandle handle) const;
+        void SetTransparent(SceneHandle handle, bool transparent);
+        bool IsTransparent(SceneHandle handle) const;
+
+        /**
+         * @brief 描画に使うパイプラインの番号（描画リストのソートキーの最上位、既定は 0）
+         */
+        void SetPipeline(SceneHandle handle, uint32_t pipelineId);
+        uint32_t GetPipeline(SceneHandle handle) const;
+
+        /**
+         * @brief コンポーネント配列（毎フレームの処理で直接走査する）
+         */
+        const SceneComponents& GetComponents() const { return components; }
+
+        /**
+         * @brief コンポーネント配列での位置（削除で変わるためフレームをまたいで保持しない）
+         */
+        uint32_t GetComponentIndex(SceneHandle handle) const;
+        SceneHandle GetHandle(uint32_t componentIndex) const;
+
+        /**
+         * @brief メッシュ・マテリアルの表（SceneComponents の meshIds / materialIds が指す）
+         */
+        const std::vector<std::shared_ptr<Mesh>>& GetMeshes() const { return meshes; }
+        const std::vector<MaterialData>& GetMaterials() const { return materials; }
+
         // ===== ライト管理 =====
         
         /**
@@ -167,15 +251,34 @@ namespace Athena {
          */
         void Update(float deltaTime);
         
+        /**
+         * @brief 変更されたオブジェクトとその子孫のワールド行列とAABBを更新
+         *
+         * 親が子より前に並んでいるので、配列を1回走査するだけで親の変更が子に伝わる。
+         * クエリはここで更新したAABBを使う（Set* の変更はこの呼び出しまで反映されない）。
+         */
+        void UpdateTransforms();
+        
         /**
          * @brief 可視オブジェクトを取得（フラスタムカリング済み）
+         *
+         * JobSystem のグローバルがあればワーカースレッドで分担する。
+         * 結果はコンポーネント配列の順で、スレッド数によらず同じになる。
+         */
+        std::vector<SceneHandle> GetVisibleObjects(const Camera* camera) const;
+        
+        /**
+         * @brief 距離でソートされた透明オブジェクトを取得（奥から手前、同じ距離は配列の順）
          */
-        std::vector<std::shared_ptr<SceneObject>> GetVisibleObjects(const Camera* camera) const;
+        std::vector<SceneHandle> GetTransparentObjects(const Camera* camera) const;
         
         /**
-         * @brief 距離でソートされた透明オブジェクトを取得
+         * @brief 可視でメッシュを持つオブジェクトの描画リストを作成し、ソートキーで並べる
+         *
+         * 不透明は状態（パイプライン・マテリアル・メッシュ）ごとに手前から、半透明は奥から手前。
+         * 深度はカメラのビュー空間での AABB 中心の奥行き。出力先の領域はそのまま再利用する。
          */
-        std::vector<std::shared_ptr<SceneObject>> GetTransparentObjects(const Camera* camera) const;
+        void BuildDrawQueues(const Camera* camera, DrawQueue& outOpaque, DrawQueue& outTransparent) const;
         
         /**
          * @brief シーンをレンダリング
@@ -198,12 +301,12 @@ namespace Athena {
         /**
          * @brief 指定位置に最も近いオブジェクトを検索
          */
-        std::shared_ptr<SceneObject> FindNearestObject(const Vector3& position) const;
+        SceneHandle FindNearestObject(const Vector3& position) const;
         
         /**
-         * @brief レイとの交差判定
+         * @brief レイとの交差判定（AABB、近い順）
          */
-        std::vector<std::shared_ptr<SceneObject>> RayIntersect(const Vector3& origin, const Vector3& direction) const;
+        std::vector<SceneHandle> RayIntersect(const Vector3& origin, const Vector3& direction) const;
         
         /**
          * @brief カメラに全オブジェクトが映るようにフレーミング
@@ -256,10 +359,31 @@ namespace Athena {
         std::string name;
         
         // オブジェクト管理
-        std::vector<std::shared_ptr<SceneObject>> objects;
-        std::unordered_map<std::string, std::shared_ptr<SceneObject>> objectsByName;
-        
-        // モデルオブジェクト管理（生成したSceneObjectの元となるModelObjectを保持）
+        struct Slot {
+            uint32_t componentIndex = SceneComponents::InvalidId;  // 空きスロットは InvalidId
+            uint32_t generation = 0;
+        };
+
+        SceneComponents components;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+        std::unordered_map<std::string, SceneHandle> objectsByName;
+        bool hierarchyDirty = false;         // 親の変更・削除の後は parents を作り直す
+        
+        // メッシュ・マテリアルの表
+        std::vector<std::shared_ptr<Mesh>> meshes;
+        std::unordered_map<const Mesh*, uint32_t> meshIdsByPointer;
+        std::vector<MaterialData> materials;
+        std::unordered_multimap<uint64_t, uint32_t> materialIdsByHash;
+        
+        // 空間インデックス（const のクエリから遅延更新する）
+        mutable SceneBVH bvh;
+        mutable bool bvhStructureDirty = false;
+        mutable bool bvhBoundsDirty = false;
+        mutable FrustumCuller culler;        // 移動は UpdateTransforms() で直接書き換える
+        mutable bool cullerDirty = false;    // 追加・削除の後は写し直し
+        
+        // モデルオブジェクト管理（生成したオブジェクトの元となるModelObjectを保持）
         std::vector<std::shared_ptr<ModelObject>> models;
         
         // ライト管理
@@ -276,13 +400,66 @@ namespace Athena {
         bool showBounds = false;
         bool showLights = false;
         
+        // 描画リスト（Render() で毎フレーム作り直す）
+        DrawQueue opaqueQueue;
+        DrawQueue transparentQueue;
+        
         // 統計情報
         mutable RenderStats renderStats;
         
         /**
-         * @brief フラスタムカリング
+         * @brief ハンドルからコンポーネント配列の位置を取得（削除済みの場合は例外をスロー）
+         */
+        uint32_t Resolve(SceneHandle handle) const;
+        
+        /**
+         * @brief parentSlots から parents を作り直し、親が子より前になるよう並べ替える
+         */
+        void UpdateHierarchy();
+        
+        /**
+         * @brief コンポーネント1個を削除してスロットを解放（子は呼び出し側で処理する）
+         */
+        void RemoveComponent(uint32_t index);
+        
+        uint32_t RegisterMesh(const std::shared_ptr<Mesh>& mesh);
+        uint32_t RegisterMaterial(const MaterialData& material);
+        
+        /**
+         * @brief 並列カリングの結果（チャンク i の要素は indices[i * CullingChunkSize] から counts[i] 個）
+         */
+        struct CulledChunks {
+            std::vector<uint32_t> indices;
+            std::vector<uint32_t> counts;
+            std::vector<uint32_t> offsets;     // 結合後の先頭位置（counts の累積）
+            std::vector<uint32_t> rejected;    // フラスタム外として除いた数
+            uint32_t total = 0;
+            uint32_t rejectedTotal = 0;
+        };
+        
+        // チャンクの大きさはスレッド数によらず固定し、結果の順序を一定にする
+        static constexpr uint32_t CullingChunkSize = 4096;
+        static_assert(CullingChunkSize % FrustumCuller::LaneCount == 0, "Culling chunks must start on a SIMD block");
+        
+        /**
+         * @brief フラスタム内で requiredFlags をすべて持つオブジェクトをチャンクごとに並列に集める
+         */
+        void CullChunks(const Camera* camera, uint32_t requiredFlags, CulledChunks& outChunks) const;
+        
+        /**
+         * @brief カリング済みのチャンクから描画リストを作成してソート
+         */
+        void BuildDrawQueues(const Camera* camera, const CulledChunks& chunks, DrawQueue& outOpaque, DrawQueue& outTransparent) const;
+        
+        /**
+         * @brief 最新のAABBに合わせたBVH（追加・削除の後は作り直し、移動の後はリフィット）
+         */
+        const SceneBVH& GetBVH() const;
+        
+        /**
+         * @brief 最新のAABBを写したカリング用の SoA 配列（追加・削除の後は写し直し）
          */
-        bool IsObjectInFrustum(const SceneObject* object, const Camera* camera) const;
+        const FrustumCuller& GetCuller() const;
         
         /**
          * @brief フラスタムプレーンを計算
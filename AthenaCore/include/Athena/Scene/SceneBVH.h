@@ -0,0 +1,124 @@
+#pragma once
+
+#include "../Utils/Math.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief シーンオブジェクトのワールド AABB に対する BVH
+     *
+     * ビン分割の SAH（Surface Area Heuristic）で構築し、ノードは配列に平坦化して持つ。
+     * 子ノードは必ず親より後ろに置くため、リフィットは配列を末尾から1回走査するだけで済む。
+     * 要素のバウンディングもリーフ順に並べ直して持ち、クエリはこの BVH だけで完結する。
+     *
+     * オブジェクトの移動はリフィットで反映する。リフィットを繰り返すとノードが重なって
+     * 探索効率が落ちるため、SAH コストが構築直後の RebuildCostRatio 倍を超えたら作り直す。
+     */
+    class SceneBVH {
+    public:
+        /**
+         * @brief ノード（32 バイト、2つで1キャッシュライン）
+         */
+        struct Node {
+            Vector3 boundsMin;
+            uint32_t leftFirst = 0;    // 内部ノード: 左の子（右の子は leftFirst + 1）、リーフ: 最初の要素
+            Vector3 boundsMax;
+            uint32_t count = 0;        // リーフの要素数（0 は内部ノード）
+
+            bool IsLeaf() const { return count != 0; }
+        };
+        static_assert(sizeof(Node) == 32, "SceneBVH::Node must stay 32 bytes");
+
+        /**
+         * @brief 要素（リーフ順に並べ、ノードと同じ 32 バイト）
+         */
+        struct Item {
+            Vector3 boundsMin;
+            uint32_t index = 0;        // 構築時に渡した配列のインデックス
+            Vector3 boundsMax;
+            uint32_t padding = 0;
+        };
+        static_assert(sizeof(Item) == 32, "SceneBVH::Item must stay 32 bytes");
+
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+        static constexpr uint32_t BinCount = 16;
+        static constexpr uint32_t MaxLeafSize = 4;
+        static constexpr uint32_t ForcedLeafSize = 16;   // これを超える要素はコストによらず分割する
+        static constexpr float RebuildCostRatio = 1.5f;
+
+        /**
+         * @brief 構築（boundsMin[i], boundsMax[i] が要素 i の AABB）
+         */
+        void Build(const Vector3* boundsMin, const Vector3* boundsMax, uint32_t count);
+
+        /**
+         * @brief 要素の AABB を更新してノードを下から再計算（要素数・順序は構築時と同じであること）
+         */
+        void Refit(const Vector3* boundsMin, const Vector3* boundsMax);
+
+        /**
+         * @brief リフィットで探索効率が落ち、作り直すべきか
+         */
+        bool NeedsRebuild() const { return cost > buildCost * RebuildCostRatio; }
+
+        void Clear();
+
+        bool IsEmpty() const { return nodes.empty(); }
+        uint32_t GetItemCount() const { return static_cast<uint32_t>(items.size()); }
+        const std::vector<Node>& GetNodes() const { return nodes; }
+        const std::vector<Item>& GetItems() const { return items; }
+
+        /**
+         * @brief SAH コスト（ルートの表面積で正規化）
+         */
+        float GetCost() const { return cost; }
+        float GetBuildCost() const { return buildCost; }
+
+        // ===== クエリ（結果は構築時のインデックス） =====
+
+        /**
+         * @brief フラスタム（6平面、内側が正）と交差する要素
+         *
+         * 完全に内側のノードは以降の平面判定を省いてまとめて追加する。
+         */
+        void QueryFrustum(const Vector4 planes[6], std::vector<uint32_t>& outIndices) const;
+
+        /**
+         * @brief レイと交差する要素（入射距離との組、順不同）
+         */
+        void QueryRay(const Vector3& origin, const Vector3& direction,
+                      std::vector<std::pair<float, uint32_t>>& outHits) const;
+
+        /**
+         * @brief 点に最も近い AABB を持つ要素（空の場合は InvalidIndex）
+         */
+        uint32_t FindNearest(const Vector3& point) const;
+
+        // ===== 判定（Scene の線形探索と共通） =====
+
+        /**
+         * @brief 点と AABB の距離の2乗（内側は 0）
+         */
+        static float DistanceSquared(const Vector3& point, const Vector3& boundsMin, const Vector3& boundsMax);
+
+        /**
+         * @brief レイと AABB のスラブ判定（交差した場合は入射距離を返す）
+         */
+        static bool IntersectRay(const Vector3& origin, const Vector3& direction,
+                                 const Vector3& boundsMin, const Vector3& boundsMax, float& outDistance);
+
+    private:
+        void UpdateNodeBounds(Node& node) const;
+        void Subdivide(uint32_t nodeIndex, std::vector<uint32_t>& stack);
+        float ComputeCost() const;
+
+        std::vector<Node> nodes;
+        std::vector<Item> items;
+        float cost = 0.0f;
+        float buildCost = 0.0f;
+    };
+
+} // namespace Athena
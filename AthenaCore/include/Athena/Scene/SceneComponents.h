@@ -0,0 +1,217 @@
+#pragma once
+
+#include "../Utils/Math.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Athena {
+
+    /**
+     * @brief シーン内のオブジェクトを指すハンドル
+     *
+     * index はスロット表の位置、generation はスロットを再利用するたびに増える世代。
+     * 削除済みのオブジェクトを指すハンドルは世代が一致しないため無効として扱われる。
+     */
+    struct SceneHandle {
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+        uint32_t index = InvalidIndex;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != InvalidIndex; }
+
+        bool operator==(const SceneHandle& other) const {
+            return index == other.index && generation == other.generation;
+        }
+        bool operator!=(const SceneHandle& other) const { return !(*this == other); }
+
+        uint64_t Hash() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+    };
+
+    /**
+     * @brief シーンオブジェクトのコンポーネント配列（SoA）
+     *
+     * 各配列の i 番目が同じオブジェクトを表す。削除は末尾との入れ替えで行うため
+     * 配列には隙間がなく、毎フレームの処理は必要な配列だけを先頭から順に走査できる。
+     * 密な位置はオブジェクトの削除で変わるため、外部からはハンドルで参照する。
+     *
+     * 親子関係は親の位置の配列で持ち、親は常に子より前に並べる（Scene が並べ替える）。
+     * そのためワールド行列は先頭から1回走査するだけで親から順に更新できる。
+     */
+    struct SceneComponents {
+        enum Flags : uint32_t {
+            Visible = 1 << 0,
+            Transparent = 1 << 1,
+            TransformDirty = 1 << 2,     // ローカルの位置・回転・スケールが変更された
+            WorldChanged = 1 << 3,       // 直前の更新でワールド行列が変わった（子に伝える）
+        };
+
+        static constexpr uint32_t InvalidId = UINT32_MAX;
+
+        std::vector<Vector3> positions;
+        std::vector<Vector3> rotations;          // オイラー角（度）
+        std::vector<Vector3> scales;
+        std::vector<Matrix4x4> localMatrices;    // 親の座標系への変換（位置・回転・スケールから作ったもの）
+        std::vector<Matrix4x4> worldMatrices;
+        std::vector<Vector3> boundsMin;          // ワールド空間の AABB
+        std::vector<Vector3> boundsMax;
+        std::vector<uint32_t> meshIds;           // Scene のメッシュ表のインデックス（なしは InvalidId）
+        std::vector<uint32_t> materialIds;       // Scene のマテリアル表のインデックス
+        std::vector<uint32_t> pipelineIds;       // 描画に使うパイプラインの番号（アプリケーションが割り当てる）
+        std::vector<uint32_t> flags;
+        std::vector<uint32_t> parents;           // 親の位置（ルートは InvalidId）
+        std::vector<uint32_t> parentSlots;       // 親のスロット（削除・並べ替えで parents を作り直す元）
+        std::vector<uint32_t> slots;             // ハンドルのスロット
+        std::vector<std::string> names;          // 毎フレームの処理では参照しない
+
+        uint32_t Size() const { return static_cast<uint32_t>(positions.size()); }
+        bool Empty() const { return positions.empty(); }
+
+        void Reserve(size_t count) {
+            positions.reserve(count);
+            rotations.reserve(count);
+            scales.reserve(count);
+            localMatrices.reserve(count);
+            worldMatrices.reserve(count);
+            boundsMin.reserve(count);
+            boundsMax.reserve(count);
+            meshIds.reserve(count);
+            materialIds.reserve(count);
+            pipelineIds.reserve(count);
+            flags.reserve(count);
+            parents.reserve(count);
+            parentSlots.reserve(count);
+            slots.reserve(count);
+            names.reserve(count);
+        }
+
+        /**
+         * @brief 末尾に追加（ワールド行列・AABB は TransformDirty を立てて後で計算する）
+         *
+         * 親は追加済みのオブジェクトなので、末尾に足しても親が子より前という順序は崩れない。
+         */
+        uint32_t Push(const Vector3& position, const Vector3& rotation, const Vector3& scale,
+                      uint32_t meshId, uint32_t materialId, uint32_t objectFlags, uint32_t slot,
+                      uint32_t parent, uint32_t parentSlot, const std::string& name) {
+            uint32_t index = Size();
+            positions.push_back(position);
+            rotations.push_back(rotation);
+            scales.push_back(scale);
+            localMatrices.emplace_back();
+            worldMatrices.emplace_back();
+            boundsMin.push_back(position);
+            boundsMax.push_back(position);
+            meshIds.push_back(meshId);
+            materialIds.push_back(materialId);
+            pipelineIds.push_back(0);
+            flags.push_back(objectFlags | TransformDirty);
+            parents.push_back(parent);
+            parentSlots.push_back(parentSlot);
+            slots.push_back(slot);
+            names.push_back(name);
+            return index;
+        }
+
+        /**
+         * @brief index の要素を末尾の要素で置き換えて削除
+         */
+        void SwapRemove(uint32_t index) {
+            uint32_t last = Size() - 1;
+            if (index != last) {
+                positions[index] = positions[last];
+                rotations[index] = rotations[last];
+                scales[index] = scales[last];
+                localMatrices[index] = localMatrices[last];
+                worldMatrices[index] = worldMatrices[last];
+                boundsMin[index] = boundsMin[last];
+                boundsMax[index] = boundsMax[last];
+                meshIds[index] = meshIds[last];
+                materialIds[index] = materialIds[last];
+                pipelineIds[index] = pipelineIds[last];
+                flags[index] = flags[last];
+                parents[index] = parents[last];
+                parentSlots[index] = parentSlots[last];
+                slots[index] = slots[last];
+                names[index] = std::move(names[last]);
+            }
+            positions.pop_back();
+            rotations.pop_back();
+            scales.pop_back();
+            localMatrices.pop_back();
+            worldMatrices.pop_back();
+            boundsMin.pop_back();
+            boundsMax.pop_back();
+            meshIds.pop_back();
+            materialIds.pop_back();
+            pipelineIds.pop_back();
+            flags.pop_back();
+            parents.pop_back();
+            parentSlots.pop_back();
+            slots.pop_back();
+            names.pop_back();
+        }
+
+        /**
+         * @brief order[i] 番目の要素を i 番目に移す（parents の付け替えは呼び出し側で行う）
+         */
+        void Permute(const std::vector<uint32_t>& order) {
+            PermuteArray(positions, order);
+            PermuteArray(rotations, order);
+            PermuteArray(scales, order);
+            PermuteArray(localMatrices, order);
+            PermuteArray(worldMatrices, order);
+            PermuteArray(boundsMin, order);
+            PermuteArray(boundsMax, order);
+            PermuteArray(meshIds, order);
+            PermuteArray(materialIds, order);
+            PermuteArray(pipelineIds, order);
+            PermuteArray(flags, order);
+            PermuteArray(parents, order);
+            PermuteArray(parentSlots, order);
+            PermuteArray(slots, order);
+            PermuteArray(names, order);
+        }
+
+        void Clear() {
+            positions.clear();
+            rotations.clear();
+            scales.clear();
+            localMatrices.clear();
+            worldMatrices.clear();
+            boundsMin.clear();
+            boundsMax.clear();
+            meshIds.clear();
+            materialIds.clear();
+            pipelineIds.clear();
+            flags.clear();
+            parents.clear();
+            parentSlots.clear();
+            slots.clear();
+            names.clear();
+        }
+
+    private:
+        template<typename T>
+        static void PermuteArray(std::vector<T>& values, const std::vector<uint32_t>& order) {
+            std::vector<T> permuted;
+            permuted.reserve(values.size());
+            for (uint32_t index : order) {
+                permuted.push_back(std::move(values[index]));
+            }
+            values = std::move(permuted);
+        }
+    };
+
+} // namespace Athena
+
+// std::hash特殊化
+namespace std {
+    template<>
+    struct hash<Athena::SceneHandle> {
+        size_t operator()(const Athena::SceneHandle& handle) const {
+            return std::hash<uint64_t>()(handle.Hash());
+        }
+    };
+}
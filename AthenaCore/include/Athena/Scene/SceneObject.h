@@ -17,10 +17,17 @@ namespace Athena {
         Vector3 scale = Vector3(1.0f, 1.0f, 1.0f);
         
         /**
-         * @brief ワールド変換行列を取得
+         * @brief 変換行列を取得（T * R * S、R は Z * X * Y の順のオイラー角）
+         *
+         * 親を持つオブジェクトでは親の座標系への変換になる。
          */
         Matrix4x4 GetWorldMatrix() const;
         
+        /**
+         * @brief 変換行列（せん断を含まないこと）を位置・回転・スケールに分解
+         */
+        static Transform FromMatrix(const Matrix4x4& matrix);
+        
         /**
          * @brief 各軸での回転を適用
          */
@@ -121,6 +128,16 @@ namespace Athena {
         bool visible = true;
     };
 
+    /**
+     * @brief ModelObject から生成したオブジェクト
+     */
+    struct ModelSceneNode {
+        static constexpr uint32_t InvalidParent = UINT32_MAX;
+        
+        std::shared_ptr<SceneObject> object;
+        uint32_t parent = InvalidParent;    // 同じ配列内の親の位置（親は常に子より前）
+    };
+
     /**
      * @brief モデルオブジェクト（複数のMesh + 共通Transform）
      */
@@ -144,9 +161,12 @@ namespace Athena {
 
         // ===== SceneObject生成 =====
         /**
-         * @brief Modelの各MeshをSceneObjectとして生成
+         * @brief Modelのノード階層をSceneObjectとして生成
+         *
+         * 先頭はモデル全体の Transform を持つルート。各ノードはファイル内の変換を持って親ノードにぶら下がり、
+         * Mesh が1つのノードはそのまま、複数のノードは Mesh ごとの子を持つ。
          */
-        std::vector<std::shared_ptr<SceneObject>> CreateSceneObjects() const;
+        std::vector<ModelSceneNode> CreateSceneObjects() const;
 
         // ===== 表示制御 =====
         void SetVisible(bool visible) { this->visible = visible; }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Athena {
+
+    /**
+     * @brief FNV-1a（64bit）の初期値
+     *
+     * キャッシュのキーなど、実行間・マシン間で変わらないハッシュが必要な場合に使う。
+     * hash = FnvOffsetBasis から始めて HashBytes などで順に加える。
+     */
+    constexpr uint64_t FnvOffsetBasis = 14695981039346656037ull;
+    constexpr uint64_t FnvPrime = 1099511628211ull;
+
+    inline void HashBytes(uint64_t& hash, const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= FnvPrime;
+        }
+    }
+
+    /**
+     * @brief 値のバイト列を加える（パディングを含まない型に限る）
+     */
+    template<typename T>
+    inline void HashValue(uint64_t& hash, const T& value) {
+        HashBytes(hash, &value, sizeof(T));
+    }
+
+    /**
+     * @brief 文字列を終端付きで加える（"ab"+"c" と "a"+"bc" を区別）
+     */
+    inline void HashString(uint64_t& hash, std::string_view text) {
+        HashBytes(hash, text.data(), text.size());
+        HashBytes(hash, "", 1);
+    }
+
+} // namespace Athena
@@ -0,0 +1,99 @@
+#include "Athena/Core/CommandListPool.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    void CommandListPool::Initialize(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type) {
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        this->device = device;
+        this->type = type;
+    }
+
+    void CommandListPool::Shutdown() {
+        std::lock_guard<std::mutex> lock(mutex);
+        available.clear();
+        pending.clear();
+        lists.clear();
+        device.Reset();
+    }
+
+    PooledCommandList& CommandListPool::Acquire(uint64_t completedFenceValue, ID3D12PipelineState* initialState) {
+        PooledCommandList* list = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!device) {
+                throw std::runtime_error("CommandListPool is not initialized");
+            }
+
+            // GPUが完了したものを再利用可能にする
+            for (size_t i = 0; i < pending.size();) {
+                if (pending[i]->fenceValue <= completedFenceValue) {
+                    available.push_back(pending[i]);
+                    pending[i] = pending.back();
+                    pending.pop_back();
+                } else {
+                    ++i;
+                }
+            }
+
+            if (!available.empty()) {
+                list = available.back();
+                available.pop_back();
+            }
+        }
+
+        // リセットは取得したスレッドで行う（ロックの外）
+        if (list) {
+            HRESULT hr = list->allocator->Reset();
+            if (FAILED(hr)) {
+                throw std::runtime_error("Failed to reset pooled command allocator");
+            }
+            hr = list->commandList->Reset(list->allocator.Get(), initialState);
+            if (FAILED(hr)) {
+                throw std::runtime_error("Failed to reset pooled command list");
+            }
+            return *list;
+        }
+
+        // 空きがなければ新しい組を作成（作成直後のリストは記録可能な状態）
+        PooledCommandList created;
+        HRESULT hr = device->CreateCommandAllocator(type, IID_PPV_ARGS(&created.allocator));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create pooled command allocator");
+        }
+
+        hr = device->CreateCommandList(0, type, created.allocator.Get(), initialState, IID_PPV_ARGS(&created.commandList));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create pooled command list");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        lists.push_back(std::move(created));
+        return lists.back();
+    }
+
+    void CommandListPool::Release(PooledCommandList& list, uint64_t fenceValue) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.fenceValue = fenceValue;
+        if (fenceValue == 0) {
+            available.push_back(&list);
+        } else {
+            pending.push_back(&list);
+        }
+    }
+
+    uint32_t CommandListPool::GetCreatedCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<uint32_t>(lists.size());
+    }
+
+    uint32_t CommandListPool::GetPendingCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<uint32_t>(pending.size());
+    }
+
+} // namespace Athena
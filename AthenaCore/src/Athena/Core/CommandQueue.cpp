@@ -65,23 +65,26 @@ namespace Athena {
         queue->ExecuteCommandLists(count, commandLists);
     }
 
-    void CommandQueue::Signal() {
+    uint64_t CommandQueue::Signal() {
         // tFXlCNg
         ++fenceValue;
 
         // GPUɃVOi𑗐M
         // ̒lɒBƂɃtFXXV
         queue->Signal(fence.Get(), fenceValue);
+        return fenceValue;
     }
 
     void CommandQueue::WaitForGPU() {
-        // VOi𑗐M
-        Signal();
+        // VOi𑗐MāA̒l܂őҋ@
+        WaitForFenceValue(Signal());
+    }
 
+    void CommandQueue::WaitForFenceValue(uint64_t value) {
         // GPU܂̃tFXlɒBĂȂꍇ
-        if (fence->GetCompletedValue() < fenceValue) {
+        if (fence->GetCompletedValue() < value) {
             // tFXlɒBƂɃCxg𔭉
-            fence->SetEventOnCompletion(fenceValue, fenceEvent);
+            fence->SetEventOnCompletion(value, fenceEvent);
 
             // Cxgҋ@iGPŮ҂j
             WaitForSingleObject(fenceEvent, INFINITE);
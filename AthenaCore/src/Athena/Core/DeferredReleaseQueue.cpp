@@ -0,0 +1,68 @@
+#include "Athena/Core/DeferredReleaseQueue.h"
+
+namespace Athena {
+
+    void DeferredReleaseQueue::Push(std::shared_ptr<void> object) {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentObjects.push_back(std::move(object));
+    }
+
+    void DeferredReleaseQueue::FinishBatch(uint64_t fenceValue) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (currentObjects.empty()) {
+            return;
+        }
+
+        // 同じフェンス値のバッチはまとめる
+        if (!batches.empty() && batches.back().fenceValue == fenceValue) {
+            auto& objects = batches.back().objects;
+            objects.insert(objects.end(),
+                           std::make_move_iterator(currentObjects.begin()),
+                           std::make_move_iterator(currentObjects.end()));
+        } else {
+            batches.push_back({ fenceValue, std::move(currentObjects) });
+        }
+        currentObjects.clear();
+    }
+
+    void DeferredReleaseQueue::ReleaseCompleted(uint64_t completedFenceValue) {
+        // 破棄中に別のオブジェクトが Release() される場合があるため、ロックの外で破棄する
+        std::vector<std::shared_ptr<void>> completed;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (!batches.empty() && batches.front().fenceValue <= completedFenceValue) {
+                auto& objects = batches.front().objects;
+                completed.insert(completed.end(),
+                                 std::make_move_iterator(objects.begin()),
+                                 std::make_move_iterator(objects.end()));
+                batches.pop_front();
+            }
+        }
+    }
+
+    void DeferredReleaseQueue::Flush() {
+        // 破棄によって追加されたオブジェクトも含め、空になるまで繰り返す
+        for (;;) {
+            std::vector<std::shared_ptr<void>> objects;
+            std::deque<Batch> pending;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (currentObjects.empty() && batches.empty()) {
+                    return;
+                }
+                objects.swap(currentObjects);
+                pending.swap(batches);
+            }
+        }
+    }
+
+    size_t DeferredReleaseQueue::GetPendingCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = currentObjects.size();
+        for (const auto& batch : batches) {
+            count += batch.objects.size();
+        }
+        return count;
+    }
+
+} // namespace Athena
@@ -12,11 +12,13 @@ namespace Athena {
         ID3D12Device* device,
         D3D12_DESCRIPTOR_HEAP_TYPE type,
         uint32_t capacity,
-        bool shaderVisible) {
+        bool shaderVisible,
+        bool threadSafe) {
 
         this->type = type;
         this->capacity = capacity;
         this->shaderVisible = shaderVisible;
+        this->threadSafe = threadSafe;
 
         Logger::Info("Initializing DescriptorHeap (type: %d, capacity: %u, shaderVisible: %s)...",
             type, capacity, shaderVisible ? "Yes" : "No");
@@ -46,7 +48,12 @@ namespace Athena {
         }
 
         // 蓖ĊǗ̏
-        allocated.resize(capacity, false);
+        if (threadSafe) {
+            concurrentAllocator.Reset(capacity);
+        }
+        else {
+            indexAllocator.Reset(capacity);
+        }
 
         Logger::Info("DescriptorHeap initialized (descriptor size: %u bytes)", descriptorSize);
     }
@@ -54,62 +61,60 @@ namespace Athena {
     void DescriptorHeap::Shutdown() {
         Logger::Info("Shutting down DescriptorHeap...");
 
-        allocated.clear();
+        indexAllocator.Reset(0);
+        concurrentAllocator.Reset(0);
         heap.Reset();
 
         Logger::Info("DescriptorHeap shut down successfully");
     }
 
     DescriptorHandle DescriptorHeap::Allocate() {
-        // t[ȃCfbNX
-        for (uint32_t i = nextFreeIndex; i < capacity; ++i) {
-            if (!allocated[i]) {
-                allocated[i] = true;
-                nextFreeIndex = i + 1;
-
-                // nhvZ
-                DescriptorHandle handle;
-                handle.index = i;
-                handle.cpu.ptr = cpuStart.ptr + i * descriptorSize;
-
-                if (shaderVisible) {
-                    handle.gpu.ptr = gpuStart.ptr + i * descriptorSize;
-                }
-
-                return handle;
-            }
+        uint32_t index = threadSafe ? concurrentAllocator.Allocate() : indexAllocator.Allocate();
+        if (index == DescriptorIndexAllocator::InvalidIndex) {
+            throw std::runtime_error("Descriptor heap is full");
         }
+        return GetHandle(index);
+    }
 
-        // ŏČ
-        for (uint32_t i = 0; i < nextFreeIndex; ++i) {
-            if (!allocated[i]) {
-                allocated[i] = true;
-                nextFreeIndex = i + 1;
-
-                DescriptorHandle handle;
-                handle.index = i;
-                handle.cpu.ptr = cpuStart.ptr + i * descriptorSize;
+    DescriptorHandle DescriptorHeap::AllocateRange(uint32_t count) {
+        uint32_t index = threadSafe ? concurrentAllocator.AllocateRange(count) : indexAllocator.AllocateRange(count);
+        if (index == DescriptorIndexAllocator::InvalidIndex) {
+            throw std::runtime_error("Descriptor heap has no contiguous range of the requested size");
+        }
+        return GetHandle(index);
+    }
 
-                if (shaderVisible) {
-                    handle.gpu.ptr = gpuStart.ptr + i * descriptorSize;
-                }
+    void DescriptorHeap::Free(const DescriptorHandle& handle) {
+        FreeRange(handle, 1);
+    }
 
-                return handle;
-            }
+    void DescriptorHeap::FreeRange(const DescriptorHandle& first, uint32_t count) {
+        if (!first.IsValid()) {
+            return;
         }
 
-        throw std::runtime_error("Descriptor heap is full");
+        if (threadSafe) {
+            concurrentAllocator.Free(first.index, count);
+        }
+        else {
+            indexAllocator.Free(first.index, count);
+        }
     }
 
-    void DescriptorHeap::Free(const DescriptorHandle& handle) {
-        if (handle.index < capacity && allocated[handle.index]) {
-            allocated[handle.index] = false;
+    DescriptorHandle DescriptorHeap::GetHandle(uint32_t index) const {
+        DescriptorHandle handle = {};
+        handle.index = index;
+        handle.cpu.ptr = cpuStart.ptr + static_cast<SIZE_T>(index) * descriptorSize;
 
-            // ̃t[CfbNXXV
-            if (handle.index < nextFreeIndex) {
-                nextFreeIndex = handle.index;
-            }
+        if (shaderVisible) {
+            handle.gpu.ptr = gpuStart.ptr + static_cast<UINT64>(index) * descriptorSize;
         }
+
+        return handle;
+    }
+
+    uint32_t DescriptorHeap::GetFreeCount() const {
+        return threadSafe ? concurrentAllocator.GetFreeCount() : indexAllocator.GetFreeCount();
     }
 
 } // namespace Athena
\ No newline at end of file
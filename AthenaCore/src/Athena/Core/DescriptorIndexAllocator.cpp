@@ -0,0 +1,242 @@
+#include "Athena/Core/DescriptorIndexAllocator.h"
+#include <algorithm>
+#include <bit>
+
+namespace Athena {
+
+    namespace {
+        uint64_t MakeMask(uint32_t bit, uint32_t count) {
+            uint64_t bits = (count >= 64) ? ~0ull : ((1ull << count) - 1);
+            return bits << bit;
+        }
+
+        uint64_t MakeInitialWord(uint32_t word, uint32_t capacity) {
+            uint32_t remaining = capacity - word * 64;
+            return MakeMask(0, std::min(remaining, 64u));
+        }
+    }
+
+    // =====================================================
+    // DescriptorIndexAllocator
+    // =====================================================
+
+    void DescriptorIndexAllocator::Reset(uint32_t capacity) {
+        this->capacity = capacity;
+        freeCount = capacity;
+        summaryHint = 0;
+
+        uint32_t wordCount = (capacity + 63) / 64;
+        freeBits.assign(wordCount, 0);
+        summaryBits.assign((wordCount + 63) / 64, 0);
+
+        for (uint32_t word = 0; word < wordCount; ++word) {
+            freeBits[word] = MakeInitialWord(word, capacity);
+            summaryBits[word / 64] |= 1ull << (word % 64);
+        }
+    }
+
+    uint32_t DescriptorIndexAllocator::Allocate() {
+        while (summaryHint < summaryBits.size() && summaryBits[summaryHint] == 0) {
+            summaryHint++;
+        }
+        if (summaryHint >= summaryBits.size()) {
+            return InvalidIndex;
+        }
+
+        uint32_t word = summaryHint * 64 + static_cast<uint32_t>(std::countr_zero(summaryBits[summaryHint]));
+        uint32_t bit = static_cast<uint32_t>(std::countr_zero(freeBits[word]));
+
+        freeBits[word] &= ~(1ull << bit);
+        if (freeBits[word] == 0) {
+            summaryBits[word / 64] &= ~(1ull << (word % 64));
+        }
+        freeCount--;
+        return word * 64 + bit;
+    }
+
+    uint32_t DescriptorIndexAllocator::AllocateRange(uint32_t count) {
+        if (count == 0 || count > freeCount) {
+            return InvalidIndex;
+        }
+        if (count == 1) {
+            return Allocate();
+        }
+
+        // 空き区間を先頭から順に調べる（区間の数に比例）
+        uint32_t start = FindNextFree(summaryHint * 64 * 64);
+        while (start < capacity) {
+            uint32_t end = FindNextUsed(start);
+            if (end - start >= count) {
+                MarkAllocated(start, count);
+                return start;
+            }
+            start = FindNextFree(end);
+        }
+        return InvalidIndex;
+    }
+
+    void DescriptorIndexAllocator::Free(uint32_t index, uint32_t count) {
+        if (index >= capacity || count == 0) {
+            return;
+        }
+        count = std::min(count, capacity - index);
+
+        uint32_t end = index + count;
+        while (index < end) {
+            uint32_t word = index / 64;
+            uint32_t bit = index % 64;
+            uint32_t length = std::min(64 - bit, end - index);
+
+            // 割り当て済みのビットのみ空きに戻す
+            uint64_t released = MakeMask(bit, length) & ~freeBits[word];
+            freeBits[word] |= released;
+            freeCount += static_cast<uint32_t>(std::popcount(released));
+
+            if (freeBits[word] != 0) {
+                summaryBits[word / 64] |= 1ull << (word % 64);
+                summaryHint = std::min(summaryHint, word / 64);
+            }
+            index += length;
+        }
+    }
+
+    bool DescriptorIndexAllocator::IsAllocated(uint32_t index) const {
+        return index < capacity && ((freeBits[index / 64] >> (index % 64)) & 1) == 0;
+    }
+
+    uint32_t DescriptorIndexAllocator::FindNextFree(uint32_t start) const {
+        if (start >= capacity) {
+            return capacity;
+        }
+
+        uint32_t word = start / 64;
+        uint64_t bits = freeBits[word] & (~0ull << (start % 64));
+        if (bits != 0) {
+            return word * 64 + static_cast<uint32_t>(std::countr_zero(bits));
+        }
+
+        // 以降のワードは上位ビットマップで読み飛ばす
+        uint32_t nextWord = word + 1;
+        for (uint32_t summary = nextWord / 64; summary < summaryBits.size(); ++summary) {
+            uint64_t summaryMask = summaryBits[summary];
+            if (summary == nextWord / 64) {
+                summaryMask &= ~0ull << (nextWord % 64);
+            }
+            if (summaryMask != 0) {
+                uint32_t found = summary * 64 + static_cast<uint32_t>(std::countr_zero(summaryMask));
+                return found * 64 + static_cast<uint32_t>(std::countr_zero(freeBits[found]));
+            }
+        }
+        return capacity;
+    }
+
+    uint32_t DescriptorIndexAllocator::FindNextUsed(uint32_t start) const {
+        if (start >= capacity) {
+            return capacity;
+        }
+
+        uint32_t word = start / 64;
+        uint64_t bits = ~freeBits[word] & (~0ull << (start % 64));
+        while (bits == 0) {
+            if (++word >= freeBits.size()) {
+                return capacity;
+            }
+            bits = ~freeBits[word];
+        }
+
+        // 容量外のビットは使用中扱いになるため容量で打ち切る
+        return std::min(word * 64 + static_cast<uint32_t>(std::countr_zero(bits)), capacity);
+    }
+
+    void DescriptorIndexAllocator::MarkAllocated(uint32_t start, uint32_t count) {
+        uint32_t end = start + count;
+        while (start < end) {
+            uint32_t word = start / 64;
+            uint32_t bit = start % 64;
+            uint32_t length = std::min(64 - bit, end - start);
+
+            freeBits[word] &= ~MakeMask(bit, length);
+            if (freeBits[word] == 0) {
+                summaryBits[word / 64] &= ~(1ull << (word % 64));
+            }
+            start += length;
+        }
+        freeCount -= count;
+    }
+
+    // =====================================================
+    // ConcurrentDescriptorIndexAllocator
+    // =====================================================
+
+    void ConcurrentDescriptorIndexAllocator::Reset(uint32_t capacity) {
+        this->capacity = capacity;
+        wordCount = (capacity + 63) / 64;
+        freeBits = std::make_unique<std::atomic<uint64_t>[]>(wordCount);
+
+        for (uint32_t word = 0; word < wordCount; ++word) {
+            freeBits[word].store(MakeInitialWord(word, capacity), std::memory_order_relaxed);
+        }
+        nextWord.store(0, std::memory_order_relaxed);
+        freeCount.store(capacity, std::memory_order_release);
+    }
+
+    uint32_t ConcurrentDescriptorIndexAllocator::Allocate() {
+        return AllocateRange(1);
+    }
+
+    uint32_t ConcurrentDescriptorIndexAllocator::AllocateRange(uint32_t count) {
+        if (count == 0 || count > MaxRangeCount || wordCount == 0) {
+            return InvalidIndex;
+        }
+
+        uint32_t startWord = nextWord.load(std::memory_order_relaxed) % wordCount;
+        for (uint32_t i = 0; i < wordCount; ++i) {
+            uint32_t word = (startWord + i) % wordCount;
+            uint64_t bits = freeBits[word].load(std::memory_order_relaxed);
+
+            while (bits != 0) {
+                // count 個連続した空きビットの先頭を求める
+                uint64_t runs = bits;
+                for (uint32_t k = 1; k < count && runs != 0; ++k) {
+                    runs &= bits >> k;
+                }
+                if (runs == 0) {
+                    break;
+                }
+
+                uint32_t bit = static_cast<uint32_t>(std::countr_zero(runs));
+                uint64_t remaining = bits & ~MakeMask(bit, count);
+                if (freeBits[word].compare_exchange_weak(bits, remaining,
+                                                         std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    if (remaining == 0) {
+                        nextWord.store((word + 1) % wordCount, std::memory_order_relaxed);
+                    }
+                    freeCount.fetch_sub(count, std::memory_order_relaxed);
+                    return word * 64 + bit;
+                }
+                // 失敗時は bits が最新値に更新されているので再試行
+            }
+        }
+        return InvalidIndex;
+    }
+
+    void ConcurrentDescriptorIndexAllocator::Free(uint32_t index, uint32_t count) {
+        if (index >= capacity || count == 0) {
+            return;
+        }
+        count = std::min(count, capacity - index);
+
+        uint32_t end = index + count;
+        while (index < end) {
+            uint32_t word = index / 64;
+            uint32_t bit = index % 64;
+            uint32_t length = std::min(64 - bit, end - index);
+
+            uint64_t mask = MakeMask(bit, length);
+            uint64_t previous = freeBits[word].fetch_or(mask, std::memory_order_acq_rel);
+            freeCount.fetch_add(static_cast<uint32_t>(std::popcount(mask & ~previous)), std::memory_order_relaxed);
+            index += length;
+        }
+    }
+
+} // namespace Athena
\ No newline at end of file
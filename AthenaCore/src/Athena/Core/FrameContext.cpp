@@ -0,0 +1,85 @@
+#include "Athena/Core/FrameContext.h"
+#include "Athena/Core/CommandQueue.h"
+#include "Athena/Utils/Logger.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    void FrameContextRing::Initialize(ID3D12Device* device, CommandQueue* queue, uint32_t frameCount) {
+        if (!device || !queue) {
+            throw std::invalid_argument("Device or command queue is null");
+        }
+        if (frameCount == 0) {
+            throw std::invalid_argument("Frame count must be non-zero");
+        }
+
+        this->queue = queue;
+        frames.resize(frameCount);
+
+        for (uint32_t i = 0; i < frameCount; ++i) {
+            frames[i].index = i;
+            HRESULT hr = device->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE_DIRECT,
+                IID_PPV_ARGS(&frames[i].commandAllocator)
+            );
+            if (FAILED(hr)) {
+                throw std::runtime_error("Failed to create frame command allocator");
+            }
+        }
+
+        commandListPool.Initialize(device, D3D12_COMMAND_LIST_TYPE_DIRECT);
+
+        // 最初の BeginFrame() でスロット0から使う
+        currentFrame = frameCount - 1;
+        stallCount = 0;
+
+        Logger::Info("FrameContextRing initialized: %u frames in flight", frameCount);
+    }
+
+    void FrameContextRing::Shutdown() {
+        if (!queue) {
+            return;
+        }
+
+        WaitForIdle();
+        commandListPool.Shutdown();
+        frames.clear();
+        queue = nullptr;
+    }
+
+    FrameContext& FrameContextRing::BeginFrame() {
+        currentFrame = (currentFrame + 1) % static_cast<uint32_t>(frames.size());
+        FrameContext& frame = frames[currentFrame];
+
+        // スロットの前回のフレームがGPUで処理中の場合のみ待機
+        if (frame.fenceValue != 0 && !queue->IsFenceComplete(frame.fenceValue)) {
+            stallCount++;
+            queue->WaitForFenceValue(frame.fenceValue);
+        }
+
+        releaseQueue.ReleaseCompleted(queue->GetCompletedValue());
+
+        HRESULT hr = frame.commandAllocator->Reset();
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to reset frame command allocator");
+        }
+        return frame;
+    }
+
+    uint64_t FrameContextRing::EndFrame() {
+        FrameContext& frame = frames[currentFrame];
+        frame.fenceValue = queue->Signal();
+        releaseQueue.FinishBatch(frame.fenceValue);
+        return frame.fenceValue;
+    }
+
+    void FrameContextRing::WaitForIdle() {
+        if (!queue) {
+            return;
+        }
+
+        queue->WaitForGPU();
+        releaseQueue.Flush();
+    }
+
+} // namespace Athena
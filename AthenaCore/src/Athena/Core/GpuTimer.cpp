@@ -0,0 +1,179 @@
+#include "Athena/Core/GpuTimer.h"
+#include "Athena/Utils/Logger.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    void GpuTimer::Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue,
+                              uint32_t maxScopesPerFrame, uint32_t frameLatency) {
+        if (!device || !commandQueue) {
+            throw std::invalid_argument("Device or command queue is null");
+        }
+        if (maxScopesPerFrame == 0 || frameLatency == 0) {
+            throw std::invalid_argument("GpuTimer requires at least one scope and one frame");
+        }
+
+        maxScopes = maxScopesPerFrame;
+        slots.assign(frameLatency, FrameSlot{});
+        results.clear();
+        currentSlot = 0;
+        frameActive = false;
+
+        HRESULT hr = commandQueue->GetTimestampFrequency(&timestampFrequency);
+        if (FAILED(hr) || timestampFrequency == 0) {
+            throw std::runtime_error("Failed to get timestamp frequency");
+        }
+
+        // タイムスタンプクエリヒープ（区間ごとに開始・終了の2クエリ）
+        const uint32_t queryCount = maxScopes * 2 * frameLatency;
+
+        D3D12_QUERY_HEAP_DESC queryHeapDesc = {};
+        queryHeapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+        queryHeapDesc.Count = queryCount;
+        queryHeapDesc.NodeMask = 0;
+
+        hr = device->CreateQueryHeap(&queryHeapDesc, IID_PPV_ARGS(&queryHeap));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create timestamp query heap");
+        }
+
+        // リードバックバッファ
+        D3D12_RESOURCE_DESC resourceDesc = {};
+        resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        resourceDesc.Alignment = 0;
+        resourceDesc.Width = static_cast<uint64_t>(queryCount) * sizeof(uint64_t);
+        resourceDesc.Height = 1;
+        resourceDesc.DepthOrArraySize = 1;
+        resourceDesc.MipLevels = 1;
+        resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+        resourceDesc.SampleDesc.Count = 1;
+        resourceDesc.SampleDesc.Quality = 0;
+        resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+        resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = D3D12_HEAP_TYPE_READBACK;
+        heapProps.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapProps.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+        heapProps.CreationNodeMask = 1;
+        heapProps.VisibleNodeMask = 1;
+
+        hr = device->CreateCommittedResource(
+            &heapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &resourceDesc,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            nullptr,
+            IID_PPV_ARGS(&readbackBuffer)
+        );
+
+        if (FAILED(hr)) {
+            queryHeap.Reset();
+            throw std::runtime_error("Failed to create timestamp readback buffer");
+        }
+
+        Logger::Info("GpuTimer initialized: %u scopes x %u frames", maxScopes, frameLatency);
+    }
+
+    void GpuTimer::Shutdown() {
+        readbackBuffer.Reset();
+        queryHeap.Reset();
+        slots.clear();
+        results.clear();
+        frameActive = false;
+    }
+
+    void GpuTimer::BeginFrame() {
+        if (!queryHeap) return;
+
+        FrameSlot& slot = slots[currentSlot];
+
+        // 結果は読み戻した1フレーム分のみ保持する（無効化されたパスの古い値を残さない）
+        results.clear();
+
+        // frameLatency フレーム前に解決した結果を読み戻す
+        if (slot.resolved && !slot.scopeNames.empty()) {
+            const uint32_t base = GetQueryBase(currentSlot);
+            const uint32_t count = static_cast<uint32_t>(slot.scopeNames.size()) * 2;
+
+            D3D12_RANGE readRange = {};
+            readRange.Begin = static_cast<SIZE_T>(base) * sizeof(uint64_t);
+            readRange.End = readRange.Begin + static_cast<SIZE_T>(count) * sizeof(uint64_t);
+
+            void* mapped = nullptr;
+            if (SUCCEEDED(readbackBuffer->Map(0, &readRange, &mapped))) {
+                const uint64_t* timestamps = reinterpret_cast<const uint64_t*>(
+                    static_cast<const uint8_t*>(mapped) + readRange.Begin);
+
+                for (size_t i = 0; i < slot.scopeNames.size(); ++i) {
+                    uint64_t begin = timestamps[i * 2];
+                    uint64_t end = timestamps[i * 2 + 1];
+                    if (end < begin) continue;
+
+                    results[slot.scopeNames[i]] = static_cast<float>(
+                        static_cast<double>(end - begin) * 1000.0 / static_cast<double>(timestampFrequency));
+                }
+
+                D3D12_RANGE writeRange = { 0, 0 };
+                readbackBuffer->Unmap(0, &writeRange);
+            }
+        }
+
+        slot.scopeNames.clear();
+        slot.resolved = false;
+        frameActive = true;
+    }
+
+    uint32_t GpuTimer::BeginScope(ID3D12GraphicsCommandList* commandList, const std::string& name) {
+        if (!queryHeap || !frameActive || !commandList) {
+            return InvalidScope;
+        }
+
+        FrameSlot& slot = slots[currentSlot];
+        if (slot.scopeNames.size() >= maxScopes) {
+            Logger::Warning("GpuTimer: scope limit reached, '%s' is not measured", name.c_str());
+            return InvalidScope;
+        }
+
+        uint32_t scope = static_cast<uint32_t>(slot.scopeNames.size());
+        slot.scopeNames.push_back(name);
+
+        commandList->EndQuery(queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, GetQueryBase(currentSlot) + scope * 2);
+        return scope;
+    }
+
+    void GpuTimer::EndScope(ID3D12GraphicsCommandList* commandList, uint32_t scope) {
+        if (!queryHeap || !frameActive || !commandList || scope == InvalidScope) {
+            return;
+        }
+        if (scope >= slots[currentSlot].scopeNames.size()) {
+            return;
+        }
+
+        commandList->EndQuery(queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, GetQueryBase(currentSlot) + scope * 2 + 1);
+    }
+
+    void GpuTimer::EndFrame(ID3D12GraphicsCommandList* commandList) {
+        if (!queryHeap || !frameActive || !commandList) {
+            return;
+        }
+
+        FrameSlot& slot = slots[currentSlot];
+        if (!slot.scopeNames.empty()) {
+            const uint32_t base = GetQueryBase(currentSlot);
+            const uint32_t count = static_cast<uint32_t>(slot.scopeNames.size()) * 2;
+            commandList->ResolveQueryData(queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, base, count,
+                                          readbackBuffer.Get(), static_cast<uint64_t>(base) * sizeof(uint64_t));
+            slot.resolved = true;
+        }
+
+        currentSlot = (currentSlot + 1) % static_cast<uint32_t>(slots.size());
+        frameActive = false;
+    }
+
+    float GpuTimer::GetScopeMs(const std::string& name) const {
+        auto it = results.find(name);
+        return it != results.end() ? it->second : -1.0f;
+    }
+
+} // namespace Athena
\ No newline at end of file
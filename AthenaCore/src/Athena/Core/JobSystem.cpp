@@ -0,0 +1,138 @@
+#include "Athena/Core/JobSystem.h"
+#include "Athena/Utils/Logger.h"
+
+namespace Athena {
+
+    namespace {
+        // ジョブの実行中か（ジョブ内からの ParallelFor は入れ子にせずその場で実行する）
+        thread_local bool insideJob = false;
+    }
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+    }
+
+    void JobSystem::Initialize(uint32_t workerThreadCount) {
+        Shutdown();
+
+        stopping = false;
+        for (uint32_t i = 0; i < workerThreadCount; ++i) {
+            workers.emplace_back([this]() { WorkerLoop(); });
+        }
+
+        Logger::Info("JobSystem initialized (%u worker threads)", workerThreadCount);
+    }
+
+    void JobSystem::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        batchAvailable.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+    }
+
+    uint32_t JobSystem::GetDefaultWorkerCount() {
+        uint32_t coreCount = std::thread::hardware_concurrency();
+        return coreCount > 1 ? coreCount - 1 : 0;
+    }
+
+    void JobSystem::ParallelFor(uint32_t jobCount, const std::function<void(uint32_t)>& job) {
+        if (jobCount == 0) {
+            return;
+        }
+        if (workers.empty() || jobCount == 1 || insideJob) {
+            for (uint32_t i = 0; i < jobCount; ++i) {
+                job(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> dispatchLock(dispatchMutex);
+
+        Batch batch;
+        batch.job = &job;
+        batch.jobCount = jobCount;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            currentBatch = &batch;
+            batchSerial++;
+        }
+        batchAvailable.notify_all();
+
+        RunJobs(batch);
+
+        // batch はこの関数のスタックにあるため、参照しているワーカーがいなくなるまで待つ
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            currentBatch = nullptr;
+            workersIdle.wait(lock, [this]() { return activeWorkers == 0; });
+        }
+
+        if (batch.error) {
+            std::rethrow_exception(batch.error);
+        }
+    }
+
+    void JobSystem::Run(uint32_t jobCount, const std::function<void(uint32_t)>& job) {
+        JobSystem* jobSystem = GetGlobal();
+        if (jobSystem) {
+            jobSystem->ParallelFor(jobCount, job);
+            return;
+        }
+        for (uint32_t i = 0; i < jobCount; ++i) {
+            job(i);
+        }
+    }
+
+    void JobSystem::WorkerLoop() {
+        uint64_t seenSerial = 0;
+        while (true) {
+            Batch* batch = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                batchAvailable.wait(lock, [&]() {
+                    return stopping || (currentBatch && batchSerial != seenSerial);
+                });
+                if (stopping) {
+                    return;
+                }
+                batch = currentBatch;
+                seenSerial = batchSerial;
+                activeWorkers++;
+            }
+
+            RunJobs(*batch);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                activeWorkers--;
+            }
+            workersIdle.notify_all();
+        }
+    }
+
+    void JobSystem::RunJobs(Batch& batch) {
+        insideJob = true;
+        while (true) {
+            uint32_t jobIndex = batch.nextJob.fetch_add(1, std::memory_order_relaxed);
+            if (jobIndex >= batch.jobCount) {
+                break;
+            }
+            try {
+                (*batch.job)(jobIndex);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(batch.errorMutex);
+                if (!batch.error) {
+                    batch.error = std::current_exception();
+                }
+            }
+        }
+        insideJob = false;
+    }
+
+} // namespace Athena
@@ -0,0 +1,122 @@
+#include "Athena/Core/TransientDescriptorAllocator.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Athena {
+
+    void TransientDescriptorAllocator::Initialize(
+        ID3D12Device* device,
+        D3D12_DESCRIPTOR_HEAP_TYPE type,
+        uint32_t descriptorsPerFrame,
+        uint32_t frameCount) {
+
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+        if (type != D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV && type != D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER) {
+            throw std::invalid_argument("Transient descriptors must be CBV/SRV/UAV or sampler");
+        }
+        if (descriptorsPerFrame == 0 || frameCount == 0) {
+            throw std::invalid_argument("Transient descriptor partition size and count must be non-zero");
+        }
+
+        this->device = device;
+        this->type = type;
+        this->descriptorsPerFrame = descriptorsPerFrame;
+
+        D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+        heapDesc.Type = type;
+        heapDesc.NumDescriptors = descriptorsPerFrame * frameCount;
+        heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+        heapDesc.NodeMask = 0;
+
+        HRESULT hr = device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&heap));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create transient descriptor heap");
+        }
+
+        descriptorSize = device->GetDescriptorHandleIncrementSize(type);
+        cpuStart = heap->GetCPUDescriptorHandleForHeapStart();
+        gpuStart = heap->GetGPUDescriptorHandleForHeapStart();
+
+        partitionFences.assign(frameCount, 0);
+        currentPartition = 0;
+        usedCount = 0;
+        peakUsedCount = 0;
+
+        Logger::Info("TransientDescriptorAllocator initialized: %u descriptors x %u frames",
+                    descriptorsPerFrame, frameCount);
+    }
+
+    void TransientDescriptorAllocator::Shutdown() {
+        heap.Reset();
+        device.Reset();
+        partitionFences.clear();
+        usedCount = 0;
+    }
+
+    bool TransientDescriptorAllocator::CanBeginFrame(uint64_t completedFenceValue) const {
+        if (partitionFences.empty()) {
+            return true;
+        }
+
+        uint32_t next = (currentPartition + 1) % static_cast<uint32_t>(partitionFences.size());
+        return partitionFences[next] <= completedFenceValue;
+    }
+
+    void TransientDescriptorAllocator::BeginFrame(uint64_t completedFenceValue) {
+        if (partitionFences.empty()) {
+            return;
+        }
+        if (!CanBeginFrame(completedFenceValue)) {
+            throw std::runtime_error("Transient descriptor partition is still in use by the GPU");
+        }
+
+        currentPartition = (currentPartition + 1) % static_cast<uint32_t>(partitionFences.size());
+        usedCount = 0;
+    }
+
+    void TransientDescriptorAllocator::EndFrame(uint64_t fenceValue) {
+        if (!partitionFences.empty()) {
+            partitionFences[currentPartition] = fenceValue;
+        }
+    }
+
+    DescriptorHandle TransientDescriptorAllocator::Allocate(uint32_t count) {
+        if (!heap) {
+            throw std::runtime_error("TransientDescriptorAllocator is not initialized");
+        }
+        if (count == 0 || usedCount + count > descriptorsPerFrame) {
+            throw std::runtime_error("Transient descriptor partition is full");
+        }
+
+        uint32_t index = currentPartition * descriptorsPerFrame + usedCount;
+        usedCount += count;
+        peakUsedCount = std::max(peakUsedCount, usedCount);
+
+        DescriptorHandle handle = {};
+        handle.index = index;
+        handle.cpu.ptr = cpuStart.ptr + static_cast<SIZE_T>(index) * descriptorSize;
+        handle.gpu.ptr = gpuStart.ptr + static_cast<UINT64>(index) * descriptorSize;
+        return handle;
+    }
+
+    DescriptorHandle TransientDescriptorAllocator::CopyTable(D3D12_CPU_DESCRIPTOR_HANDLE source, uint32_t count) {
+        DescriptorHandle table = Allocate(count);
+        device->CopyDescriptorsSimple(count, table.cpu, source, type);
+        return table;
+    }
+
+    DescriptorHandle TransientDescriptorAllocator::CopyTable(const D3D12_CPU_DESCRIPTOR_HANDLE* sources, uint32_t count) {
+        DescriptorHandle table = Allocate(count);
+
+        D3D12_CPU_DESCRIPTOR_HANDLE destination = table.cpu;
+        for (uint32_t i = 0; i < count; ++i) {
+            device->CopyDescriptorsSimple(1, destination, sources[i], type);
+            destination.ptr += descriptorSize;
+        }
+        return table;
+    }
+
+} // namespace Athena
\ No newline at end of file
@@ -1,7 +1,12 @@
 #include "Athena/RenderGraph/GeometryPass.h"
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Resources/RootSignatureCache.h"
+#include "Athena/Resources/ShaderCache.h"
 #include "Athena/Utils/Logger.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Resources/ConstantBufferAllocator.h"
 #include <d3dcompiler.h>
+#include <cstring>
 #include <stdexcept>
 
 namespace Athena {
@@ -15,20 +20,19 @@ namespace Athena {
         // デバイス参照を保存
         device = setupData.device;
         
-        // ルートシグネチャを作成（共通）
-        CreateRootSignature(setupData.device);
+        // 全パス共通のルートシグネチャ（パス間で切り替えない）
+        rootSignature = RootSignatureCache::LoadGlobalRootSignature(setupData.device);
         
-        // パイプライン状態を作成（デフォルトはフォワード）
-        CreateForwardPipelineState(setupData.device);
-
-        // バッファ初期化
-        constantBuffer = std::make_unique<Buffer>();
-        constantBuffer->Initialize(
-            setupData.device,
-            sizeof(GeometryConstants),
-            BufferType::Constant,
-            D3D12_HEAP_TYPE_UPLOAD
-        );
+        // シェーダー（ピクセルシェーダーはアーカイブに最新のものがあればそれを使う）
+        vertexShader = CompileShader(L"../shaders/GeometryVS.hlsl", "main", "vs_5_1");
+        pixelShaders.Initialize(GetPixelShaderPermutations(), ShaderArchive::GetGlobal());
+        deferredKeyword = pixelShaders.GetKeywordMask("DEFERRED");
+        textureKeyword = pixelShaders.GetKeywordMask("USE_TEXTURE");
+        pipelines.assign(pixelShaders.GetPermutationCount(), nullptr);
+
+        // パイプライン状態を要求（切り替え時に待たないよう、ディファード用も先に作成を始める）
+        CreatePipelineState(setupData.device, textureKeyword);
+        CreatePipelineState(setupData.device, textureKeyword | deferredKeyword);
 
         // 既にキャッシュされた頂点データがあれば、バッファを作成
         if (!cachedVertices.empty() && !cachedIndices.empty()) {
@@ -43,17 +47,14 @@ namespace Athena {
 
     void GeometryPass::Execute(const PassExecuteData& executeData) {
         auto* commandList = executeData.commandList;
+        if (!executeData.constantAllocator) {
+            throw std::runtime_error("GeometryPass: PassExecuteData::constantAllocator is not set");
+        }
 
-        // レンダリングモードに応じてパイプライン状態を更新
         static RenderMode lastMode = RenderMode::Forward;  // 初期値
         if (renderMode != lastMode) {
-            if (renderMode == RenderMode::Forward) {
-                CreateForwardPipelineState(device);
-                Logger::Info("GeometryPass: Switched to Forward rendering mode");
-            } else {
-                CreateDeferredPipelineState(device);
-                Logger::Info("GeometryPass: Switched to Deferred rendering mode");
-            }
+            Logger::Info("GeometryPass: Switched to %s rendering mode",
+                       (renderMode == RenderMode::Forward) ? "Forward" : "Deferred");
             lastMode = renderMode;
         }
 
@@ -72,7 +73,8 @@ namespace Athena {
         constants.lightDirection = lightDirection;
         constants.lightColor = lightColor;
 
-        constantBuffer->Upload(&constants, sizeof(GeometryConstants));
+        // 描画ごとにフレーム単位のアロケータの新しい領域へ書き込む
+        D3D12_GPU_VIRTUAL_ADDRESS constantAddress = executeData.constantAllocator->Allocate(constants).gpuAddress;
 
         // レンダーターゲット設定（モード別）
         if (renderMode == RenderMode::Deferred && gbufferRTVHandles[0].ptr != 0) {
@@ -116,14 +118,38 @@ namespace Athena {
             Logger::Info("GeometryPass: G-Buffer render targets configured (MRT)");
         }
 
+        // モードとテクスチャの有無からバリアントを選ぶ（初めて使うバリアントはここで要求）
+        ShaderPermutationKey key = 0;
+        if (renderMode == RenderMode::Deferred) {
+            key |= deferredKeyword;
+        }
+        if (executeData.srvHeap) {
+            key |= textureKeyword;
+        }
+        if (key < pipelines.size() && !pipelines[key] && device) {
+            try {
+                CreatePipelineState(device, key);
+            }
+            catch (const std::exception& e) {
+                Logger::Error("GeometryPass: Failed to create pipeline variant %u: %s", key, e.what());
+            }
+        }
+
+        // PSO の作成が終わるまでは描画しない
+        PipelineHandle pipeline = (key < pipelines.size()) ? pipelines[key] : nullptr;
+        ID3D12PipelineState* pipelineState = pipeline ? pipeline->Get() : nullptr;
+        if (!pipelineState) {
+            Logger::Warning("GeometryPass: Pipeline state %s, skipping draw",
+                          (pipeline && pipeline->IsFailed()) ? "failed" : "still compiling");
+            return;
+        }
+
         // パイプライン設定
-        commandList->SetPipelineState(pipelineState.Get());
+        commandList->SetPipelineState(pipelineState);
         commandList->SetGraphicsRootSignature(rootSignature.Get());
 
         // 定数バッファ設定
-        commandList->SetGraphicsRootConstantBufferView(
-            0, constantBuffer->GetGPUVirtualAddress()
-        );
+        commandList->SetGraphicsRootConstantBufferView(RootSignatureCache::Constants, constantAddress);
 
         // テクスチャ設定（メインレンダリングとの統合）
         if (executeData.srvHeap) {
@@ -138,7 +164,10 @@ namespace Athena {
                 // メインレンダリングのテクスチャSRVはCBVの後（インデックス1）
                 srvHandle.ptr += device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
             }
-            commandList->SetGraphicsRootDescriptorTable(1, srvHandle);
+            commandList->SetGraphicsRootDescriptorTable(RootSignatureCache::Textures, srvHandle);
+            if (mainTexture) {
+                mainTexture->MarkUsed();
+            }
             
             Logger::Info("GeometryPass: Using shared texture SRV, ObjectID: %u", constants.objectID);
         } else {
@@ -153,6 +182,9 @@ namespace Athena {
 
             D3D12_INDEX_BUFFER_VIEW ibv = indexBuffer->GetIndexBufferView();
 
+            vertexBuffer->MarkUsed();
+            indexBuffer->MarkUsed();
+
             commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
             commandList->IASetVertexBuffers(0, 1, &vbv);
             commandList->IASetIndexBuffer(&ibv);
@@ -171,6 +203,14 @@ namespace Athena {
 
     void GeometryPass::SetVertexData(const Vertex* vertices, uint32_t vertexCount,
                                     const uint32_t* indices, uint32_t indexCount) {
+        // 同じデータが毎フレーム設定される場合はバッファを作り直さない
+        if (vertexBuffer && indexBuffer &&
+            cachedVertices.size() == vertexCount && cachedIndices.size() == indexCount &&
+            std::memcmp(cachedVertices.data(), vertices, vertexCount * sizeof(Vertex)) == 0 &&
+            std::memcmp(cachedIndices.data(), indices, indexCount * sizeof(uint32_t)) == 0) {
+            return;
+        }
+
         this->vertexCount = vertexCount;
         this->indexCount = indexCount;
 
@@ -198,89 +238,14 @@ namespace Athena {
         projMatrix = proj;
     }
 
-    void GeometryPass::CreateRootSignature(ID3D12Device* device) {
-        // 従来方式ルートシグネチャ
-        D3D12_ROOT_PARAMETER rootParams[2] = {};
-
-        // 定数バッファ（b0）
-        rootParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
-        rootParams[0].Descriptor.ShaderRegister = 0;
-        rootParams[0].Descriptor.RegisterSpace = 0;
-        rootParams[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
-
-        // テクスチャテーブル（t0）
-        D3D12_DESCRIPTOR_RANGE texRange = {};
-        texRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-        texRange.NumDescriptors = 1;
-        texRange.BaseShaderRegister = 0;
-        texRange.RegisterSpace = 0;
-        texRange.OffsetInDescriptorsFromTableStart = 0;
-
-        rootParams[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-        rootParams[1].DescriptorTable.NumDescriptorRanges = 1;
-        rootParams[1].DescriptorTable.pDescriptorRanges = &texRange;
-        rootParams[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-
-        // サンプラー
-        D3D12_STATIC_SAMPLER_DESC sampler = {};
-        sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
-        sampler.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.MipLODBias = 0.0f;
-        sampler.MaxAnisotropy = 1;
-        sampler.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
-        sampler.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE;
-        sampler.MinLOD = 0.0f;
-        sampler.MaxLOD = D3D12_FLOAT32_MAX;
-        sampler.ShaderRegister = 0;
-        sampler.RegisterSpace = 0;
-        sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-
-        // ルートシグネチャ記述
-        D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
-        rootSigDesc.NumParameters = 2;
-        rootSigDesc.pParameters = rootParams;
-        rootSigDesc.NumStaticSamplers = 1;
-        rootSigDesc.pStaticSamplers = &sampler;
-        rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-
-        // シリアライズ
-        ComPtr<ID3DBlob> signature;
-        ComPtr<ID3DBlob> error;
-        HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
-        if (FAILED(hr)) {
-            if (error) {
-                Logger::Error("Root signature error: %s", (char*)error->GetBufferPointer());
-            }
-            throw std::runtime_error("Failed to serialize root signature");
-        }
-
-        // ルートシグネチャ作成
-        hr = device->CreateRootSignature(
-            0,
-            signature->GetBufferPointer(),
-            signature->GetBufferSize(),
-            IID_PPV_ARGS(&rootSignature)
-        );
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create root signature");
-        }
-
-        Logger::Info("GeometryPass: Root signature created");
-    }
-
-    void GeometryPass::CreatePipelineState(ID3D12Device* device) {
-        if (renderMode == RenderMode::Forward) {
-            CreateForwardPipelineState(device);
-        } else {
-            CreateDeferredPipelineState(device);
+    void GeometryPass::CreatePipelineState(ID3D12Device* device, ShaderPermutationKey key) {
+        // モード切り替えのたびに作り直さない
+        if (pipelines[key]) {
+            return;
         }
-    }
 
-    void GeometryPass::CreateForwardPipelineState(ID3D12Device* device) {
-        auto vertexShader = CompileShader(L"../shaders/GeometryVS.hlsl", "main", "vs_5_1");
-        auto pixelShader = CompileShader(L"../shaders/GeometryPS.hlsl", "main", "ps_5_1");
+        D3D12_SHADER_BYTECODE pixelShader = pixelShaders.Get(key);
+        bool deferred = (key & deferredKeyword) != 0;
 
         D3D12_INPUT_ELEMENT_DESC inputLayout[] = {
             {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
@@ -291,8 +256,7 @@ namespace Athena {
         D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
         psoDesc.pRootSignature = rootSignature.Get();
         psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-        psoDesc.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+        psoDesc.PS = pixelShader;
         psoDesc.SampleMask = UINT_MAX;
         psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
         psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
@@ -303,94 +267,27 @@ namespace Athena {
         psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
         psoDesc.InputLayout = { inputLayout, _countof(inputLayout) };
         psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
         psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
         psoDesc.SampleDesc.Count = 1;
 
-        HRESULT hr = device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create forward pipeline state");
-        }
-
-        Logger::Info("GeometryPass: Forward pipeline state created");
-    }
-
-    void GeometryPass::CreateDeferredPipelineState(ID3D12Device* device) {
-        auto vertexShader = CompileShader(L"../shaders/GeometryVS.hlsl", "main", "vs_5_1");
-        auto pixelShader = CompileShader(L"../shaders/GeometryDeferredPS.hlsl", "main", "ps_5_1");
-
-        D3D12_INPUT_ELEMENT_DESC inputLayout[] = {
-            {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-            {"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-            {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
-        };
-
-        // G-Buffer用のブレンド設定（3つのレンダーターゲット）
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.pRootSignature = rootSignature.Get();
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-        
-        // 3つのレンダーターゲット用のブレンド設定
-        for (int i = 0; i < 3; ++i) {
+        // ディファードは G-Buffer の Multiple Render Targets (MRT)
+        // 0: Albedo + Metallic, 1: Normal + Roughness, 2: Material + ObjectID
+        psoDesc.NumRenderTargets = deferred ? 3 : 1;
+        for (UINT i = 0; i < psoDesc.NumRenderTargets; ++i) {
             psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+            psoDesc.RTVFormats[i] = DXGI_FORMAT_R8G8B8A8_UNORM;
         }
-        
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
-        psoDesc.RasterizerState.FrontCounterClockwise = FALSE;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.InputLayout = { inputLayout, _countof(inputLayout) };
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        
-        // Multiple Render Targets (MRT) for G-Buffer
-        psoDesc.NumRenderTargets = 3;
-        psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;  // Albedo + Metallic
-        psoDesc.RTVFormats[1] = DXGI_FORMAT_R8G8B8A8_UNORM;  // Normal + Roughness
-        psoDesc.RTVFormats[2] = DXGI_FORMAT_R8G8B8A8_UNORM;  // Material + ObjectID
-        psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
-        psoDesc.SampleDesc.Count = 1;
 
-        HRESULT hr = device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create deferred pipeline state");
-        }
+        pipelines[key] = PipelineCache::LoadGraphicsPipelineAsync(device, psoDesc);
 
-        Logger::Info("GeometryPass: Deferred pipeline state created (G-Buffer MRT)");
+        Logger::Info("GeometryPass: %s pipeline state requested (%s)",
+                   deferred ? "Deferred" : "Forward", (key & textureKeyword) ? "textured" : "untextured");
     }
 
     ComPtr<ID3DBlob> GeometryPass::CompileShader(const std::wstring& filepath,
                                                 const std::string& entryPoint,
                                                 const std::string& target) {
-        UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-
-        ComPtr<ID3DBlob> shader;
-        ComPtr<ID3DBlob> error;
-
-        HRESULT hr = D3DCompileFromFile(
-            filepath.c_str(),
-            nullptr, nullptr,
-            entryPoint.c_str(),
-            target.c_str(),
-            compileFlags, 0,
-            &shader, &error
-        );
-
-        if (FAILED(hr)) {
-            if (error) {
-                Logger::Error("Shader compilation failed: %s", (char*)error->GetBufferPointer());
-            }
-            Logger::Error("Failed to compile shader: %S", filepath.c_str());
-            throw std::runtime_error("Failed to compile shader");
-        }
-
-        Logger::Info("Shader compiled: %S", filepath.c_str());
-        return shader;
+        return ShaderCache::LoadShader(filepath, entryPoint, target);
     }
 
     void GeometryPass::UpdateBuffers(ID3D12Device* device) {
@@ -407,7 +304,8 @@ namespace Athena {
                 device,
                 static_cast<uint32_t>(cachedVertices.size() * sizeof(Vertex)),
                 BufferType::Vertex,
-                D3D12_HEAP_TYPE_UPLOAD
+                D3D12_HEAP_TYPE_UPLOAD,
+                memoryAllocator
             );
             vertexBuffer->Upload(cachedVertices.data(), static_cast<uint32_t>(cachedVertices.size() * sizeof(Vertex)));
 
@@ -419,7 +317,8 @@ namespace Athena {
                 device,
                 static_cast<uint32_t>(cachedIndices.size() * sizeof(uint32_t)),
                 BufferType::Index,
-                D3D12_HEAP_TYPE_UPLOAD
+                D3D12_HEAP_TYPE_UPLOAD,
+                memoryAllocator
             );
             indexBuffer->Upload(cachedIndices.data(), static_cast<uint32_t>(cachedIndices.size() * sizeof(uint32_t)));
 
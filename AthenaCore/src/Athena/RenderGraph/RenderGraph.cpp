@@ -2,6 +2,7 @@
 #include "Athena/RenderGraph/RenderGraph.h"
 #include "Athena/RenderGraph/RenderGraphBuilder.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Core/DeferredReleaseQueue.h"
 #include "Athena/Resources/Texture.h"
 #include "Athena/Resources/Buffer.h"
 #include "Athena/Utils/Logger.h"
@@ -10,6 +11,7 @@
 #include <chrono>
 #include <queue>
 #include <limits>
+#include <mutex>
 
 namespace Athena {
 
@@ -24,13 +26,30 @@ namespace Athena {
     }
 
     void RenderGraph::Clear() {
-        passes.clear();
-        resources.clear();
-        finalOutputs.clear();
-        executionOrder.clear();
+        // バックグラウンドコンパイルが宣言側を参照しているため完了を待つ
+        WaitForCompile();
+
+        {
+            std::lock_guard<std::mutex> lock(declarationMutex);
+            passes.clear();
+            resources.clear();
+            finalOutputs.clear();
+            nextResourceId = 1;
+        }
+        {
+            std::lock_guard<std::mutex> lock(compiledMutex);
+            compiledGraph.reset();
+            pendingGraph.reset();
+        }
+        // プールのリソースは処理中のフレームが参照している可能性があるため遅延解放する
+        for (auto& texture : texturePool) {
+            DeferredReleaseQueue::DeferRelease(std::move(texture));
+        }
+        for (auto& buffer : bufferPool) {
+            DeferredReleaseQueue::DeferRelease(std::move(buffer));
+        }
         texturePool.clear();
         bufferPool.clear();
-        nextResourceId = 1;
         
         // 統計をリセット
         stats = RenderGraphStats{};
@@ -44,6 +63,7 @@ namespace Athena {
             return 0xFFFFFFFF;
         }
 
+        std::lock_guard<std::mutex> lock(declarationMutex);
         uint32_t passIndex = static_cast<uint32_t>(passes.size());
         
         PassInfo passInfo;
@@ -53,10 +73,43 @@ namespace Athena {
         
         passes.push_back(std::move(passInfo));
         
-        Logger::Info("Added pass '{}' at index {}", passes.back().pass->GetName(), passIndex);
+        Logger::Info("Added pass '%s' at index %u", passes.back().pass->GetName().c_str(), passIndex);
         return passIndex;
     }
 
+    bool RenderGraph::SetPassEnabled(uint32_t passIndex, bool enabled) {
+        std::lock_guard<std::mutex> lock(declarationMutex);
+        if (passIndex >= passes.size()) {
+            Logger::Error("SetPassEnabled: invalid pass index %u", passIndex);
+            return false;
+        }
+
+        PassInfo& passInfo = passes[passIndex];
+        if (passInfo.enabled == enabled) {
+            return false;
+        }
+
+        passInfo.enabled = enabled;
+        Logger::Info("Pass '%s' %s", passInfo.pass ? passInfo.pass->GetName().c_str() : "(null)",
+                    enabled ? "enabled" : "disabled");
+        return true;
+    }
+
+    bool RenderGraph::IsPassEnabled(uint32_t passIndex) const {
+        std::lock_guard<std::mutex> lock(declarationMutex);
+        return passIndex < passes.size() && passes[passIndex].enabled;
+    }
+
+    void RenderGraph::InvalidatePassSetup() {
+        // ワーカーが isSetup を戻す前の宣言をスナップショットしないよう、先にコンパイルを終わらせる
+        WaitForCompile();
+
+        std::lock_guard<std::mutex> lock(declarationMutex);
+        for (auto& passInfo : passes) {
+            passInfo.isSetup = false;
+        }
+    }
+
     void RenderGraph::RegisterExternalResource(const ResourceHandle& handle, std::shared_ptr<Texture> resource) {
         if (!handle.IsValid() || !resource) {
             Logger::Error("Invalid handle or resource for external texture registration");
@@ -70,6 +123,7 @@ namespace Athena {
         info.isExternal = true;
         info.isTransient = false;
         
+        std::lock_guard<std::mutex> lock(declarationMutex);
         resources[handle.GetID()] = std::move(info);
         
         Logger::Info("Registered external texture resource: {}", handle.GetName());
@@ -88,6 +142,7 @@ namespace Athena {
         info.isExternal = true;
         info.isTransient = false;
         
+        std::lock_guard<std::mutex> lock(declarationMutex);
         resources[handle.GetID()] = std::move(info);
         
         Logger::Info("Registered external buffer resource: {}", handle.GetName());
@@ -99,197 +154,479 @@ namespace Athena {
             return;
         }
         
+        std::lock_guard<std::mutex> lock(declarationMutex);
         finalOutputs.insert(handle);
         Logger::Info("Set final output: {}", handle.GetName());
     }
 
     bool RenderGraph::Compile() {
-        auto startTime = std::chrono::high_resolution_clock::now();
-        
-        Logger::Info("Compiling RenderGraph with {} passes", passes.size());
-        
-        // ステップ1: バリデーション
-        if (settings.enableValidation && !ValidateGraph()) {
-            Logger::Error("RenderGraph validation failed");
+        // 進行中のバックグラウンドコンパイルと競合しないよう完了を待つ
+        WaitForCompile();
+
+        SetupPendingPasses();
+
+        auto compiled = BuildCompiledGraph();
+        if (!compiled) {
             return false;
         }
-        
-        // ステップ2: パスのセットアップを実行
-        for (auto& passInfo : passes) {
-            if (!passInfo.pass) continue;
-            
-            // RenderGraphBuilderを作成してパスセットアップを実行
-            RenderGraphBuilder builder(this);
-            passInfo.setupData.builder = &builder;
-            passInfo.pass->Setup(passInfo.setupData);
+
+        InstallCompiledGraph(compiled);
+        return true;
+    }
+
+    bool RenderGraph::CompileAsync() {
+        if (compileInProgress.load()) {
+            Logger::Warning("RenderGraph: background compile already in progress");
+            return false;
         }
-        
+
+        // 前回のワーカーは完了済みなので回収する
+        if (compileThread.joinable()) {
+            compileThread.join();
+        }
+
+        // Setup() はパスの状態を変更し、やり直しの場合は実行中のグラフが使うパスにも触れるため、
+        // ワーカーに渡さずここで行う
+        SetupPendingPasses();
+
+        compileInProgress.store(true);
+        compileThread = std::thread([this]() {
+            auto compiled = BuildCompiledGraph();
+            if (compiled) {
+                std::lock_guard<std::mutex> lock(compiledMutex);
+                pendingGraph = compiled;
+            }
+            lastCompileSucceeded.store(compiled != nullptr);
+            compileInProgress.store(false);
+        });
+
+        Logger::Info("RenderGraph: background compile started");
+        return true;
+    }
+
+    bool RenderGraph::WaitForCompile() {
+        if (compileThread.joinable()) {
+            compileThread.join();
+        }
+        return lastCompileSucceeded.load();
+    }
+
+    bool RenderGraph::ApplyPendingCompile() {
+        std::shared_ptr<const CompiledRenderGraph> pending;
+        {
+            std::lock_guard<std::mutex> lock(compiledMutex);
+            pending = std::move(pendingGraph);
+            pendingGraph.reset();
+        }
+
+        if (!pending) {
+            return false;
+        }
+
+        InstallCompiledGraph(pending);
+        Logger::Info("RenderGraph: swapped to compiled graph version %llu",
+            static_cast<unsigned long long>(pending->version));
+        return true;
+    }
+
+    std::shared_ptr<const CompiledRenderGraph> RenderGraph::GetCompiledGraph() const {
+        std::lock_guard<std::mutex> lock(compiledMutex);
+        return compiledGraph;
+    }
+
+    void RenderGraph::InstallCompiledGraph(std::shared_ptr<const CompiledRenderGraph> compiled) {
+        {
+            std::lock_guard<std::mutex> lock(compiledMutex);
+            compiledGraph = compiled;
+        }
+
+        // 実行時の統計は保持し、コンパイル時の統計のみ差し替える
+        float executeTime = stats.executeTime;
+        uint32_t executedPasses = stats.executedPasses;
+        stats = compiled->stats;
+        stats.executeTime = executeTime;
+        stats.executedPasses = executedPasses;
+        stats.compiledVersion = compiled->version;
+    }
+
+    std::shared_ptr<CompiledRenderGraph> RenderGraph::BuildCompiledGraph() {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        // ステップ1: 宣言側のスナップショットを作成（以降はスナップショットのみ操作する）
+        // Setup() は呼び出し側で済ませておくこと
+        auto graph = SnapshotDeclaration();
+
+        Logger::Info("Compiling RenderGraph with %zu passes", graph->passes.size());
+
+        // ステップ2: バリデーション
+        if (settings.enableValidation && !ValidateGraph(*graph)) {
+            Logger::Error("RenderGraph validation failed");
+            return nullptr;
+        }
+
         // ステップ3: 依存関係解析
-        if (!AnalyzeDependencies()) {
+        if (!AnalyzeDependencies(*graph)) {
             Logger::Error("Dependency analysis failed");
-            return false;
+            return nullptr;
         }
-        
+
         // ステップ4: 未使用パス除去
         if (settings.enablePassCulling) {
-            CullUnusedPasses();
+            CullUnusedPasses(*graph);
         }
-        
+
         // ステップ5: リソースライフタイム解析
-        AnalyzeResourceLifetime();
-        
+        AnalyzeResourceLifetime(*graph);
+
         // ステップ5.5: リソース配置最適化
-        OptimizeResourceAllocation();
-        
+        OptimizeResourceAllocation(*graph);
+
         // ステップ5.7: リソースバリア解析
-        AnalyzeResourceBarriers();
-        
+        AnalyzeResourceBarriers(*graph);
+
         // ステップ6: 一時リソース配置
-        if (!AllocateTransientResources()) {
+        if (!AllocateTransientResources(*graph)) {
             Logger::Error("Transient resource allocation failed");
-            return false;
+            return nullptr;
         }
-        
+
         // 統計更新
         auto endTime = std::chrono::high_resolution_clock::now();
-        stats.compileTime = std::chrono::duration<float>(endTime - startTime).count();
-        stats.totalPasses = static_cast<uint32_t>(passes.size());
-        stats.totalResources = static_cast<uint32_t>(resources.size());
-        
+        RenderGraphStats& graphStats = graph->stats;
+        graphStats.compileTime = std::chrono::duration<float>(endTime - startTime).count();
+        graphStats.totalPasses = static_cast<uint32_t>(graph->passes.size()) + graphStats.culledPasses;
+        UpdateResourceStats(*graph);
+
+        Logger::Info("RenderGraph compilation completed in %.3fms", graphStats.compileTime * 1000.0f);
+        return graph;
+    }
+
+    void RenderGraph::UpdateResourceStats(CompiledRenderGraph& graph) const {
+        graph.stats.totalResources = static_cast<uint32_t>(graph.resources.size());
+
         // 外部・一時リソース数を計算
-        stats.externalResources = 0;
-        stats.transientResources = 0;
-        for (const auto& [id, resource] : resources) {
+        graph.stats.externalResources = 0;
+        graph.stats.transientResources = 0;
+        for (const auto& [id, resource] : graph.resources) {
             if (resource.isExternal) {
-                stats.externalResources++;
+                graph.stats.externalResources++;
             } else if (resource.isTransient) {
-                stats.transientResources++;
+                graph.stats.transientResources++;
             }
         }
-        
-        Logger::Info("RenderGraph compilation completed in {:.3f}ms", stats.compileTime * 1000.0f);
+    }
+
+    bool RenderGraph::ImportStaticSchedule(const StaticScheduleView& schedule,
+                                           std::vector<std::unique_ptr<RenderPass>> staticPasses,
+                                           const std::unordered_map<std::string, std::shared_ptr<Texture>>& externalTextures,
+                                           std::vector<ResourceHandle>* outHandles) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        if (staticPasses.size() != schedule.passNames.size() || schedule.order.size() != schedule.passNames.size()) {
+            Logger::Error("Static schedule expects %zu passes but %zu were provided",
+                schedule.passNames.size(), staticPasses.size());
+            return false;
+        }
+
+        Clear();
+
+        // リソースを宣言順に作成
+        std::vector<ResourceHandle> handles;
+        handles.reserve(schedule.resources.size());
+        for (const StaticResourceDesc& staticDesc : schedule.resources) {
+            ResourceDesc desc = (staticDesc.type == ResourceType::Buffer)
+                ? ResourceDesc::CreateBuffer(staticDesc.width, staticDesc.usage, staticDesc.name)
+                : ResourceDesc::CreateTexture2D(staticDesc.width, staticDesc.height, staticDesc.format,
+                                                staticDesc.usage, staticDesc.name);
+            ResourceHandle handle = CreateResource(desc, staticDesc.name);
+
+            if (staticDesc.isExternal) {
+                auto it = externalTextures.find(staticDesc.name);
+                if (it == externalTextures.end() || !it->second) {
+                    Logger::Error("Static schedule: external resource '%s' is not bound", staticDesc.name);
+                    Clear();
+                    return false;
+                }
+                RegisterExternalResource(handle, it->second);
+            }
+            if (staticDesc.isFinalOutput) {
+                SetFinalOutput(handle);
+            }
+            handles.push_back(handle);
+        }
+
+        // パスを宣言順に追加し、エッジから入出力を設定
+        for (size_t i = 0; i < staticPasses.size(); ++i) {
+            if (AddPass(std::move(staticPasses[i])) == 0xFFFFFFFF) {
+                Clear();
+                return false;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(declarationMutex);
+            for (const StaticEdge& edge : schedule.edges) {
+                PassInfo& passInfo = passes[edge.pass];
+                (edge.isWrite ? passInfo.outputs : passInfo.inputs).push_back(handles[edge.resource]);
+            }
+        }
+
+        SetupPendingPasses();
+
+        // 事前計算済みの順序・ライフタイム・バリアからコンパイル済みグラフを直接構築
+        auto graph = SnapshotDeclaration();
+        std::vector<CompiledPass> ordered;
+        ordered.reserve(graph->passes.size());
+        for (uint32_t position = 0; position < static_cast<uint32_t>(schedule.order.size()); ++position) {
+            CompiledPass compiledPass = graph->passes[schedule.order[position]];
+            for (const StaticBarrier& barrier : schedule.barriers) {
+                if (barrier.orderIndex != position) continue;
+
+                ResourceStateTransition transition;
+                transition.resourceId = handles[barrier.resource].GetID();
+                transition.fromState = barrier.fromState;
+                transition.toState = barrier.toState;
+                transition.passIndex = compiledPass.passIndex;
+                compiledPass.preBarriers.push_back(transition);
+            }
+            ordered.push_back(std::move(compiledPass));
+        }
+        graph->passes = std::move(ordered);
+
+        for (size_t i = 0; i < handles.size(); ++i) {
+            auto it = graph->resources.find(handles[i].GetID());
+            if (it != graph->resources.end()) {
+                it->second.firstPass = schedule.lifetimes[i].firstPass;
+                it->second.lastPass = schedule.lifetimes[i].lastPass;
+            }
+        }
+
+        if (!AllocateTransientResources(*graph)) {
+            Logger::Error("Transient resource allocation failed");
+            return false;
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        graph->stats.compileTime = std::chrono::duration<float>(endTime - startTime).count();
+        graph->stats.totalPasses = static_cast<uint32_t>(graph->passes.size());
+        UpdateResourceStats(*graph);
+
+        InstallCompiledGraph(graph);
+
+        if (outHandles) {
+            *outHandles = std::move(handles);
+        }
+
+        Logger::Info("Imported static schedule: %zu passes, %zu resources, %zu barriers (%.3fms)",
+            schedule.order.size(), schedule.resources.size(), schedule.barriers.size(),
+            graph->stats.compileTime * 1000.0f);
         return true;
     }
 
+    void RenderGraph::SetupPendingPasses() {
+        // セットアップ対象を取り出す（Setup中はロックを保持しない：BuilderがCreateResourceを呼ぶため）
+        std::vector<std::pair<std::shared_ptr<RenderPass>, PassSetupData>> pending;
+        std::vector<uint32_t> pendingIndices;
+        {
+            std::lock_guard<std::mutex> lock(declarationMutex);
+            for (auto& passInfo : passes) {
+                if (!passInfo.pass || passInfo.isSetup) continue;
+                pending.emplace_back(passInfo.pass, passInfo.setupData);
+                pendingIndices.push_back(passInfo.passIndex);
+            }
+        }
+
+        for (size_t i = 0; i < pending.size(); ++i) {
+            // RenderGraphBuilderを作成してパスセットアップを実行
+            RenderGraphBuilder builder(this);
+            PassSetupData& setupData = pending[i].second;
+            setupData.builder = &builder;
+            pending[i].first->Setup(setupData);
+            setupData.builder = nullptr;
+        }
+
+        // セットアップ結果（パラメータ等）を宣言側に書き戻す
+        std::lock_guard<std::mutex> lock(declarationMutex);
+        for (size_t i = 0; i < pending.size(); ++i) {
+            uint32_t passIndex = pendingIndices[i];
+            if (passIndex < passes.size() && passes[passIndex].pass == pending[i].first) {
+                passes[passIndex].setupData = std::move(pending[i].second);
+                passes[passIndex].isSetup = true;
+            }
+        }
+    }
+
+    std::shared_ptr<CompiledRenderGraph> RenderGraph::SnapshotDeclaration() {
+        auto graph = std::make_shared<CompiledRenderGraph>();
+
+        std::lock_guard<std::mutex> lock(declarationMutex);
+        graph->version = nextCompiledVersion++;
+        graph->resources = resources;
+        graph->finalOutputs = finalOutputs;
+
+        graph->passes.reserve(passes.size());
+        for (const auto& passInfo : passes) {
+            if (!passInfo.enabled || !passInfo.pass) continue;
+
+            CompiledPass compiledPass;
+            compiledPass.pass = passInfo.pass;
+            compiledPass.passIndex = passInfo.passIndex;
+            compiledPass.inputs = passInfo.inputs;
+            compiledPass.outputs = passInfo.outputs;
+            compiledPass.floatParams = passInfo.setupData.floatParams;
+            compiledPass.intParams = passInfo.setupData.intParams;
+            compiledPass.boolParams = passInfo.setupData.boolParams;
+            graph->passes.push_back(std::move(compiledPass));
+        }
+
+        return graph;
+    }
+
     bool RenderGraph::Execute(RenderContext* renderContext) {
         if (!renderContext) {
             Logger::Error("Cannot execute RenderGraph with null RenderContext");
             return false;
         }
-        
+
+        // フレーム境界：完了したバックグラウンドコンパイルがあれば差し替える
+        ApplyPendingCompile();
+
+        // 実行中に差し替えられても安全なよう参照を保持する
+        std::shared_ptr<const CompiledRenderGraph> graph = GetCompiledGraph();
+        if (!graph) {
+            Logger::Warning("RenderGraph has not been compiled");
+            return true;
+        }
+
         auto startTime = std::chrono::high_resolution_clock::now();
-        
-        Logger::Info("Executing RenderGraph with {} passes", executionOrder.size());
-        
+
+        Logger::Info("Executing RenderGraph with %zu passes", graph->passes.size());
+
         stats.executedPasses = 0;
-        
+
         // 実行順序に従ってパスを実行
-        for (uint32_t passIndex : executionOrder) {
-            if (passIndex >= passes.size()) {
-                Logger::Error("Invalid pass index in execution order: {}", passIndex);
-                continue;
-            }
-            
-            PassInfo& passInfo = passes[passIndex];
-            if (!passInfo.enabled || !passInfo.pass) {
+        for (const CompiledPass& compiledPass : graph->passes) {
+            if (!compiledPass.pass) {
                 continue;
             }
-            
+
             // PassExecuteDataを構築
             PassExecuteData executeData;
             executeData.renderContext = renderContext;
-            executeData.floatParams = passInfo.setupData.floatParams;
-            executeData.intParams = passInfo.setupData.intParams;
-            executeData.boolParams = passInfo.setupData.boolParams;
-            
+            executeData.floatParams = compiledPass.floatParams;
+            executeData.intParams = compiledPass.intParams;
+            executeData.boolParams = compiledPass.boolParams;
+
             // 入力・出力リソースを設定
             // RenderGraphBuilderで設定されたリソースマッピングを適用
-            for (const auto& inputHandle : passInfo.inputs) {
+            for (const auto& inputHandle : compiledPass.inputs) {
                 executeData.inputs[inputHandle.GetName()] = inputHandle;
             }
-            
-            for (const auto& outputHandle : passInfo.outputs) {
+
+            for (const auto& outputHandle : compiledPass.outputs) {
                 executeData.outputs[outputHandle.GetName()] = outputHandle;
             }
-            
+
             // コマンドリストを取得（仮の実装）
             ID3D12GraphicsCommandList* commandList = executeData.commandList;
             if (commandList) {
                 // パス実行前のリソースバリアを挿入
-                InsertResourceBarriers(commandList, passInfo.preBarriers);
+                InsertResourceBarriers(commandList, *graph, compiledPass.preBarriers);
             }
-            
+
             try {
-                passInfo.pass->Execute(executeData);
+                compiledPass.pass->Execute(executeData);
                 stats.executedPasses++;
-                
+
                 // パス実行後のリソースバリアを挿入
                 if (commandList) {
-                    InsertResourceBarriers(commandList, passInfo.postBarriers);
+                    InsertResourceBarriers(commandList, *graph, compiledPass.postBarriers);
                 }
-                
-                Logger::Info("Executed pass '{}' ({})", 
-                    passInfo.pass->GetName(), passInfo.passIndex);
+
+                Logger::Info("Executed pass '%s' (%u)",
+                    compiledPass.pass->GetName().c_str(), compiledPass.passIndex);
             }
             catch (const std::exception& e) {
-                Logger::Error("Pass '{}' execution failed: {}", 
-                    passInfo.pass->GetName(), e.what());
+                Logger::Error("Pass '%s' execution failed: %s",
+                    compiledPass.pass->GetName().c_str(), e.what());
                 return false;
             }
         }
-        
+
         auto endTime = std::chrono::high_resolution_clock::now();
         stats.executeTime = std::chrono::duration<float>(endTime - startTime).count();
-        
-        Logger::Info("RenderGraph execution completed in {:.3f}ms", stats.executeTime * 1000.0f);
+
+        Logger::Info("RenderGraph execution completed in %.3fms", stats.executeTime * 1000.0f);
         return true;
     }
 
-    const ResourceInfo* RenderGraph::GetResourceInfo(const ResourceHandle& handle) const {
+    std::optional<ResourceInfo> RenderGraph::GetResourceInfo(const ResourceHandle& handle) const {
         if (!handle.IsValid()) {
-            return nullptr;
+            return std::nullopt;
         }
-        
+
+        // コンパイル済みグラフ（実体が割り当て済み）を優先
+        {
+            std::lock_guard<std::mutex> lock(compiledMutex);
+            if (compiledGraph) {
+                auto it = compiledGraph->resources.find(handle.GetID());
+                if (it != compiledGraph->resources.end()) {
+                    return it->second;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(declarationMutex);
         auto it = resources.find(handle.GetID());
-        return (it != resources.end()) ? &it->second : nullptr;
+        if (it == resources.end()) {
+            return std::nullopt;
+        }
+        return it->second;
     }
 
     void RenderGraph::DumpDebugInfo() const {
+        std::shared_ptr<const CompiledRenderGraph> graph = GetCompiledGraph();
+        std::lock_guard<std::mutex> lock(declarationMutex);
+
         Logger::Info("=== RenderGraph Debug Info ===");
-        Logger::Info("Passes: {}", passes.size());
-        Logger::Info("Resources: {}", resources.size());
-        Logger::Info("Execution Order: {}", executionOrder.size());
-        Logger::Info("Final Outputs: {}", finalOutputs.size());
-        
+        Logger::Info("Passes: %zu", passes.size());
+        Logger::Info("Resources: %zu", resources.size());
+        Logger::Info("Execution Order: %zu", graph ? graph->passes.size() : size_t(0));
+        Logger::Info("Final Outputs: %zu", finalOutputs.size());
+        Logger::Info("Compiled Version: %llu (background compile: %s)",
+            static_cast<unsigned long long>(graph ? graph->version : 0),
+            compileInProgress.load() ? "running" : "idle");
+
         Logger::Info("--- Passes ---");
         for (size_t i = 0; i < passes.size(); ++i) {
             const auto& passInfo = passes[i];
             if (passInfo.pass) {
-                Logger::Info("  [{}] {} ({})", i, passInfo.pass->GetName(),
+                Logger::Info("  [%zu] %s (%s)", i, passInfo.pass->GetName().c_str(),
                     passInfo.enabled ? "enabled" : "disabled");
             }
         }
-        
+
         Logger::Info("--- Resources ---");
         for (const auto& [id, resource] : resources) {
-            Logger::Info("  [{}] {} ({}x{}, {})", 
-                id, resource.handle.GetName(),
+            Logger::Info("  [%u] %s (%ux%u, %s)",
+                id, resource.handle.GetName().c_str(),
                 resource.desc.width, resource.desc.height,
                 resource.isExternal ? "external" : "transient");
         }
-        
+
         Logger::Info("--- Statistics ---");
-        Logger::Info("  Compile Time: {:.3f}ms", stats.compileTime * 1000.0f);
-        Logger::Info("  Execute Time: {:.3f}ms", stats.executeTime * 1000.0f);
-        Logger::Info("  Memory Usage: {} bytes", stats.memoryUsage);
+        Logger::Info("  Compile Time: %.3fms", stats.compileTime * 1000.0f);
+        Logger::Info("  Execute Time: %.3fms", stats.executeTime * 1000.0f);
+        Logger::Info("  Memory Usage: %zu bytes", stats.memoryUsage);
     }
 
     std::string RenderGraph::ExportGraphviz() const {
+        std::lock_guard<std::mutex> lock(declarationMutex);
+
         std::stringstream ss;
         ss << "digraph RenderGraph {\n";
         ss << "  rankdir=TB;\n";
         ss << "  node [shape=box];\n";
-        
+
         // パスノード
         for (size_t i = 0; i < passes.size(); ++i) {
             const auto& passInfo = passes[i];
@@ -297,16 +634,16 @@ namespace Athena {
                 ss << "  pass" << i << " [label=\"" << passInfo.pass->GetName() << "\"];\n";
             }
         }
-        
+
         // リソースノード
         for (const auto& [id, resource] : resources) {
-            ss << "  res" << id << " [label=\"" << resource.handle.GetName() 
+            ss << "  res" << id << " [label=\"" << resource.handle.GetName()
                << "\", shape=ellipse, color=" << (resource.isExternal ? "blue" : "red") << "];\n";
         }
-        
+
         // エッジ（依存関係）
         // TODO: 実際の依存関係を追加
-        
+
         ss << "}\n";
         return ss.str();
     }
@@ -314,79 +651,69 @@ namespace Athena {
     // プライベートメソッドの実装
 
     ResourceHandle RenderGraph::CreateResource(const ResourceDesc& desc, const std::string& name) {
+        // パスのSetupがワーカースレッドから呼び出す場合があるためロックする
+        std::lock_guard<std::mutex> lock(declarationMutex);
         uint32_t id = GenerateResourceId();
-        
+
         // プライベートコンストラクタを呼び出すためにfriendクラスからアクセス
         ResourceHandle handle;
         handle.id = id;
         handle.name = name;
         handle.desc = desc;
-        
+
         ResourceInfo info;
         info.handle = handle;
         info.desc = desc;
         info.isExternal = false;
         info.isTransient = true;
-        
+
         resources[id] = std::move(info);
-        
+
         return handle;
     }
 
-    bool RenderGraph::AnalyzeDependencies() {
-        executionOrder.clear();
-        
-        // 有効なパスのリスト作成
-        std::vector<uint32_t> enabledPasses;
-        for (size_t i = 0; i < passes.size(); ++i) {
-            if (passes[i].enabled && passes[i].pass) {
-                enabledPasses.push_back(static_cast<uint32_t>(i));
-            }
-        }
-        
-        if (enabledPasses.empty()) {
+    bool RenderGraph::AnalyzeDependencies(CompiledRenderGraph& graph) {
+        if (graph.passes.empty()) {
             Logger::Warning("No enabled passes found for dependency analysis");
             return true;
         }
-        
+
         // トポロジカルソートを実行
-        if (!TopologicalSort(enabledPasses)) {
+        if (!TopologicalSort(graph)) {
             Logger::Error("Failed to perform topological sort - cyclic dependency detected");
             return false;
         }
-        
-        Logger::Info("Dependency analysis completed, execution order: {} passes", executionOrder.size());
+
+        Logger::Info("Dependency analysis completed, execution order: %zu passes", graph.passes.size());
         return true;
     }
 
-    bool RenderGraph::TopologicalSort(const std::vector<uint32_t>& enabledPasses) {
+    bool RenderGraph::TopologicalSort(CompiledRenderGraph& graph) {
         // カーンのアルゴリズムでトポロジカルソートを実行
-        std::unordered_map<uint32_t, uint32_t> inDegree;  // 各パスの入次数
-        std::unordered_map<uint32_t, std::vector<uint32_t>> adjacencyList;  // 隣接リスト
-        
-        // 初期化
-        for (uint32_t passIndex : enabledPasses) {
-            inDegree[passIndex] = 0;
-            adjacencyList[passIndex] = {};
-        }
-        
+        // ノードはスナップショット内の位置（宣言順）で表す
+        const size_t passCount = graph.passes.size();
+        std::vector<uint32_t> inDegree(passCount, 0);                 // 各パスの入次数
+        std::vector<std::vector<uint32_t>> adjacencyList(passCount);  // 隣接リスト
+
         // 依存関係を構築
-        BuildDependencyGraph(enabledPasses, inDegree, adjacencyList);
-        
+        BuildDependencyGraph(graph.passes, inDegree, adjacencyList);
+
         // 入次数が0のパスをキューに追加
         std::queue<uint32_t> queue;
-        for (uint32_t passIndex : enabledPasses) {
-            if (inDegree[passIndex] == 0) {
-                queue.push(passIndex);
+        for (uint32_t node = 0; node < passCount; ++node) {
+            if (inDegree[node] == 0) {
+                queue.push(node);
             }
         }
-        
+
         // トポロジカルソートの実行
+        std::vector<uint32_t> order;
+        order.reserve(passCount);
         while (!queue.empty()) {
             uint32_t currentPass = queue.front();
             queue.pop();
-            executionOrder.push_back(currentPass);
-            
+            order.push_back(currentPass);
+
             // 現在のパスから依存しているパスの入次数を減らす
             for (uint32_t dependentPass : adjacencyList[currentPass]) {
                 inDegree[dependentPass]--;
@@ -395,175 +722,175 @@ namespace Athena {
                 }
             }
         }
-        
+
         // 循環依存の検出
-        if (executionOrder.size() != enabledPasses.size()) {
+        if (order.size() != passCount) {
             Logger::Error("Cyclic dependency detected in render graph");
-            executionOrder.clear();
             return false;
         }
-        
+
+        // 実行順に並べ替える
+        std::vector<CompiledPass> sorted;
+        sorted.reserve(passCount);
+        for (uint32_t node : order) {
+            sorted.push_back(std::move(graph.passes[node]));
+        }
+        graph.passes = std::move(sorted);
+
         return true;
     }
 
-    void RenderGraph::BuildDependencyGraph(const std::vector<uint32_t>& enabledPasses,
-                                          std::unordered_map<uint32_t, uint32_t>& inDegree,
-                                          std::unordered_map<uint32_t, std::vector<uint32_t>>& adjacencyList) {
-        
+    void RenderGraph::BuildDependencyGraph(const std::vector<CompiledPass>& compiledPasses,
+                                          std::vector<uint32_t>& inDegree,
+                                          std::vector<std::vector<uint32_t>>& adjacencyList) {
+
         // 各リソースを書き込むパスと読み込むパスを追跡
         std::unordered_map<uint32_t, uint32_t> resourceWriters;  // リソースID -> 書き込みパス
         std::unordered_map<uint32_t, std::vector<uint32_t>> resourceReaders;  // リソースID -> 読み込みパス一覧
-        
-        for (uint32_t passIndex : enabledPasses) {
-            const PassInfo& passInfo = passes[passIndex];
-            
+
+        for (uint32_t node = 0; node < static_cast<uint32_t>(compiledPasses.size()); ++node) {
+            const CompiledPass& compiledPass = compiledPasses[node];
+
             // 出力リソース（このパスが書き込む）
-            for (const ResourceHandle& output : passInfo.outputs) {
+            for (const ResourceHandle& output : compiledPass.outputs) {
                 if (output.IsValid()) {
                     uint32_t resourceId = output.GetID();
-                    
+
                     // 以前に同じリソースに書き込んでいるパスがあれば依存関係を追加
                     if (resourceWriters.find(resourceId) != resourceWriters.end()) {
                         uint32_t prevWriterPass = resourceWriters[resourceId];
-                        adjacencyList[prevWriterPass].push_back(passIndex);
-                        inDegree[passIndex]++;
+                        adjacencyList[prevWriterPass].push_back(node);
+                        inDegree[node]++;
                     }
-                    
+
                     // このリソースを読み込んでいる全てのパスにも依存関係を追加
                     if (resourceReaders.find(resourceId) != resourceReaders.end()) {
                         for (uint32_t readerPass : resourceReaders[resourceId]) {
-                            adjacencyList[readerPass].push_back(passIndex);
-                            inDegree[passIndex]++;
+                            adjacencyList[readerPass].push_back(node);
+                            inDegree[node]++;
                         }
                     }
-                    
-                    resourceWriters[resourceId] = passIndex;
+
+                    resourceWriters[resourceId] = node;
                 }
             }
-            
+
             // 入力リソース（このパスが読み込む）
-            for (const ResourceHandle& input : passInfo.inputs) {
+            for (const ResourceHandle& input : compiledPass.inputs) {
                 if (input.IsValid()) {
                     uint32_t resourceId = input.GetID();
-                    
+
                     // このリソースを書き込んでいるパスがあれば依存関係を追加
                     if (resourceWriters.find(resourceId) != resourceWriters.end()) {
                         uint32_t writerPass = resourceWriters[resourceId];
-                        adjacencyList[writerPass].push_back(passIndex);
-                        inDegree[passIndex]++;
+                        adjacencyList[writerPass].push_back(node);
+                        inDegree[node]++;
                     }
-                    
+
                     // このパスを読み込みパスリストに追加
-                    resourceReaders[resourceId].push_back(passIndex);
+                    resourceReaders[resourceId].push_back(node);
                 }
             }
         }
-        
+
         // 依存関係の総数を計算
         size_t totalDeps = 0;
-        for (const auto& passEntry : adjacencyList) {
-            totalDeps += passEntry.second.size();
+        for (const auto& edges : adjacencyList) {
+            totalDeps += edges.size();
         }
-        
-        Logger::Info("Built dependency graph with {} dependencies", totalDeps);
+
+        Logger::Info("Built dependency graph with %zu dependencies", totalDeps);
     }
 
-    void RenderGraph::CullUnusedPasses() {
-        stats.culledPasses = 0;
-        
+    void RenderGraph::CullUnusedPasses(CompiledRenderGraph& graph) {
+        graph.stats.culledPasses = 0;
+
         // 簡単な実装：最終出力に到達しないパスをカル
         // TODO: より複雑な依存関係解析を実装
-        
-        Logger::Info("Pass culling completed, culled {} passes", stats.culledPasses);
+
+        Logger::Info("Pass culling completed, culled %u passes", graph.stats.culledPasses);
     }
 
-    void RenderGraph::AnalyzeResourceLifetime() {
+    void RenderGraph::AnalyzeResourceLifetime(CompiledRenderGraph& graph) {
         // 各リソースの最初と最後の使用パスを計算
-        for (auto& [id, resource] : resources) {
+        for (auto& [id, resource] : graph.resources) {
             resource.firstPass = 0xFFFFFFFF;
             resource.lastPass = 0xFFFFFFFF;
         }
-        
+
+        // 実行順序内の位置を記録する
+        auto recordUse = [&graph](const ResourceHandle& handle, uint32_t order) {
+            if (!handle.IsValid()) return;
+            auto it = graph.resources.find(handle.GetID());
+            if (it == graph.resources.end()) return;
+
+            ResourceInfo& resourceInfo = it->second;
+            resourceInfo.firstPass = std::min(resourceInfo.firstPass, order);
+            resourceInfo.lastPass = (resourceInfo.lastPass == 0xFFFFFFFF)
+                ? order : std::max(resourceInfo.lastPass, order);
+        };
+
         // 実行順序に基づいてライフタイムを計算
-        for (size_t i = 0; i < executionOrder.size(); ++i) {
-            uint32_t passIndex = executionOrder[i];
-            if (passIndex >= passes.size()) continue;
-            
-            const PassInfo& passInfo = passes[passIndex];
-            
+        for (uint32_t order = 0; order < static_cast<uint32_t>(graph.passes.size()); ++order) {
+            const CompiledPass& compiledPass = graph.passes[order];
+
             // 入力リソースの使用を記録
-            for (const ResourceHandle& input : passInfo.inputs) {
-                if (input.IsValid()) {
-                    uint32_t resourceId = input.GetID();
-                    auto it = resources.find(resourceId);
-                    if (it != resources.end()) {
-                        ResourceInfo& resourceInfo = it->second;
-                        resourceInfo.firstPass = std::min(resourceInfo.firstPass, passIndex);
-                        resourceInfo.lastPass = std::max(resourceInfo.lastPass, passIndex);
-                    }
-                }
+            for (const ResourceHandle& input : compiledPass.inputs) {
+                recordUse(input, order);
             }
-            
+
             // 出力リソースの使用を記録
-            for (const ResourceHandle& output : passInfo.outputs) {
-                if (output.IsValid()) {
-                    uint32_t resourceId = output.GetID();
-                    auto it = resources.find(resourceId);
-                    if (it != resources.end()) {
-                        ResourceInfo& resourceInfo = it->second;
-                        resourceInfo.firstPass = std::min(resourceInfo.firstPass, passIndex);
-                        resourceInfo.lastPass = std::max(resourceInfo.lastPass, passIndex);
-                    }
-                }
+            for (const ResourceHandle& output : compiledPass.outputs) {
+                recordUse(output, order);
             }
         }
-        
+
         // 最終出力リソースのライフタイムを延長
-        for (const ResourceHandle& finalOutput : finalOutputs) {
+        for (const ResourceHandle& finalOutput : graph.finalOutputs) {
             if (finalOutput.IsValid()) {
                 uint32_t resourceId = finalOutput.GetID();
-                auto it = resources.find(resourceId);
-                if (it != resources.end()) {
-                    it->second.lastPass = static_cast<uint32_t>(executionOrder.size());
+                auto it = graph.resources.find(resourceId);
+                if (it != graph.resources.end()) {
+                    it->second.lastPass = static_cast<uint32_t>(graph.passes.size());
                 }
             }
         }
-        
+
         Logger::Info("Resource lifetime analysis completed");
     }
 
-    void RenderGraph::OptimizeResourceAllocation() {
+    void RenderGraph::OptimizeResourceAllocation(CompiledRenderGraph& graph) {
         // メモリ使用量の最適化
         // リソースのエイリアシング（メモリ再利用）を実行
-        
+
         if (!settings.enableResourceAliasing) {
             Logger::Info("Resource aliasing disabled, skipping optimization");
             return;
         }
-        
+
         // ライフタイムが重複しないリソース同士をエイリアシング可能としてマーク
         std::vector<std::pair<uint32_t, ResourceInfo*>> transientResources;
-        
-        for (auto& [id, resource] : resources) {
+
+        for (auto& [id, resource] : graph.resources) {
             if (!resource.isExternal && resource.isTransient) {
                 transientResources.push_back({id, &resource});
             }
         }
-        
+
         // ライフタイムでソート
         std::sort(transientResources.begin(), transientResources.end(),
             [](const auto& a, const auto& b) {
                 return a.second->firstPass < b.second->firstPass;
             });
-        
+
         size_t optimizedResources = 0;
-        
+
         // 簡単な最適化：同じサイズとフォーマットのリソースをエイリアシング
         for (size_t i = 0; i < transientResources.size(); ++i) {
             for (size_t j = i + 1; j < transientResources.size(); ++j) {
                 ResourceInfo* resA = transientResources[i].second;
                 ResourceInfo* resB = transientResources[j].second;
-                
+
                 // ライフタイムが重複しないかチェック
                 if (resA->lastPass < resB->firstPass || resB->lastPass < resA->firstPass) {
                     // リソースの互換性をチェック
@@ -574,8 +901,8 @@ namespace Athena {
                 }
             }
         }
-        
-        Logger::Info("Resource allocation optimization completed, optimized {} resources", optimizedResources);
+
+        Logger::Info("Resource allocation optimization completed, optimized %zu resources", optimizedResources);
     }
 
     bool RenderGraph::ResourcesCompatible(const ResourceDesc& a, const ResourceDesc& b) const {
@@ -603,32 +930,29 @@ namespace Athena {
         return false;
     }
 
-    void RenderGraph::AnalyzeResourceBarriers() {
+    void RenderGraph::AnalyzeResourceBarriers(CompiledRenderGraph& graph) {
         // 全てのパスのバリアをクリア
-        for (auto& passInfo : passes) {
-            passInfo.preBarriers.clear();
-            passInfo.postBarriers.clear();
+        for (auto& compiledPass : graph.passes) {
+            compiledPass.preBarriers.clear();
+            compiledPass.postBarriers.clear();
         }
         
         // リソース状態を初期化
-        for (auto& [id, resource] : resources) {
+        for (auto& [id, resource] : graph.resources) {
             resource.currentState = D3D12_RESOURCE_STATE_COMMON;
         }
         
         // 実行順序に従ってバリアを挿入
-        for (size_t i = 0; i < executionOrder.size(); ++i) {
-            uint32_t passIndex = executionOrder[i];
-            if (passIndex >= passes.size()) continue;
-            
-            PassInfo& passInfo = passes[passIndex];
+        for (CompiledPass& compiledPass : graph.passes) {
+            const uint32_t passIndex = compiledPass.passIndex;
             
             // 入力リソースのバリア解析
-            for (const ResourceHandle& input : passInfo.inputs) {
+            for (const ResourceHandle& input : compiledPass.inputs) {
                 if (!input.IsValid()) continue;
                 
                 uint32_t resourceId = input.GetID();
-                auto it = resources.find(resourceId);
-                if (it == resources.end()) continue;
+                auto it = graph.resources.find(resourceId);
+                if (it == graph.resources.end()) continue;
                 
                 ResourceInfo& resourceInfo = it->second;
                 D3D12_RESOURCE_STATES requiredState = GetResourceStateFromUsage(input.GetDesc().usage, false);
@@ -641,18 +965,18 @@ namespace Athena {
                     transition.toState = requiredState;
                     transition.passIndex = passIndex;
                     
-                    passInfo.preBarriers.push_back(transition);
+                    compiledPass.preBarriers.push_back(transition);
                     resourceInfo.currentState = requiredState;
                 }
             }
             
             // 出力リソースのバリア解析
-            for (const ResourceHandle& output : passInfo.outputs) {
+            for (const ResourceHandle& output : compiledPass.outputs) {
                 if (!output.IsValid()) continue;
                 
                 uint32_t resourceId = output.GetID();
-                auto it = resources.find(resourceId);
-                if (it == resources.end()) continue;
+                auto it = graph.resources.find(resourceId);
+                if (it == graph.resources.end()) continue;
                 
                 ResourceInfo& resourceInfo = it->second;
                 D3D12_RESOURCE_STATES requiredState = GetResourceStateFromUsage(output.GetDesc().usage, true);
@@ -665,51 +989,27 @@ namespace Athena {
                     transition.toState = requiredState;
                     transition.passIndex = passIndex;
                     
-                    passInfo.preBarriers.push_back(transition);
+                    compiledPass.preBarriers.push_back(transition);
                     resourceInfo.currentState = requiredState;
                 }
             }
         }
         
         size_t totalBarriers = 0;
-        for (const auto& passInfo : passes) {
-            totalBarriers += passInfo.preBarriers.size() + passInfo.postBarriers.size();
+        for (const auto& compiledPass : graph.passes) {
+            totalBarriers += compiledPass.preBarriers.size() + compiledPass.postBarriers.size();
         }
         
-        Logger::Info("Resource barrier analysis completed, inserted {} barriers", totalBarriers);
+        Logger::Info("Resource barrier analysis completed, inserted %zu barriers", totalBarriers);
     }
 
     D3D12_RESOURCE_STATES RenderGraph::GetResourceStateFromUsage(ResourceUsage usage, bool isWrite) const {
-        // ResourceUsage列挙体の値に基づいて適切な状態を返す
-        if (HasUsage(usage, ResourceUsage::RenderTarget)) {
-            return D3D12_RESOURCE_STATE_RENDER_TARGET;
-        }
-        
-        if (HasUsage(usage, ResourceUsage::DepthStencil)) {
-            return isWrite ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_DEPTH_READ;
-        }
-        
-        if (HasUsage(usage, ResourceUsage::ShaderResource)) {
-            return D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
-        }
-        
-        if (HasUsage(usage, ResourceUsage::UnorderedAccess)) {
-            return D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-        }
-        
-        if (HasUsage(usage, ResourceUsage::CopyDestination)) {
-            return D3D12_RESOURCE_STATE_COPY_DEST;
-        }
-        
-        if (HasUsage(usage, ResourceUsage::CopySource)) {
-            return D3D12_RESOURCE_STATE_COPY_SOURCE;
-        }
-        
-        // デフォルト
-        return D3D12_RESOURCE_STATE_COMMON;
+        // 静的パイプラインと同じ規則を使用する
+        return GetResourceStateForUsage(usage, isWrite);
     }
 
     void RenderGraph::InsertResourceBarriers(ID3D12GraphicsCommandList* commandList,
+                                           const CompiledRenderGraph& graph,
                                            const std::vector<ResourceStateTransition>& barriers) {
         if (barriers.empty() || !commandList) {
             return;
@@ -719,8 +1019,8 @@ namespace Athena {
         d3dBarriers.reserve(barriers.size());
         
         for (const auto& transition : barriers) {
-            auto it = resources.find(transition.resourceId);
-            if (it == resources.end()) {
+            auto it = graph.resources.find(transition.resourceId);
+            if (it == graph.resources.end()) {
                 continue;
             }
             
@@ -757,13 +1057,13 @@ namespace Athena {
         if (!d3dBarriers.empty()) {
             commandList->ResourceBarrier(static_cast<UINT>(d3dBarriers.size()), d3dBarriers.data());
             
-            Logger::Info("Inserted {} resource barriers", d3dBarriers.size());
+            Logger::Info("Inserted %zu resource barriers", d3dBarriers.size());
         }
     }
 
-    bool RenderGraph::AllocateTransientResources() {
+    bool RenderGraph::AllocateTransientResources(CompiledRenderGraph& graph) {
         // 一時リソースの実際のオブジェクトを作成
-        for (auto& [id, resource] : resources) {
+        for (auto& [id, resource] : graph.resources) {
             if (resource.isExternal) {
                 continue; // 外部リソースはスキップ
             }
@@ -849,32 +1149,43 @@ namespace Athena {
     }
 
     void RenderGraph::ReleaseTexture(std::shared_ptr<Texture> texture) {
-        if (texture && texturePool.size() < settings.maxTransientResources) {
+        if (!texture) {
+            return;
+        }
+        if (texturePool.size() < settings.maxTransientResources) {
             texturePool.push_back(texture);
+        } else {
+            // プールに入らないものはGPUの完了後に破棄
+            DeferredReleaseQueue::DeferRelease(std::move(texture));
         }
     }
 
     void RenderGraph::ReleaseBuffer(std::shared_ptr<Buffer> buffer) {
-        if (buffer && bufferPool.size() < settings.maxTransientResources) {
+        if (!buffer) {
+            return;
+        }
+        if (bufferPool.size() < settings.maxTransientResources) {
             bufferPool.push_back(buffer);
+        } else {
+            DeferredReleaseQueue::DeferRelease(std::move(buffer));
         }
     }
 
-    bool RenderGraph::ValidateGraph() const {
-        if (passes.empty()) {
+    bool RenderGraph::ValidateGraph(const CompiledRenderGraph& graph) const {
+        if (graph.passes.empty()) {
             Logger::Warning("RenderGraph has no passes");
             return true; // 空のグラフは有効
         }
         
         // 各パスの検証
-        for (const auto& passInfo : passes) {
-            if (!ValidatePass(passInfo)) {
+        for (const auto& compiledPass : graph.passes) {
+            if (!ValidatePass(compiledPass)) {
                 return false;
             }
         }
         
         // 各リソースの検証
-        for (const auto& [id, resource] : resources) {
+        for (const auto& [id, resource] : graph.resources) {
             if (!ValidateResource(resource)) {
                 return false;
             }
@@ -883,13 +1194,13 @@ namespace Athena {
         return true;
     }
 
-    bool RenderGraph::ValidatePass(const PassInfo& passInfo) const {
-        if (!passInfo.pass) {
-            Logger::Error("PassInfo contains null pass");
+    bool RenderGraph::ValidatePass(const CompiledPass& compiledPass) const {
+        if (!compiledPass.pass) {
+            Logger::Error("CompiledPass contains null pass");
             return false;
         }
         
-        if (passInfo.pass->GetName().empty()) {
+        if (compiledPass.pass->GetName().empty()) {
             Logger::Error("Pass has empty name");
             return false;
         }
@@ -0,0 +1,132 @@
+#include "Athena/RenderGraph/RenderModeSelector.h"
+#include "Athena/RenderGraph/RenderGraph.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+
+namespace Athena {
+
+    namespace {
+        // 1回の計測で補正係数が極端に振れないよう比を制限する
+        constexpr float kMinCalibrationRatio = 0.1f;
+        constexpr float kMaxCalibrationRatio = 10.0f;
+
+        float ToMegaPixels(const RenderModeFrameInfo& info) {
+            return static_cast<float>(info.width) * static_cast<float>(info.height) / 1000000.0f;
+        }
+
+        const char* GetModeName(GeometryPass::RenderMode mode) {
+            return mode == GeometryPass::RenderMode::Deferred ? "Deferred" : "Forward";
+        }
+    }
+
+    RenderModeSelector::RenderModeSelector(GeometryPass::RenderMode initialMode,
+                                           const RenderModeSelectorSettings& settings)
+        : settings(settings)
+        , currentMode(initialMode) {
+    }
+
+    float RenderModeSelector::ForwardBaseCost(const RenderModeFrameInfo& info) const {
+        float lights = static_cast<float>(std::max<uint32_t>(info.lightCount, 1));
+        return ToMegaPixels(info) * (costModel.forwardPerPixel + costModel.forwardPerPixelLight * lights);
+    }
+
+    float RenderModeSelector::GBufferBaseCost(const RenderModeFrameInfo& info) const {
+        return ToMegaPixels(info) * costModel.gbufferPerPixel;
+    }
+
+    float RenderModeSelector::DeferredLightingBaseCost(const RenderModeFrameInfo& info) const {
+        float lights = static_cast<float>(std::max<uint32_t>(info.lightCount, 1));
+        return ToMegaPixels(info) * (costModel.deferredLightingPerPixel + costModel.deferredLightingPerPixelLight * lights);
+    }
+
+    float RenderModeSelector::PredictCost(GeometryPass::RenderMode mode, const RenderModeFrameInfo& info) const {
+        if (mode == GeometryPass::RenderMode::Deferred) {
+            return GBufferBaseCost(info) * gbufferScale + DeferredLightingBaseCost(info) * deferredLightingScale;
+        }
+        return ForwardBaseCost(info) * forwardScale;
+    }
+
+    void RenderModeSelector::Calibrate(float& scale, float measuredMs, float predictedMs) const {
+        if (measuredMs < 0.0f || predictedMs <= 0.0f) {
+            return;
+        }
+
+        float ratio = std::clamp(measuredMs / predictedMs, kMinCalibrationRatio, kMaxCalibrationRatio);
+        float smoothing = std::clamp(settings.calibrationSmoothing, 0.0f, 1.0f);
+        scale += (ratio - scale) * smoothing;
+    }
+
+    GeometryPass::RenderMode RenderModeSelector::Update(const RenderModeFrameInfo& info) {
+        // 実際に描画したモードの補正係数を更新
+        if (info.measuredMode == GeometryPass::RenderMode::Deferred) {
+            Calibrate(gbufferScale, info.geometryPassMs, GBufferBaseCost(info));
+            Calibrate(deferredLightingScale, info.lightingPassMs, DeferredLightingBaseCost(info));
+        } else {
+            Calibrate(forwardScale, info.geometryPassMs, ForwardBaseCost(info));
+        }
+
+        if (framesSinceSwitch < settings.minFramesBetweenSwitches) {
+            framesSinceSwitch++;
+        }
+
+        GeometryPass::RenderMode otherMode = (currentMode == GeometryPass::RenderMode::Forward)
+            ? GeometryPass::RenderMode::Deferred
+            : GeometryPass::RenderMode::Forward;
+
+        float currentCost = PredictCost(currentMode, info);
+        float otherCost = PredictCost(otherMode, info);
+
+        // ヒステリシス：閾値以上安い状態が続いた場合のみ切り替える
+        if (otherCost < currentCost * (1.0f - settings.switchThreshold)) {
+            pendingSwitchFrames++;
+        } else {
+            pendingSwitchFrames = 0;
+        }
+
+        if (pendingSwitchFrames >= settings.confirmFrames &&
+            framesSinceSwitch >= settings.minFramesBetweenSwitches) {
+            Logger::Info("RenderModeSelector: %s -> %s (predicted %.3f ms -> %.3f ms, %u lights, %ux%u)",
+                        GetModeName(currentMode), GetModeName(otherMode),
+                        currentCost, otherCost, info.lightCount, info.width, info.height);
+
+            currentMode = otherMode;
+            pendingSwitchFrames = 0;
+            framesSinceSwitch = 0;
+            switchCount++;
+        }
+
+        return currentMode;
+    }
+
+    bool RenderModeSelector::ApplyToGraph(RenderGraph& graph, const RenderModePassSets& passSets) const {
+        bool deferred = IsDeferred();
+        bool changed = false;
+
+        // 先に無効化してから有効化する（両方に含まれるパスは有効のまま）
+        const auto& disabledPasses = deferred ? passSets.forwardPasses : passSets.deferredPasses;
+        const auto& enabledPasses = deferred ? passSets.deferredPasses : passSets.forwardPasses;
+
+        for (uint32_t passIndex : disabledPasses) {
+            changed |= graph.SetPassEnabled(passIndex, false);
+        }
+        for (uint32_t passIndex : enabledPasses) {
+            changed |= graph.SetPassEnabled(passIndex, true);
+        }
+
+        if (changed) {
+            graph.CompileAsync();
+        }
+        return changed;
+    }
+
+    void RenderModeSelector::Reset(GeometryPass::RenderMode mode) {
+        currentMode = mode;
+        forwardScale = 1.0f;
+        gbufferScale = 1.0f;
+        deferredLightingScale = 1.0f;
+        framesSinceSwitch = 0;
+        pendingSwitchFrames = 0;
+        switchCount = 0;
+    }
+
+} // namespace Athena
\ No newline at end of file
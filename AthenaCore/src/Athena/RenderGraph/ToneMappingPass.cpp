@@ -1,6 +1,10 @@
 #include "Athena/RenderGraph/ToneMappingPass.h"
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Resources/RootSignatureCache.h"
+#include "Athena/Resources/ShaderCache.h"
 #include "Athena/Utils/Logger.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Resources/ConstantBufferAllocator.h"
 #include <d3dcompiler.h>
 #include <stdexcept>
 
@@ -14,35 +18,29 @@ namespace Athena {
         Logger::Info("ToneMappingPass: Setup started");
 
         // パイプライン状態を作成
-        CreateRootSignature(setupData.device);
+        rootSignature = RootSignatureCache::LoadGlobalRootSignature(setupData.device);
         CreatePipelineState(setupData.device);
 
-        // 定数バッファ初期化
-        constantBuffer = std::make_unique<Buffer>();
-        constantBuffer->Initialize(
-            setupData.device,
-            sizeof(ToneMappingConstants),
-            BufferType::Constant,
-            D3D12_HEAP_TYPE_UPLOAD
-        );
-
         Logger::Info("ToneMappingPass: Setup completed");
     }
 
     void ToneMappingPass::Execute(const PassExecuteData& executeData) {
         auto* commandList = executeData.commandList;
 
-        // 定数バッファ更新
+        if (!executeData.constantAllocator) {
+            throw std::runtime_error("ToneMappingPass: PassExecuteData::constantAllocator is not set");
+        }
+
+        // 定数はフレーム単位のアロケータから毎回新しい領域に書き込む
         UpdateConstants();
+        D3D12_GPU_VIRTUAL_ADDRESS constantAddress = executeData.constantAllocator->Allocate(constants).gpuAddress;
 
         // パイプライン設定
         commandList->SetPipelineState(pipelineState.Get());
         commandList->SetGraphicsRootSignature(rootSignature.Get());
 
         // 定数バッファ設定
-        commandList->SetGraphicsRootConstantBufferView(
-            0, constantBuffer->GetGPUVirtualAddress()
-        );
+        commandList->SetGraphicsRootConstantBufferView(RootSignatureCache::Constants, constantAddress);
 
         // HDRテクスチャ設定
         if (hdrTexture && executeData.srvHeap) {
@@ -51,7 +49,7 @@ namespace Athena {
 
             // HDRテクスチャのSRVを設定
             D3D12_GPU_DESCRIPTOR_HANDLE srvHandle = executeData.srvHeap->GetGPUDescriptorHandleForHeapStart();
-            commandList->SetGraphicsRootDescriptorTable(1, srvHandle);
+            commandList->SetGraphicsRootDescriptorTable(RootSignatureCache::Textures, srvHandle);
         }
 
         // フルスクリーンクアッドの描画
@@ -60,7 +58,7 @@ namespace Athena {
     }
 
     void ToneMappingPass::UpdateConstants() {
-        ToneMappingConstants constants = {};
+        constants = {};
         constants.exposure = exposure;
         constants.gamma = gamma;
         constants.toneMappingMethod = static_cast<int>(toneMappingMethod);
@@ -68,80 +66,6 @@ namespace Athena {
         constants.contrast = contrast;
         constants.brightness = brightness;
         constants.saturation = saturation;
-
-        constantBuffer->Upload(&constants, sizeof(ToneMappingConstants));
-    }
-
-    void ToneMappingPass::CreateRootSignature(ID3D12Device* device) {
-        // ルートパラメータ
-        D3D12_ROOT_PARAMETER rootParams[2] = {};
-
-        // 定数バッファ（b0）
-        rootParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
-        rootParams[0].Descriptor.ShaderRegister = 0;
-        rootParams[0].Descriptor.RegisterSpace = 0;
-        rootParams[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
-
-        // HDRテクスチャ（t0）
-        D3D12_DESCRIPTOR_RANGE texRange = {};
-        texRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-        texRange.NumDescriptors = 1;
-        texRange.BaseShaderRegister = 0;
-        texRange.RegisterSpace = 0;
-        texRange.OffsetInDescriptorsFromTableStart = 0;
-
-        rootParams[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-        rootParams[1].DescriptorTable.NumDescriptorRanges = 1;
-        rootParams[1].DescriptorTable.pDescriptorRanges = &texRange;
-        rootParams[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-
-        // サンプラー（バイリニアフィルタリング）
-        D3D12_STATIC_SAMPLER_DESC sampler = {};
-        sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
-        sampler.AddressU = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
-        sampler.AddressV = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
-        sampler.AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
-        sampler.MipLODBias = 0.0f;
-        sampler.MaxAnisotropy = 1;
-        sampler.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
-        sampler.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK;
-        sampler.MinLOD = 0.0f;
-        sampler.MaxLOD = D3D12_FLOAT32_MAX;
-        sampler.ShaderRegister = 0;
-        sampler.RegisterSpace = 0;
-        sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-
-        // ルートシグネチャ記述
-        D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
-        rootSigDesc.NumParameters = 2;
-        rootSigDesc.pParameters = rootParams;
-        rootSigDesc.NumStaticSamplers = 1;
-        rootSigDesc.pStaticSamplers = &sampler;
-        rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
-
-        // シリアライズ
-        ComPtr<ID3DBlob> signature;
-        ComPtr<ID3DBlob> error;
-        HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
-        if (FAILED(hr)) {
-            if (error) {
-                Logger::Error("Root signature error: %s", (char*)error->GetBufferPointer());
-            }
-            throw std::runtime_error("Failed to serialize root signature");
-        }
-
-        // ルートシグネチャ作成
-        hr = device->CreateRootSignature(
-            0,
-            signature->GetBufferPointer(),
-            signature->GetBufferSize(),
-            IID_PPV_ARGS(&rootSignature)
-        );
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create root signature");
-        }
-
-        Logger::Info("ToneMappingPass: Root signature created");
     }
 
     void ToneMappingPass::CreatePipelineState(ID3D12Device* device) {
@@ -167,11 +91,8 @@ namespace Athena {
         psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM; // LDRフォーマット
         psoDesc.SampleDesc.Count = 1;
 
-        // パイプライン状態作成
-        HRESULT hr = device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create pipeline state");
-        }
+        // パイプライン状態作成（PipelineCache にあれば再利用）
+        pipelineState = PipelineCache::LoadGraphicsPipeline(device, psoDesc);
 
         Logger::Info("ToneMappingPass: Pipeline state created");
     }
@@ -179,30 +100,7 @@ namespace Athena {
     ComPtr<ID3DBlob> ToneMappingPass::CompileShader(const std::wstring& filepath,
                                                    const std::string& entryPoint,
                                                    const std::string& target) {
-        UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-
-        ComPtr<ID3DBlob> shader;
-        ComPtr<ID3DBlob> error;
-
-        HRESULT hr = D3DCompileFromFile(
-            filepath.c_str(),
-            nullptr, nullptr,
-            entryPoint.c_str(),
-            target.c_str(),
-            compileFlags, 0,
-            &shader, &error
-        );
-
-        if (FAILED(hr)) {
-            if (error) {
-                Logger::Error("Shader compilation failed: %s", (char*)error->GetBufferPointer());
-            }
-            Logger::Error("Failed to compile shader: %S", filepath.c_str());
-            throw std::runtime_error("Failed to compile shader");
-        }
-
-        Logger::Info("Shader compiled: %S", filepath.c_str());
-        return shader;
+        return ShaderCache::LoadShader(filepath, entryPoint, target);
     }
 
 } // namespace Athena
\ No newline at end of file
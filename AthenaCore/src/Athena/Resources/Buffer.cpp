@@ -1,8 +1,11 @@
 #include "Athena/Resources/Buffer.h"
-#include "Athena/Resources/UploadContext.h"
+#include "Athena/Resources/UploadScheduler.h"
+#include "Athena/Resources/MemoryBudgetManager.h"
+#include "Athena/Core/DeferredReleaseQueue.h"
 #include "Athena/Utils/Logger.h"
 #include <stdexcept>
 #include <vector>
+#include <memory>
 
 namespace Athena {
 
@@ -16,13 +19,26 @@ namespace Athena {
         ID3D12Device* device,
         uint64_t size,
         BufferType type,
-        D3D12_HEAP_TYPE heapType) {
+        D3D12_HEAP_TYPE heapType,
+        GpuMemoryAllocator* memoryAllocator) {
+
+        // 再初期化の場合は以前のリソースを解放
+        if (resource) {
+            Shutdown();
+        }
 
         this->size = size;
         this->type = type;
         this->heapType = heapType;
 
-        CreateResource(device);
+        CreateResource(device, memoryAllocator);
+
+        // 予算管理に登録（ヒープに配置したリソースはヒープ単位のため個別に退避しない）
+        MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal();
+        if (budgetManager && heapType == D3D12_HEAP_TYPE_DEFAULT) {
+            residencyId = budgetManager->Register(
+                static_cast<ID3D12Pageable*>(resource.Get()), BudgetCategory::Buffer, size, !allocation.IsValid());
+        }
 
         Logger::Info("Buffer initialized (size: %llu bytes, type: %d)", size, static_cast<int>(type));
     }
@@ -31,7 +47,29 @@ namespace Athena {
         if (mappedData) {
             Unmap();
         }
-        resource.Reset();
+
+        if (residencyId != MemoryBudgetManager::InvalidId) {
+            if (MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal()) {
+                budgetManager->Unregister(residencyId);
+            }
+            residencyId = MemoryBudgetManager::InvalidId;
+        }
+
+        // GPUが参照中の可能性があるため、フレームの完了まで解放を遅らせる
+        if (resource) {
+            DeferredReleaseQueue::DeferRelease(std::move(resource));
+        }
+        if (allocation.IsValid()) {
+            DeferredReleaseQueue::DeferRelease(std::move(allocation));
+        }
+    }
+
+    void Buffer::MarkUsed() const {
+        if (residencyId != MemoryBudgetManager::InvalidId) {
+            if (MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal()) {
+                budgetManager->MarkUsed(residencyId);
+            }
+        }
     }
 
     void Buffer::Upload(const void* data, uint64_t dataSize, uint64_t offset) {
@@ -50,78 +88,52 @@ namespace Athena {
             Unmap();
         }
         else {
-            // DEFAULTヒープの場合はUploadWithDeviceメソッドを使用する必要がある
-            throw std::runtime_error("Upload to DEFAULT heap requires device and command queue. Use UploadWithDevice() method instead.");
+            // DEFAULTヒープは呼び出し側が所有する UploadScheduler 経由で転送する
+            throw std::runtime_error("Upload to DEFAULT heap requires an UploadScheduler. Use UploadWithScheduler() instead.");
         }
     }
 
-    void Buffer::UploadWithDevice(const void* data, uint64_t dataSize, 
-                                ID3D12Device* device, ID3D12CommandQueue* commandQueue,
-                                uint64_t offset) {
+    void Buffer::UploadWithScheduler(const void* data, uint64_t dataSize, UploadScheduler& scheduler,
+                                     uint64_t offset, D3D12_RESOURCE_STATES finalState) {
         if (!data) {
             throw std::invalid_argument("Upload data is null");
         }
 
-        if (!device || !commandQueue) {
-            throw std::invalid_argument("Device or command queue is null");
-        }
-
         if (offset + dataSize > size) {
             throw std::out_of_range("Upload size exceeds buffer size");
         }
 
-        // UPLOADヒープの場合は通常のUploadメソッドを使用
-        if (heapType == D3D12_HEAP_TYPE_UPLOAD) {
-            void* mapped = Map();
-            memcpy(static_cast<uint8_t*>(mapped) + offset, data, dataSize);
-            Unmap();
+        if (heapType != D3D12_HEAP_TYPE_DEFAULT) {
+            Upload(data, dataSize, offset);
             return;
         }
 
-        // DEFAULTヒープの場合はUploadContextを使用
-        if (heapType == D3D12_HEAP_TYPE_DEFAULT) {
-            UploadContext uploadContext;
-            uploadContext.Initialize(device, commandQueue);
-
-            uploadContext.Begin();
-
-            // リソースバリア: COMMON -> COPY_DEST
-            uploadContext.TransitionResource(
-                resource.Get(),
-                D3D12_RESOURCE_STATE_COMMON,
-                D3D12_RESOURCE_STATE_COPY_DEST
-            );
-
-            // データをアップロード
-            if (offset == 0 && dataSize == size) {
-                // 全体のアップロード
-                uploadContext.UploadBuffer(resource.Get(), data, dataSize);
-            } else {
-                // 部分的なアップロード（簡易実装）
-                // 一時的な全体バッファを作成してコピー
-                std::vector<uint8_t> tempBuffer(size);
-                
-                // 既存データの読み取りは困難なので、ここでは警告を出力
-                Logger::Warning("Partial upload to DEFAULT heap may overwrite existing data");
-                
-                memcpy(tempBuffer.data() + offset, data, dataSize);
-                uploadContext.UploadBuffer(resource.Get(), tempBuffer.data(), size);
-            }
+        // 転送先オフセットに直接コピーするため、部分アップロードでも既存データを壊さない
+        scheduler.UploadBuffer(resource.Get(), data, dataSize, offset, finalState);
+    }
 
-            // リソースバリア: COPY_DEST -> COMMON
-            uploadContext.TransitionResource(
-                resource.Get(),
-                D3D12_RESOURCE_STATE_COPY_DEST,
-                D3D12_RESOURCE_STATE_COMMON
-            );
+    void Buffer::EnqueueUpload(const void* data, uint64_t dataSize, StreamingUploadQueue& queue,
+                               UploadPriority priority, D3D12_RESOURCE_STATES finalState,
+                               std::function<void()> onComplete) {
+        if (!data) {
+            throw std::invalid_argument("Upload data is null");
+        }
 
-            uploadContext.End();
-            uploadContext.Shutdown();
+        if (dataSize > size) {
+            throw std::out_of_range("Upload size exceeds buffer size");
+        }
 
-            Logger::Info("Buffer data uploaded to DEFAULT heap (size: %llu bytes, offset: %llu)", dataSize, offset);
-        } else {
-            throw std::runtime_error("Unsupported heap type for upload");
+        if (heapType != D3D12_HEAP_TYPE_DEFAULT) {
+            Upload(data, dataSize, 0);
+            if (onComplete) {
+                onComplete();
+            }
+            return;
         }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        queue.EnqueueBuffer(resource.Get(), std::vector<uint8_t>(bytes, bytes + dataSize), priority,
+                            finalState, std::move(onComplete));
     }
 
     void* Buffer::Map() {
@@ -173,7 +185,7 @@ namespace Athena {
         return cbvDesc;
     }
 
-    void Buffer::CreateResource(ID3D12Device* device) {
+    void Buffer::CreateResource(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator) {
         // �o�b�t�@���\�[�X�̐ݒ�
         D3D12_RESOURCE_DESC resourceDesc = {};
         resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
@@ -197,7 +209,17 @@ namespace Athena {
         heapProps.VisibleNodeMask = 1;
 
         // ���\�[�X���
-        D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_GENERIC_READ;
+        // DEFAULTヒープはCOMMONで作成（コピーキューでの書き込みと、読み取り状態への暗黙の昇格が可能）
+        D3D12_RESOURCE_STATES initialState = (heapType == D3D12_HEAP_TYPE_DEFAULT)
+            ? D3D12_RESOURCE_STATE_COMMON
+            : D3D12_RESOURCE_STATE_GENERIC_READ;
+
+        // アロケータ指定時はヒープブロックに配置する
+        if (memoryAllocator) {
+            allocation = memoryAllocator->CreateResource(resourceDesc, heapType, initialState);
+            resource = allocation.GetResource();
+            return;
+        }
 
         // ���\�[�X�쐬
         HRESULT hr = device->CreateCommittedResource(
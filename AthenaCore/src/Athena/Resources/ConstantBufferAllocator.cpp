@@ -0,0 +1,92 @@
+#include "Athena/Resources/ConstantBufferAllocator.h"
+#include "Athena/Utils/Logger.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    ConstantBufferAllocator::~ConstantBufferAllocator() {
+        Shutdown();
+    }
+
+    void ConstantBufferAllocator::Initialize(ID3D12Device* device, uint64_t bytesPerFrame, uint32_t frameCount) {
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+        if (bytesPerFrame == 0 || frameCount == 0) {
+            throw std::invalid_argument("Constant buffer partition size and count must be non-zero");
+        }
+
+        Shutdown();
+
+        // パーティションの先頭も256バイト境界に揃える
+        bytesPerFrame = (bytesPerFrame + Alignment - 1) & ~(Alignment - 1);
+        allocator.Reset(bytesPerFrame, frameCount);
+
+        D3D12_HEAP_PROPERTIES uploadHeapProps = {};
+        uploadHeapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+        D3D12_RESOURCE_DESC bufferDesc = {};
+        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        bufferDesc.Width = allocator.GetCapacity();
+        bufferDesc.Height = 1;
+        bufferDesc.DepthOrArraySize = 1;
+        bufferDesc.MipLevels = 1;
+        bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
+        bufferDesc.SampleDesc.Count = 1;
+        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+        HRESULT hr = device->CreateCommittedResource(
+            &uploadHeapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&resource)
+        );
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create constant buffer allocator");
+        }
+
+        // 永続マップ（CPUからは読み込まない）
+        D3D12_RANGE readRange = { 0, 0 };
+        hr = resource->Map(0, &readRange, reinterpret_cast<void**>(&mappedData));
+        if (FAILED(hr)) {
+            resource.Reset();
+            throw std::runtime_error("Failed to map constant buffer allocator");
+        }
+        gpuStart = resource->GetGPUVirtualAddress();
+
+        Logger::Info("ConstantBufferAllocator initialized: %llu bytes x %u frames",
+                    static_cast<unsigned long long>(bytesPerFrame), frameCount);
+    }
+
+    void ConstantBufferAllocator::Shutdown() {
+        if (resource && mappedData) {
+            resource->Unmap(0, nullptr);
+        }
+        mappedData = nullptr;
+        gpuStart = 0;
+        resource.Reset();
+        allocator.Reset(0, 0);
+    }
+
+    ConstantAllocation ConstantBufferAllocator::Allocate(uint64_t size) {
+        if (!resource) {
+            throw std::runtime_error("ConstantBufferAllocator is not initialized");
+        }
+
+        // 定数バッファビューのサイズも256バイト単位にする
+        uint64_t alignedSize = (size + Alignment - 1) & ~(Alignment - 1);
+        uint64_t offset = allocator.Allocate(alignedSize, Alignment);
+        if (offset == FrameLinearAllocator::InvalidOffset) {
+            throw std::runtime_error("Constant buffer partition is full");
+        }
+
+        ConstantAllocation allocation;
+        allocation.cpuAddress = mappedData + offset;
+        allocation.gpuAddress = gpuStart + offset;
+        allocation.size = alignedSize;
+        return allocation;
+    }
+
+} // namespace Athena
@@ -0,0 +1,43 @@
+#include "Athena/Resources/D3D12Residency.h"
+#include "Athena/Utils/Logger.h"
+
+namespace Athena {
+
+    MemoryBudgetInfo DxgiMemoryBudgetSource::QueryBudget() {
+        MemoryBudgetInfo info;
+        if (!adapter) {
+            return info;
+        }
+
+        DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo = {};
+        HRESULT hr = adapter->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &videoMemoryInfo);
+        if (FAILED(hr)) {
+            Logger::Warning("QueryVideoMemoryInfo failed (hr: 0x%08X)", static_cast<unsigned int>(hr));
+            return info;
+        }
+
+        info.budget = videoMemoryInfo.Budget;
+        info.currentUsage = videoMemoryInfo.CurrentUsage;
+        return info;
+    }
+
+    bool D3D12ResidencyBackend::Evict(void* object) {
+        ID3D12Pageable* pageable = static_cast<ID3D12Pageable*>(object);
+        return pageable && SUCCEEDED(device->Evict(1, &pageable));
+    }
+
+    bool D3D12ResidencyBackend::MakeResident(void* object) {
+        ID3D12Pageable* pageable = static_cast<ID3D12Pageable*>(object);
+        if (!pageable) {
+            return false;
+        }
+
+        HRESULT hr = device->MakeResident(1, &pageable);
+        if (FAILED(hr)) {
+            Logger::Error("MakeResident failed (hr: 0x%08X)", static_cast<unsigned int>(hr));
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Athena
@@ -0,0 +1,61 @@
+#include "Athena/Resources/FrameLinearAllocator.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Athena {
+
+    void FrameLinearAllocator::Reset(uint64_t bytesPerFrame, uint32_t frameCount) {
+        this->bytesPerFrame = bytesPerFrame;
+        partitionFences.assign(frameCount, 0);
+        currentPartition = 0;
+        usedSize = 0;
+        peakUsedSize = 0;
+    }
+
+    bool FrameLinearAllocator::CanBeginFrame(uint64_t completedFenceValue) const {
+        if (partitionFences.empty()) {
+            return true;
+        }
+
+        uint32_t next = (currentPartition + 1) % static_cast<uint32_t>(partitionFences.size());
+        return partitionFences[next] <= completedFenceValue;
+    }
+
+    void FrameLinearAllocator::BeginFrame(uint64_t completedFenceValue) {
+        if (partitionFences.empty()) {
+            return;
+        }
+        if (!CanBeginFrame(completedFenceValue)) {
+            throw std::runtime_error("Frame linear allocator partition is still in use by the GPU");
+        }
+
+        currentPartition = (currentPartition + 1) % static_cast<uint32_t>(partitionFences.size());
+        usedSize = 0;
+    }
+
+    void FrameLinearAllocator::EndFrame(uint64_t fenceValue) {
+        if (!partitionFences.empty()) {
+            partitionFences[currentPartition] = fenceValue;
+        }
+    }
+
+    uint64_t FrameLinearAllocator::Allocate(uint64_t size, uint64_t alignment) {
+        if (partitionFences.empty() || size == 0) {
+            return InvalidOffset;
+        }
+        if (alignment == 0) {
+            alignment = 1;
+        }
+
+        // パーティションの先頭はアライメント済みとして、パーティション内のオフセットを揃える
+        uint64_t offset = (usedSize + alignment - 1) & ~(alignment - 1);
+        if (offset > bytesPerFrame || size > bytesPerFrame - offset) {
+            return InvalidOffset;
+        }
+
+        usedSize = offset + size;
+        peakUsedSize = std::max(peakUsedSize, usedSize);
+        return static_cast<uint64_t>(currentPartition) * bytesPerFrame + offset;
+    }
+
+} // namespace Athena
@@ -0,0 +1,348 @@
+#include "Athena/Resources/GpuMemoryAllocator.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Athena {
+
+    namespace {
+        const char* GetCategoryName(GpuResourceCategory category) {
+            switch (category) {
+            case GpuResourceCategory::Buffer: return "Buffer";
+            case GpuResourceCategory::Texture: return "Texture";
+            case GpuResourceCategory::RenderTargetDepth: return "RT/DS";
+            }
+            return "Unknown";
+        }
+
+        const char* GetHeapTypeName(D3D12_HEAP_TYPE heapType) {
+            switch (heapType) {
+            case D3D12_HEAP_TYPE_DEFAULT: return "Default";
+            case D3D12_HEAP_TYPE_UPLOAD: return "Upload";
+            case D3D12_HEAP_TYPE_READBACK: return "Readback";
+            default: return "Custom";
+            }
+        }
+    }
+
+    // =====================================================
+    // GpuMemoryBlock
+    // =====================================================
+
+    GpuMemoryBlock::GpuMemoryBlock(ComPtr<ID3D12Heap> heap, uint64_t size)
+        : heap(std::move(heap))
+        , allocator(size, D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT) {
+    }
+
+    TlsfAllocator::Allocation GpuMemoryBlock::Allocate(uint64_t size, uint64_t alignment) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return allocator.Allocate(size, alignment);
+    }
+
+    void GpuMemoryBlock::Free(const TlsfAllocator::Allocation& allocation) {
+        std::lock_guard<std::mutex> lock(mutex);
+        allocator.Free(allocation);
+    }
+
+    TlsfAllocator::Stats GpuMemoryBlock::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return allocator.GetStats();
+    }
+
+    bool GpuMemoryBlock::IsEmpty() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return allocator.IsEmpty();
+    }
+
+    // =====================================================
+    // GpuAllocation
+    // =====================================================
+
+    GpuAllocation::~GpuAllocation() {
+        Release();
+    }
+
+    GpuAllocation::GpuAllocation(GpuAllocation&& other) noexcept
+        : resource(std::move(other.resource))
+        , block(std::move(other.block))
+        , range(other.range) {
+        other.range = {};
+    }
+
+    GpuAllocation& GpuAllocation::operator=(GpuAllocation&& other) noexcept {
+        if (this != &other) {
+            Release();
+            resource = std::move(other.resource);
+            block = std::move(other.block);
+            range = other.range;
+            other.range = {};
+        }
+        return *this;
+    }
+
+    void GpuAllocation::Release() {
+        // 領域を再利用される前にリソースを解放する
+        resource.Reset();
+        if (block) {
+            block->Free(range);
+            block.reset();
+        }
+        range = {};
+    }
+
+    // =====================================================
+    // GpuMemoryAllocator
+    // =====================================================
+
+    GpuMemoryAllocator::~GpuMemoryAllocator() {
+        Shutdown();
+    }
+
+    void GpuMemoryAllocator::Initialize(ID3D12Device* device, uint64_t blockSize) {
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+
+        // MSAAリソースを配置できるよう4MB単位に揃える
+        const uint64_t heapAlignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+        this->device = device;
+        this->blockSize = (std::max(blockSize, heapAlignment) + heapAlignment - 1) & ~(heapAlignment - 1);
+
+        Logger::Info("GpuMemoryAllocator initialized: block size %llu MB",
+                    static_cast<unsigned long long>(this->blockSize / (1024 * 1024)));
+    }
+
+    void GpuMemoryAllocator::Shutdown() {
+        std::lock_guard<std::mutex> lock(mutex);
+        pools.clear();
+        device.Reset();
+    }
+
+    GpuAllocation GpuMemoryAllocator::CreateResource(
+        const D3D12_RESOURCE_DESC& desc,
+        D3D12_HEAP_TYPE heapType,
+        D3D12_RESOURCE_STATES initialState,
+        const D3D12_CLEAR_VALUE* clearValue) {
+
+        if (!device) {
+            throw std::runtime_error("GpuMemoryAllocator is not initialized");
+        }
+
+        GpuResourceCategory category = GetCategory(desc);
+        D3D12_RESOURCE_DESC placedDesc = desc;
+        D3D12_RESOURCE_ALLOCATION_INFO info = {};
+
+        // 小さなテクスチャは4KBアライメントを試す（使用できない場合は0が返る）
+        if (category == GpuResourceCategory::Texture && desc.SampleDesc.Count <= 1) {
+            placedDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+            info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+            if (info.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT) {
+                placedDesc.Alignment = 0;
+                info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+            }
+        }
+        else {
+            placedDesc.Alignment = 0;
+            info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+        }
+
+        if (info.SizeInBytes == UINT64_MAX) {
+            throw std::invalid_argument("Invalid resource description");
+        }
+
+        // ブロックを占有するような大きなリソースは個別に作成する
+        if (info.SizeInBytes > blockSize / 2) {
+            return CreateCommitted(desc, heapType, initialState, clearValue);
+        }
+
+        GpuAllocation allocation;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Pool& pool = GetPool(heapType, category, info.Alignment);
+
+            for (const auto& block : pool.blocks) {
+                allocation.range = block->Allocate(info.SizeInBytes, info.Alignment);
+                if (allocation.range.IsValid()) {
+                    allocation.block = block;
+                    break;
+                }
+            }
+
+            if (!allocation.block) {
+                auto block = CreateBlock(pool);
+                pool.blocks.push_back(block);
+                allocation.range = block->Allocate(info.SizeInBytes, info.Alignment);
+                allocation.block = block;
+            }
+        }
+
+        HRESULT hr = device->CreatePlacedResource(
+            allocation.block->GetHeap(),
+            allocation.range.offset,
+            &placedDesc,
+            initialState,
+            clearValue,
+            IID_PPV_ARGS(&allocation.resource)
+        );
+
+        if (FAILED(hr)) {
+            allocation.Release();
+            throw std::runtime_error("Failed to create placed resource");
+        }
+
+        return allocation;
+    }
+
+    uint32_t GpuMemoryAllocator::TrimEmptyBlocks() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        uint32_t released = 0;
+        for (auto& pool : pools) {
+            for (size_t i = pool.blocks.size(); i-- > 1;) {
+                if (pool.blocks[i]->IsEmpty()) {
+                    pool.blocks.erase(pool.blocks.begin() + i);
+                    released++;
+                }
+            }
+        }
+        return released;
+    }
+
+    std::vector<GpuMemoryPoolStats> GpuMemoryAllocator::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        std::vector<GpuMemoryPoolStats> result;
+        result.reserve(pools.size());
+        for (const auto& pool : pools) {
+            GpuMemoryPoolStats stats;
+            stats.heapType = pool.heapType;
+            stats.category = pool.category;
+            stats.alignment = pool.alignment;
+            stats.blockCount = static_cast<uint32_t>(pool.blocks.size());
+
+            for (const auto& block : pool.blocks) {
+                TlsfAllocator::Stats blockStats = block->GetStats();
+                stats.usage.totalSize += blockStats.totalSize;
+                stats.usage.usedSize += blockStats.usedSize;
+                stats.usage.freeSize += blockStats.freeSize;
+                stats.usage.allocationCount += blockStats.allocationCount;
+                stats.usage.freeBlockCount += blockStats.freeBlockCount;
+                stats.usage.largestFreeBlock = std::max(stats.usage.largestFreeBlock, blockStats.largestFreeBlock);
+            }
+            result.push_back(stats);
+        }
+        return result;
+    }
+
+    void GpuMemoryAllocator::LogStats() const {
+        auto stats = GetStats();
+
+        Logger::Info("GpuMemoryAllocator: %zu pools, %llu committed fallbacks",
+                    stats.size(), static_cast<unsigned long long>(committedFallbackCount));
+        for (const auto& pool : stats) {
+            Logger::Info("  [%s/%s/%lluKB] blocks: %u, used: %.1f/%.1f MB (%.0f%%), allocations: %u, fragmentation: %.2f",
+                        GetHeapTypeName(pool.heapType),
+                        GetCategoryName(pool.category),
+                        static_cast<unsigned long long>(pool.alignment / 1024),
+                        pool.blockCount,
+                        pool.usage.usedSize / (1024.0 * 1024.0),
+                        pool.usage.totalSize / (1024.0 * 1024.0),
+                        pool.usage.GetUtilization() * 100.0f,
+                        pool.usage.allocationCount,
+                        pool.usage.GetFragmentation());
+        }
+    }
+
+    GpuResourceCategory GpuMemoryAllocator::GetCategory(const D3D12_RESOURCE_DESC& desc) {
+        if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+            return GpuResourceCategory::Buffer;
+        }
+        if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) {
+            return GpuResourceCategory::RenderTargetDepth;
+        }
+        return GpuResourceCategory::Texture;
+    }
+
+    GpuMemoryAllocator::Pool& GpuMemoryAllocator::GetPool(
+        D3D12_HEAP_TYPE heapType, GpuResourceCategory category, uint64_t alignment) {
+
+        for (auto& pool : pools) {
+            if (pool.heapType == heapType && pool.category == category && pool.alignment == alignment) {
+                return pool;
+            }
+        }
+
+        pools.push_back({ heapType, category, alignment, {} });
+        return pools.back();
+    }
+
+    std::shared_ptr<GpuMemoryBlock> GpuMemoryAllocator::CreateBlock(const Pool& pool) {
+        D3D12_HEAP_DESC heapDesc = {};
+        heapDesc.SizeInBytes = blockSize;
+        heapDesc.Properties.Type = pool.heapType;
+        heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Properties.CreationNodeMask = 1;
+        heapDesc.Properties.VisibleNodeMask = 1;
+        heapDesc.Alignment = (pool.alignment > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)
+            ? D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT
+            : D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+
+        switch (pool.category) {
+        case GpuResourceCategory::Buffer:
+            heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+            break;
+        case GpuResourceCategory::Texture:
+            heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+            break;
+        case GpuResourceCategory::RenderTargetDepth:
+            heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+            break;
+        }
+
+        ComPtr<ID3D12Heap> heap;
+        HRESULT hr = device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create memory heap");
+        }
+
+        Logger::Info("GpuMemoryAllocator: new %s/%s heap block (%llu MB)",
+                    GetHeapTypeName(pool.heapType), GetCategoryName(pool.category),
+                    static_cast<unsigned long long>(blockSize / (1024 * 1024)));
+
+        return std::make_shared<GpuMemoryBlock>(std::move(heap), blockSize);
+    }
+
+    GpuAllocation GpuMemoryAllocator::CreateCommitted(
+        const D3D12_RESOURCE_DESC& desc,
+        D3D12_HEAP_TYPE heapType,
+        D3D12_RESOURCE_STATES initialState,
+        const D3D12_CLEAR_VALUE* clearValue) {
+
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = heapType;
+        heapProps.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapProps.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+        heapProps.CreationNodeMask = 1;
+        heapProps.VisibleNodeMask = 1;
+
+        GpuAllocation allocation;
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &desc,
+            initialState,
+            clearValue,
+            IID_PPV_ARGS(&allocation.resource)
+        );
+
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create committed resource");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        committedFallbackCount++;
+        return allocation;
+    }
+
+} // namespace Athena
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "Athena/Resources/MemoryBudgetManager.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+
+namespace Athena {
+
+    void MemoryBudgetManager::Initialize(IMemoryBudgetSource* source, IResidencyBackend* backend, const Settings& settings) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->source = source;
+        this->backend = backend;
+        this->settings = settings;
+        currentFrame = 0;
+        lastBudget = {};
+    }
+
+    void MemoryBudgetManager::SetTrimCallback(std::function<void()> callback) {
+        std::lock_guard<std::mutex> lock(mutex);
+        trimCallback = std::move(callback);
+    }
+
+    uint32_t MemoryBudgetManager::Register(void* object, BudgetCategory category, uint64_t size, bool evictable) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        uint32_t id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            id = static_cast<uint32_t>(entries.size());
+            entries.emplace_back();
+        }
+
+        Entry& entry = entries[id];
+        entry = Entry{};
+        entry.object = object;
+        entry.size = size;
+        entry.category = category;
+        entry.lastUsedFrame = currentFrame;
+        entry.inUse = true;
+        entry.evictable = evictable && category != BudgetCategory::RenderTarget;
+        return id;
+    }
+
+    void MemoryBudgetManager::Unregister(uint32_t id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (id >= entries.size() || !entries[id].inUse) {
+            return;
+        }
+
+        // 退避中のまま解放すると参照カウントの扱いが不定になるため戻しておく
+        Entry& entry = entries[id];
+        if (!entry.resident && backend) {
+            backend->MakeResident(entry.object);
+        }
+        entry = Entry{};
+        freeIds.push_back(id);
+    }
+
+    void MemoryBudgetManager::MarkUsed(uint32_t id) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (id >= entries.size() || !entries[id].inUse) {
+            return;
+        }
+
+        Entry& entry = entries[id];
+        entry.lastUsedFrame = currentFrame;
+        entry.usageTracked = true;
+
+        if (!entry.resident) {
+            if (backend && backend->MakeResident(entry.object)) {
+                entry.resident = true;
+                totalRestores++;
+            }
+        }
+    }
+
+    uint32_t MemoryBudgetManager::Update(uint64_t frameIndex) {
+        std::function<void()> trim;
+        uint32_t evicted = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            currentFrame = frameIndex;
+            if (!source) {
+                return 0;
+            }
+
+            lastBudget = source->QueryBudget();
+            if (lastBudget.budget == 0 ||
+                lastBudget.currentUsage <= static_cast<uint64_t>(lastBudget.budget * static_cast<double>(settings.evictThreshold))) {
+                return 0;
+            }
+
+            uint64_t target = static_cast<uint64_t>(lastBudget.budget * static_cast<double>(settings.targetRatio));
+            uint64_t excess = lastBudget.currentUsage - std::min(lastBudget.currentUsage, target);
+
+            // 退避候補（使用状況が分かっていて、一定フレーム使われていないもの）を古い順に並べる
+            std::vector<uint32_t> candidates;
+            for (uint32_t id = 0; id < entries.size(); ++id) {
+                const Entry& entry = entries[id];
+                if (entry.inUse && entry.evictable && entry.usageTracked && entry.resident &&
+                    currentFrame >= entry.lastUsedFrame + settings.minIdleFrames) {
+                    candidates.push_back(id);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), [this](uint32_t a, uint32_t b) {
+                if (entries[a].lastUsedFrame != entries[b].lastUsedFrame) {
+                    return entries[a].lastUsedFrame < entries[b].lastUsedFrame;
+                }
+                return entries[a].size > entries[b].size;
+            });
+
+            uint64_t freed = 0;
+            for (uint32_t id : candidates) {
+                if (freed >= excess || !backend) {
+                    break;
+                }
+                Entry& entry = entries[id];
+                if (backend->Evict(entry.object)) {
+                    entry.resident = false;
+                    freed += entry.size;
+                    evicted++;
+                }
+            }
+            totalEvictions += evicted;
+
+            if (evicted > 0) {
+                Logger::Info("MemoryBudgetManager: evicted %u resources (%llu bytes) - usage %llu / budget %llu",
+                            evicted, static_cast<unsigned long long>(freed),
+                            static_cast<unsigned long long>(lastBudget.currentUsage),
+                            static_cast<unsigned long long>(lastBudget.budget));
+            }
+            trim = trimCallback;
+        }
+
+        // 使用量が予算を超えている間は空きブロックなども返却する
+        if (trim) {
+            trim();
+        }
+        return evicted;
+    }
+
+    bool MemoryBudgetManager::IsResident(uint32_t id) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return id < entries.size() && entries[id].inUse && entries[id].resident;
+    }
+
+    MemoryBudgetManager::Stats MemoryBudgetManager::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        Stats stats;
+        stats.budget = lastBudget;
+        stats.totalEvictions = totalEvictions;
+        stats.totalRestores = totalRestores;
+        for (const Entry& entry : entries) {
+            if (!entry.inUse) {
+                continue;
+            }
+            CategoryStats& category = stats.categories[static_cast<size_t>(entry.category)];
+            category.totalSize += entry.size;
+            category.count++;
+            if (entry.resident) {
+                category.residentSize += entry.size;
+            } else {
+                category.evictedCount++;
+            }
+        }
+        return stats;
+    }
+
+    void MemoryBudgetManager::LogStats() const {
+        static const char* categoryNames[] = { "Buffer", "Texture", "RenderTarget" };
+
+        Stats stats = GetStats();
+        Logger::Info("MemoryBudgetManager: usage %.1f MB / budget %.1f MB, evictions %llu, restores %llu",
+                    stats.budget.currentUsage / (1024.0 * 1024.0), stats.budget.budget / (1024.0 * 1024.0),
+                    static_cast<unsigned long long>(stats.totalEvictions),
+                    static_cast<unsigned long long>(stats.totalRestores));
+        for (size_t i = 0; i < stats.categories.size(); ++i) {
+            const CategoryStats& category = stats.categories[i];
+            Logger::Info("  %s: %u resources, %.1f MB (resident %.1f MB, evicted %u)",
+                        categoryNames[i], category.count,
+                        category.totalSize / (1024.0 * 1024.0), category.residentSize / (1024.0 * 1024.0),
+                        category.evictedCount);
+        }
+    }
+
+} // namespace Athena
@@ -0,0 +1,843 @@
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Utils/Hash.h"
+#include "Athena/Utils/Logger.h"
+#include <cstring>
+#include <cwchar>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace Athena {
+
+    namespace {
+        void HashSemantic(uint64_t& hash, const char* name) {
+            HashString(hash, name ? name : "");
+        }
+
+        void HashShader(uint64_t& hash, const D3D12_SHADER_BYTECODE& shader) {
+            // 未使用のステージも長さ0として加え、VS と PS の入れ替えなどを区別する
+            uint64_t length = shader.pShaderBytecode ? static_cast<uint64_t>(shader.BytecodeLength) : 0;
+            HashValue(hash, length);
+            if (length > 0) {
+                HashBytes(hash, shader.pShaderBytecode, static_cast<size_t>(length));
+            }
+        }
+
+        // パディングを含む構造体はバイト列ではなくメンバごとにハッシュする
+        void HashBlend(uint64_t& hash, const D3D12_BLEND_DESC& blend) {
+            HashValue(hash, blend.AlphaToCoverageEnable);
+            HashValue(hash, blend.IndependentBlendEnable);
+            for (const D3D12_RENDER_TARGET_BLEND_DESC& target : blend.RenderTarget) {
+                HashValue(hash, target.BlendEnable);
+                HashValue(hash, target.LogicOpEnable);
+                HashValue(hash, target.SrcBlend);
+                HashValue(hash, target.DestBlend);
+                HashValue(hash, target.BlendOp);
+                HashValue(hash, target.SrcBlendAlpha);
+                HashValue(hash, target.DestBlendAlpha);
+                HashValue(hash, target.BlendOpAlpha);
+                HashValue(hash, target.LogicOp);
+                HashValue(hash, target.RenderTargetWriteMask);
+            }
+        }
+
+        void HashRasterizer(uint64_t& hash, const D3D12_RASTERIZER_DESC& rasterizer) {
+            HashValue(hash, rasterizer.FillMode);
+            HashValue(hash, rasterizer.CullMode);
+            HashValue(hash, rasterizer.FrontCounterClockwise);
+            HashValue(hash, rasterizer.DepthBias);
+            HashValue(hash, rasterizer.DepthBiasClamp);
+            HashValue(hash, rasterizer.SlopeScaledDepthBias);
+            HashValue(hash, rasterizer.DepthClipEnable);
+            HashValue(hash, rasterizer.MultisampleEnable);
+            HashValue(hash, rasterizer.AntialiasedLineEnable);
+            HashValue(hash, rasterizer.ForcedSampleCount);
+            HashValue(hash, rasterizer.ConservativeRaster);
+        }
+
+        void HashStencilOp(uint64_t& hash, const D3D12_DEPTH_STENCILOP_DESC& op) {
+            HashValue(hash, op.StencilFailOp);
+            HashValue(hash, op.StencilDepthFailOp);
+            HashValue(hash, op.StencilPassOp);
+            HashValue(hash, op.StencilFunc);
+        }
+
+        void HashDepthStencil(uint64_t& hash, const D3D12_DEPTH_STENCIL_DESC& depthStencil) {
+            HashValue(hash, depthStencil.DepthEnable);
+            HashValue(hash, depthStencil.DepthWriteMask);
+            HashValue(hash, depthStencil.DepthFunc);
+            HashValue(hash, depthStencil.StencilEnable);
+            HashValue(hash, depthStencil.StencilReadMask);
+            HashValue(hash, depthStencil.StencilWriteMask);
+            HashStencilOp(hash, depthStencil.FrontFace);
+            HashStencilOp(hash, depthStencil.BackFace);
+        }
+
+        void HashInputLayout(uint64_t& hash, const D3D12_INPUT_LAYOUT_DESC& layout) {
+            HashValue(hash, layout.NumElements);
+            for (UINT i = 0; i < layout.NumElements && layout.pInputElementDescs; ++i) {
+                const D3D12_INPUT_ELEMENT_DESC& element = layout.pInputElementDescs[i];
+                HashSemantic(hash, element.SemanticName);
+                HashValue(hash, element.SemanticIndex);
+                HashValue(hash, element.Format);
+                HashValue(hash, element.InputSlot);
+                HashValue(hash, element.AlignedByteOffset);
+                HashValue(hash, element.InputSlotClass);
+                HashValue(hash, element.InstanceDataStepRate);
+            }
+        }
+
+        void HashStreamOutput(uint64_t& hash, const D3D12_STREAM_OUTPUT_DESC& streamOutput) {
+            HashValue(hash, streamOutput.NumEntries);
+            for (UINT i = 0; i < streamOutput.NumEntries && streamOutput.pSODeclaration; ++i) {
+                const D3D12_SO_DECLARATION_ENTRY& entry = streamOutput.pSODeclaration[i];
+                HashValue(hash, entry.Stream);
+                HashSemantic(hash, entry.SemanticName);
+                HashValue(hash, entry.SemanticIndex);
+                HashValue(hash, entry.StartComponent);
+                HashValue(hash, entry.ComponentCount);
+                HashValue(hash, entry.OutputSlot);
+            }
+            HashValue(hash, streamOutput.NumStrides);
+            for (UINT i = 0; i < streamOutput.NumStrides && streamOutput.pBufferStrides; ++i) {
+                HashValue(hash, streamOutput.pBufferStrides[i]);
+            }
+            HashValue(hash, streamOutput.RasterizedStream);
+        }
+
+        uint64_t HashCombine(uint64_t hash, uint64_t value) {
+            HashValue(hash, value);
+            return hash;
+        }
+
+        D3D12_SHADER_BYTECODE D3D12_GRAPHICS_PIPELINE_STATE_DESC::* const ShaderStages[] = {
+            &D3D12_GRAPHICS_PIPELINE_STATE_DESC::VS,
+            &D3D12_GRAPHICS_PIPELINE_STATE_DESC::PS,
+            &D3D12_GRAPHICS_PIPELINE_STATE_DESC::DS,
+            &D3D12_GRAPHICS_PIPELINE_STATE_DESC::HS,
+            &D3D12_GRAPHICS_PIPELINE_STATE_DESC::GS,
+        };
+
+        // プリウォームリストのファイル形式
+        constexpr uint32_t PrewarmMagic = 0x4D575041;     // "APWM"
+        constexpr uint32_t PrewarmVersion = 1;
+
+        void Write(std::vector<char>& output, const void* data, size_t size) {
+            const char* bytes = static_cast<const char*>(data);
+            output.insert(output.end(), bytes, bytes + size);
+        }
+
+        template<typename T>
+        void WriteValue(std::vector<char>& output, const T& value) {
+            Write(output, &value, sizeof(T));
+        }
+
+        void WriteBlock(std::vector<char>& output, const void* data, size_t size) {
+            WriteValue(output, static_cast<uint64_t>(size));
+            Write(output, data, size);
+        }
+
+        bool Read(const char*& cursor, const char* end, void* data, size_t size) {
+            if (static_cast<size_t>(end - cursor) < size) {
+                return false;
+            }
+            if (size > 0) {
+                memcpy(data, cursor, size);
+                cursor += size;
+            }
+            return true;
+        }
+
+        template<typename T>
+        bool ReadValue(const char*& cursor, const char* end, T& value) {
+            return Read(cursor, end, &value, sizeof(T));
+        }
+
+        template<typename T>
+        bool ReadBlock(const char*& cursor, const char* end, std::vector<T>& values) {
+            uint64_t size = 0;
+            if (!ReadValue(cursor, end, size) || size % sizeof(T) != 0 ||
+                size > static_cast<uint64_t>(end - cursor)) {
+                return false;
+            }
+            values.resize(static_cast<size_t>(size / sizeof(T)));
+            return Read(cursor, end, values.data(), static_cast<size_t>(size));
+        }
+
+        bool ReadString(const char*& cursor, const char* end, std::string& text) {
+            std::vector<char> bytes;
+            if (!ReadBlock(cursor, end, bytes)) {
+                return false;
+            }
+            text.assign(bytes.begin(), bytes.end());
+            return true;
+        }
+
+        bool ReadFile(const std::filesystem::path& path, std::vector<char>& contents) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                return false;
+            }
+            contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return true;
+        }
+
+        /**
+         * @brief 一時ファイルに書いてから置き換える（書き込み途中のファイルを次回読まないように）
+         */
+        bool WriteFileAtomic(const std::filesystem::path& path, const std::vector<char>& contents) {
+            std::error_code error;
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path(), error);
+            }
+
+            std::filesystem::path temporary = path;
+            temporary += L".tmp";
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                if (!file) {
+                    return false;
+                }
+                file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            }
+
+            std::filesystem::rename(temporary, path, error);
+            if (error) {
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    // =====================================================
+    // GraphicsPipelineDescStorage
+    // =====================================================
+
+    void GraphicsPipelineDescStorage::Assign(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& source) {
+        desc = source;
+        desc.CachedPSO = {};
+
+        for (size_t i = 0; i < 5; ++i) {
+            const D3D12_SHADER_BYTECODE& shader = source.*ShaderStages[i];
+            const uint8_t* bytes = static_cast<const uint8_t*>(shader.pShaderBytecode);
+            shaders[i].assign(bytes, bytes ? bytes + shader.BytecodeLength : bytes);
+        }
+
+        const D3D12_INPUT_LAYOUT_DESC& layout = source.InputLayout;
+        inputElements.assign(layout.pInputElementDescs,
+                             layout.pInputElementDescs ? layout.pInputElementDescs + layout.NumElements : nullptr);
+        inputSemantics.clear();
+        for (const D3D12_INPUT_ELEMENT_DESC& element : inputElements) {
+            inputSemantics.push_back(element.SemanticName ? element.SemanticName : "");
+        }
+
+        const D3D12_STREAM_OUTPUT_DESC& streamOutput = source.StreamOutput;
+        streamOutputEntries.assign(streamOutput.pSODeclaration,
+                                   streamOutput.pSODeclaration ? streamOutput.pSODeclaration + streamOutput.NumEntries : nullptr);
+        streamOutputSemantics.clear();
+        for (const D3D12_SO_DECLARATION_ENTRY& entry : streamOutputEntries) {
+            streamOutputSemantics.push_back(entry.SemanticName ? entry.SemanticName : "");
+        }
+        streamOutputStrides.assign(streamOutput.pBufferStrides,
+                                   streamOutput.pBufferStrides ? streamOutput.pBufferStrides + streamOutput.NumStrides : nullptr);
+
+        FixupPointers();
+    }
+
+    void GraphicsPipelineDescStorage::FixupPointers() {
+        for (size_t i = 0; i < 5; ++i) {
+            D3D12_SHADER_BYTECODE& shader = desc.*ShaderStages[i];
+            shader.pShaderBytecode = shaders[i].empty() ? nullptr : shaders[i].data();
+            shader.BytecodeLength = shaders[i].size();
+        }
+
+        for (size_t i = 0; i < inputElements.size(); ++i) {
+            inputElements[i].SemanticName = inputSemantics[i].c_str();
+        }
+        desc.InputLayout.pInputElementDescs = inputElements.empty() ? nullptr : inputElements.data();
+        desc.InputLayout.NumElements = static_cast<UINT>(inputElements.size());
+
+        for (size_t i = 0; i < streamOutputEntries.size(); ++i) {
+            // SemanticName が nullptr のエントリは出力スロットの隙間を表す
+            streamOutputEntries[i].SemanticName = streamOutputSemantics[i].empty() ? nullptr : streamOutputSemantics[i].c_str();
+        }
+        desc.StreamOutput.pSODeclaration = streamOutputEntries.empty() ? nullptr : streamOutputEntries.data();
+        desc.StreamOutput.NumEntries = static_cast<UINT>(streamOutputEntries.size());
+        desc.StreamOutput.pBufferStrides = streamOutputStrides.empty() ? nullptr : streamOutputStrides.data();
+        desc.StreamOutput.NumStrides = static_cast<UINT>(streamOutputStrides.size());
+    }
+
+    void GraphicsPipelineDescStorage::Serialize(std::vector<char>& output) const {
+        // 固定長の部分はそのまま書き、ポインタは読み込み時に付け替える
+        WriteValue(output, desc);
+        for (const std::vector<uint8_t>& shader : shaders) {
+            WriteBlock(output, shader.data(), shader.size());
+        }
+
+        WriteValue(output, static_cast<uint32_t>(inputElements.size()));
+        for (size_t i = 0; i < inputElements.size(); ++i) {
+            WriteBlock(output, inputSemantics[i].data(), inputSemantics[i].size());
+            WriteValue(output, inputElements[i]);
+        }
+
+        WriteValue(output, static_cast<uint32_t>(streamOutputEntries.size()));
+        for (size_t i = 0; i < streamOutputEntries.size(); ++i) {
+            WriteBlock(output, streamOutputSemantics[i].data(), streamOutputSemantics[i].size());
+            WriteValue(output, streamOutputEntries[i]);
+        }
+        WriteBlock(output, streamOutputStrides.data(), streamOutputStrides.size() * sizeof(UINT));
+    }
+
+    bool GraphicsPipelineDescStorage::Deserialize(const char*& cursor, const char* end) {
+        if (!ReadValue(cursor, end, desc)) {
+            return false;
+        }
+        desc.pRootSignature = nullptr;
+        desc.CachedPSO = {};
+
+        for (std::vector<uint8_t>& shader : shaders) {
+            if (!ReadBlock(cursor, end, shader)) {
+                return false;
+            }
+        }
+
+        uint32_t count = 0;
+        if (!ReadValue(cursor, end, count) || count > D3D12_IA_VERTEX_INPUT_STRUCTURE_ELEMENT_COUNT) {
+            return false;
+        }
+        inputElements.resize(count);
+        inputSemantics.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!ReadString(cursor, end, inputSemantics[i]) || !ReadValue(cursor, end, inputElements[i])) {
+                return false;
+            }
+        }
+
+        if (!ReadValue(cursor, end, count) || count > D3D12_SO_STREAM_COUNT * D3D12_SO_OUTPUT_COMPONENT_COUNT) {
+            return false;
+        }
+        streamOutputEntries.resize(count);
+        streamOutputSemantics.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!ReadString(cursor, end, streamOutputSemantics[i]) || !ReadValue(cursor, end, streamOutputEntries[i])) {
+                return false;
+            }
+        }
+        if (!ReadBlock(cursor, end, streamOutputStrides)) {
+            return false;
+        }
+
+        FixupPointers();
+        return true;
+    }
+
+    // =====================================================
+    // PipelineRequest
+    // =====================================================
+
+    void PipelineRequest::Wait() const {
+        PipelineStatus current = status.load(std::memory_order_acquire);
+        while (current == PipelineStatus::Pending) {
+            status.wait(current, std::memory_order_acquire);
+            current = status.load(std::memory_order_acquire);
+        }
+    }
+
+    void PipelineRequest::Finish(PipelineStatus result) {
+        status.store(result, std::memory_order_release);
+        status.notify_all();
+    }
+
+    // =====================================================
+    // PipelineCache
+    // =====================================================
+
+    PipelineCache::~PipelineCache() {
+        StopWorkers();
+    }
+
+    void PipelineCache::Initialize(ID3D12Device1* device, const Settings& settings) {
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+
+        StopWorkers();
+
+        this->device = device;
+        this->settings = settings;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.clear();
+            rootSignatures.clear();
+            stats = {};
+            prewarmDirty = false;
+            stopping = false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(libraryMutex);
+            library.Reset();
+            libraryData.clear();
+            libraryDirty = false;
+
+            if (settings.useLibrary) {
+                ReadFile(settings.libraryPath, libraryData);
+                if (!libraryData.empty()) {
+                    HRESULT hr = device->CreatePipelineLibrary(libraryData.data(), libraryData.size(), IID_PPV_ARGS(&library));
+                    if (FAILED(hr)) {
+                        // ドライバーの更新や別のGPUで保存されたライブラリは読めないため作り直す
+                        Logger::Warning("PipelineCache: saved pipeline library rejected (0x%08X), starting empty",
+                                       static_cast<unsigned int>(hr));
+                        library.Reset();
+                        libraryData.clear();
+                    }
+                }
+                if (!library) {
+                    CreateLibrary();
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < settings.workerThreadCount; ++i) {
+            workers.emplace_back([this]() { WorkerLoop(); });
+        }
+
+        Logger::Info("PipelineCache initialized (pipeline library: %s, %zu bytes loaded, %u worker threads)",
+                    !settings.useLibrary ? "off" : (library ? "on" : "unsupported"),
+                    libraryData.size(), settings.workerThreadCount);
+    }
+
+    void PipelineCache::CreateLibrary() {
+        HRESULT hr = device->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&library));
+        if (FAILED(hr)) {
+            Logger::Warning("PipelineCache: pipeline library not supported (0x%08X)", static_cast<unsigned int>(hr));
+            library.Reset();
+            return;
+        }
+        // 空のライブラリから作った場合、既存のファイルは次回の保存で置き換える
+        libraryDirty = true;
+    }
+
+    void PipelineCache::StopWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        jobAvailable.notify_all();
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        workers.clear();
+
+        // 着手されなかった要求は失敗として完了させ、待機中のスレッドを起こす
+        std::deque<PipelineHandle> abandoned;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            abandoned.swap(jobs);
+            // 次回の要求で作り直せるよう、未完了の要求はキャッシュから外す
+            for (auto it = requests.begin(); it != requests.end();) {
+                if (it->second->GetStatus() == PipelineStatus::Pending) {
+                    it = requests.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        for (const PipelineHandle& request : abandoned) {
+            pendingCount.fetch_sub(1, std::memory_order_relaxed);
+            request->Finish(PipelineStatus::Failed);
+        }
+    }
+
+    void PipelineCache::Shutdown() {
+        StopWorkers();
+        Save();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests.clear();
+            rootSignatures.clear();
+        }
+
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        library.Reset();
+        libraryData.clear();
+        device.Reset();
+    }
+
+    void PipelineCache::Save() {
+        SavePrewarmList();
+
+        std::lock_guard<std::mutex> lock(libraryMutex);
+        if (!library || !libraryDirty) {
+            return;
+        }
+
+        std::vector<char> buffer(library->GetSerializedSize());
+        if (buffer.empty() || FAILED(library->Serialize(buffer.data(), buffer.size()))) {
+            Logger::Warning("PipelineCache: failed to serialize pipeline library");
+            return;
+        }
+
+        if (!WriteFileAtomic(settings.libraryPath, buffer)) {
+            Logger::Warning("PipelineCache: failed to write %s", settings.libraryPath.string().c_str());
+            return;
+        }
+
+        libraryDirty = false;
+        Logger::Info("PipelineCache: saved pipeline library (%zu bytes)", buffer.size());
+    }
+
+    void PipelineCache::SavePrewarmList() {
+        std::vector<char> output;
+        uint32_t pipelineCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!prewarmDirty) {
+                return;
+            }
+
+            WriteValue(output, PrewarmMagic);
+            WriteValue(output, PrewarmVersion);
+            WriteValue(output, static_cast<uint32_t>(sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC)));
+
+            // ルートシグネチャは内容ごとに1回だけ書く
+            std::map<uint64_t, const std::vector<char>*> serializedRootSignatures;
+            for (const auto& [pointer, info] : rootSignatures) {
+                serializedRootSignatures.emplace(info.hash, &info.serialized);
+            }
+            WriteValue(output, static_cast<uint32_t>(serializedRootSignatures.size()));
+            for (const auto& [hash, serialized] : serializedRootSignatures) {
+                WriteValue(output, hash);
+                WriteBlock(output, serialized->data(), serialized->size());
+            }
+
+            size_t countOffset = output.size();
+            WriteValue(output, pipelineCount);
+            for (const auto& [key, request] : requests) {
+                if (request->rootSignatureHash == 0 || !request->IsReady()) {
+                    continue;
+                }
+                WriteValue(output, request->rootSignatureHash);
+                request->desc.Serialize(output);
+                pipelineCount++;
+            }
+            memcpy(output.data() + countOffset, &pipelineCount, sizeof(pipelineCount));
+            prewarmDirty = false;
+        }
+
+        if (!WriteFileAtomic(settings.prewarmPath, output)) {
+            Logger::Warning("PipelineCache: failed to write %s", settings.prewarmPath.string().c_str());
+            return;
+        }
+        Logger::Info("PipelineCache: recorded %u pipelines for prewarm", pipelineCount);
+    }
+
+    uint32_t PipelineCache::Prewarm() {
+        if (!device) {
+            return 0;
+        }
+
+        std::vector<char> contents;
+        if (!ReadFile(settings.prewarmPath, contents) || contents.empty()) {
+            return 0;
+        }
+
+        const char* cursor = contents.data();
+        const char* end = cursor + contents.size();
+        uint32_t magic = 0, version = 0, descSize = 0, rootSignatureCount = 0;
+        if (!ReadValue(cursor, end, magic) || !ReadValue(cursor, end, version) || !ReadValue(cursor, end, descSize) ||
+            magic != PrewarmMagic || version != PrewarmVersion ||
+            descSize != sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC) ||
+            !ReadValue(cursor, end, rootSignatureCount)) {
+            Logger::Warning("PipelineCache: prewarm list is out of date, ignored");
+            return 0;
+        }
+
+        // ルートシグネチャを作り直す（同じデータから作ると、パスが作るものと同じキーになる）
+        std::unordered_map<uint64_t, ComPtr<ID3D12RootSignature>> restored;
+        for (uint32_t i = 0; i < rootSignatureCount; ++i) {
+            uint64_t hash = 0;
+            std::vector<char> serialized;
+            if (!ReadValue(cursor, end, hash) || !ReadBlock(cursor, end, serialized)) {
+                Logger::Warning("PipelineCache: prewarm list is corrupted, ignored");
+                return 0;
+            }
+
+            ComPtr<ID3D12RootSignature> rootSignature;
+            if (SUCCEEDED(device->CreateRootSignature(0, serialized.data(), serialized.size(), IID_PPV_ARGS(&rootSignature)))) {
+                RegisterRootSignature(rootSignature.Get(), serialized.data(), serialized.size());
+                restored[hash] = rootSignature;
+            }
+        }
+
+        uint32_t pipelineCount = 0;
+        uint32_t requested = 0;
+        if (!ReadValue(cursor, end, pipelineCount)) {
+            return 0;
+        }
+        for (uint32_t i = 0; i < pipelineCount; ++i) {
+            uint64_t rootSignatureHash = 0;
+            GraphicsPipelineDescStorage storage;
+            if (!ReadValue(cursor, end, rootSignatureHash) || !storage.Deserialize(cursor, end)) {
+                Logger::Warning("PipelineCache: prewarm list is corrupted after %u pipelines", requested);
+                break;
+            }
+
+            auto it = restored.find(rootSignatureHash);
+            if (it == restored.end()) {
+                continue;
+            }
+            storage.SetRootSignature(it->second.Get());
+
+            bool created = false;
+            PipelineHandle request = FindOrAddRequest(storage.Get(), true, created);
+            if (created) {
+                Enqueue(request);
+                requested++;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stats.prewarmed += requested;
+        }
+        Logger::Info("PipelineCache: prewarming %u pipelines in the background", requested);
+        return requested;
+    }
+
+    void PipelineCache::RegisterRootSignature(ID3D12RootSignature* rootSignature, const void* serialized, size_t size) {
+        if (!rootSignature || !serialized || size == 0) {
+            return;
+        }
+
+        RootSignatureInfo info;
+        info.rootSignature = rootSignature;
+        info.hash = FnvOffsetBasis;
+        HashBytes(info.hash, serialized, size);
+        info.serialized.assign(static_cast<const char*>(serialized), static_cast<const char*>(serialized) + size);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        rootSignatures[rootSignature] = std::move(info);
+    }
+
+    PipelineHandle PipelineCache::FindOrAddRequest(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, bool prewarm, bool& created) {
+        uint64_t hash = ComputeHash(desc);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto registered = rootSignatures.find(desc.pRootSignature);
+        uint64_t rootSignatureHash = (registered != rootSignatures.end()) ? registered->second.hash : 0;
+        Key key(hash, rootSignatureHash ? rootSignatureHash : reinterpret_cast<uintptr_t>(desc.pRootSignature));
+
+        auto it = requests.find(key);
+        if (it != requests.end()) {
+            if (it->second->IsReady()) {
+                stats.memoryHits++;
+            }
+            created = false;
+            return it->second;
+        }
+
+        auto request = std::make_shared<PipelineRequest>();
+        request->desc.Assign(desc);
+        request->rootSignature = desc.pRootSignature;
+        request->hash = hash;
+        request->rootSignatureHash = rootSignatureHash;
+        request->libraryKey = rootSignatureHash ? HashCombine(hash, rootSignatureHash) : hash;
+        request->prewarmed = prewarm;
+        requests.emplace(key, request);
+
+        pendingCount.fetch_add(1, std::memory_order_relaxed);
+        created = true;
+        return request;
+    }
+
+    void PipelineCache::Enqueue(const PipelineHandle& request) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!workers.empty() && !stopping) {
+                jobs.push_back(request);
+                jobAvailable.notify_one();
+                return;
+            }
+        }
+        Build(*request);
+    }
+
+    void PipelineCache::WorkerLoop() {
+        while (true) {
+            PipelineHandle request;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (stopping) {
+                    return;
+                }
+                request = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            Build(*request);
+        }
+    }
+
+    void PipelineCache::Build(PipelineRequest& request) {
+        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc = request.desc.Get();
+        std::wstring name = MakePipelineName(request.libraryKey);
+
+        ComPtr<ID3D12PipelineState> pipelineState;
+        bool fromLibrary = false;
+        {
+            std::lock_guard<std::mutex> lock(libraryMutex);
+            if (library && SUCCEEDED(library->LoadGraphicsPipeline(name.c_str(), &desc, IID_PPV_ARGS(&pipelineState)))) {
+                fromLibrary = true;
+            }
+        }
+
+        bool succeeded = fromLibrary;
+        if (!fromLibrary) {
+            pipelineState.Reset();
+            HRESULT hr = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pipelineState));
+            succeeded = SUCCEEDED(hr);
+            if (!succeeded) {
+                Logger::Error("PipelineCache: failed to create pipeline %S (0x%08X)", name.c_str(), static_cast<unsigned int>(hr));
+            } else {
+                std::lock_guard<std::mutex> lock(libraryMutex);
+                // 同名が別のルートシグネチャで保存済みの場合は失敗するが、メモリ上のキャッシュは使える
+                if (library && SUCCEEDED(library->StorePipeline(name.c_str(), pipelineState.Get()))) {
+                    libraryDirty = true;
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!succeeded) {
+                stats.failures++;
+            } else if (fromLibrary) {
+                stats.libraryHits++;
+            } else {
+                stats.creates++;
+            }
+            if (succeeded && request.rootSignatureHash != 0 && !request.prewarmed) {
+                prewarmDirty = true;
+            }
+        }
+
+        request.pipelineState = pipelineState;
+        pendingCount.fetch_sub(1, std::memory_order_relaxed);
+        request.Finish(succeeded ? PipelineStatus::Ready : PipelineStatus::Failed);
+    }
+
+    PipelineHandle PipelineCache::RequestGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+        if (!device) {
+            throw std::runtime_error("PipelineCache is not initialized");
+        }
+
+        bool created = false;
+        PipelineHandle request = FindOrAddRequest(desc, false, created);
+        if (created) {
+            Enqueue(request);
+        }
+        return request;
+    }
+
+    ComPtr<ID3D12PipelineState> PipelineCache::GetGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+        if (!device) {
+            throw std::runtime_error("PipelineCache is not initialized");
+        }
+
+        bool created = false;
+        PipelineHandle request = FindOrAddRequest(desc, false, created);
+        if (created) {
+            Build(*request);
+        } else {
+            request->Wait();
+        }
+
+        if (!request->IsReady()) {
+            throw std::runtime_error("Failed to create pipeline state");
+        }
+        return request->pipelineState;
+    }
+
+    ComPtr<ID3D12PipelineState> PipelineCache::LoadGraphicsPipeline(ID3D12Device* device,
+                                                                    const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+        if (PipelineCache* cache = GetGlobal()) {
+            return cache->GetGraphicsPipeline(desc);
+        }
+
+        ComPtr<ID3D12PipelineState> pipelineState;
+        HRESULT hr = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&pipelineState));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create pipeline state");
+        }
+        return pipelineState;
+    }
+
+    PipelineHandle PipelineCache::LoadGraphicsPipelineAsync(ID3D12Device* device,
+                                                            const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+        if (PipelineCache* cache = GetGlobal()) {
+            return cache->RequestGraphicsPipeline(desc);
+        }
+
+        auto request = std::make_shared<PipelineRequest>();
+        request->hash = ComputeHash(desc);
+        HRESULT hr = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&request->pipelineState));
+        if (FAILED(hr)) {
+            Logger::Error("Failed to create pipeline state (0x%08X)", static_cast<unsigned int>(hr));
+        }
+        request->Finish(SUCCEEDED(hr) ? PipelineStatus::Ready : PipelineStatus::Failed);
+        return request;
+    }
+
+    uint64_t PipelineCache::ComputeHash(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc) {
+        uint64_t hash = FnvOffsetBasis;
+
+        HashShader(hash, desc.VS);
+        HashShader(hash, desc.PS);
+        HashShader(hash, desc.DS);
+        HashShader(hash, desc.HS);
+        HashShader(hash, desc.GS);
+        HashStreamOutput(hash, desc.StreamOutput);
+        HashBlend(hash, desc.BlendState);
+        HashValue(hash, desc.SampleMask);
+        HashRasterizer(hash, desc.RasterizerState);
+        HashDepthStencil(hash, desc.DepthStencilState);
+        HashInputLayout(hash, desc.InputLayout);
+        HashValue(hash, desc.IBStripCutValue);
+        HashValue(hash, desc.PrimitiveTopologyType);
+
+        HashValue(hash, desc.NumRenderTargets);
+        for (UINT i = 0; i < desc.NumRenderTargets && i < 8; ++i) {
+            HashValue(hash, desc.RTVFormats[i]);
+        }
+        HashValue(hash, desc.DSVFormat);
+        HashValue(hash, desc.SampleDesc.Count);
+        HashValue(hash, desc.SampleDesc.Quality);
+        HashValue(hash, desc.NodeMask);
+        HashValue(hash, desc.Flags);
+        return hash;
+    }
+
+    std::wstring PipelineCache::MakePipelineName(uint64_t hash) {
+        wchar_t name[17];
+        swprintf(name, 17, L"%016llx", static_cast<unsigned long long>(hash));
+        return name;
+    }
+
+    PipelineCache::Stats PipelineCache::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    void PipelineCache::LogStats() const {
+        Stats current = GetStats();
+        Logger::Info("PipelineCache: %llu memory hits, %llu library hits, %llu creates",
+                    static_cast<unsigned long long>(current.memoryHits),
+                    static_cast<unsigned long long>(current.libraryHits),
+                    static_cast<unsigned long long>(current.creates));
+    }
+
+} // namespace Athena
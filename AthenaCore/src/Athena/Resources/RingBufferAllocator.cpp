@@ -0,0 +1,67 @@
+#include "Athena/Resources/RingBufferAllocator.h"
+
+namespace Athena {
+
+    void RingBufferAllocator::Reset(uint64_t capacity) {
+        this->capacity = capacity;
+        head = 0;
+        tail = 0;
+        batchStart = 0;
+        batches.clear();
+    }
+
+    uint64_t RingBufferAllocator::Allocate(uint64_t size, uint64_t alignment) {
+        if (capacity == 0 || size > capacity) {
+            return InvalidOffset;
+        }
+        if (alignment == 0) {
+            alignment = 1;
+        }
+
+        uint64_t position = head % capacity;
+        uint64_t offset = (position + alignment - 1) & ~(alignment - 1);
+
+        // 末尾に収まらない場合は先頭へ折り返す
+        if (offset + size > capacity) {
+            offset = 0;
+            uint64_t consumed = (capacity - position) + size;
+            if (GetUsedSize() + consumed > capacity) {
+                return InvalidOffset;
+            }
+            head += consumed;
+            return offset;
+        }
+
+        uint64_t consumed = (offset - position) + size;
+        if (GetUsedSize() + consumed > capacity) {
+            return InvalidOffset;
+        }
+
+        head += consumed;
+        return offset;
+    }
+
+    void RingBufferAllocator::FinishBatch(uint64_t fenceValue) {
+        if (head == batchStart) {
+            return;  // 割り当てなし
+        }
+
+        batches.push_back({ fenceValue, head });
+        batchStart = head;
+    }
+
+    void RingBufferAllocator::ReleaseCompleted(uint64_t completedFenceValue) {
+        while (!batches.empty() && batches.front().fenceValue <= completedFenceValue) {
+            tail = batches.front().headPosition;
+            batches.pop_front();
+        }
+
+        // 全領域が空いたら先頭から使い直す（折り返しによる無駄を減らす）
+        if (tail == head) {
+            head = 0;
+            tail = 0;
+            batchStart = 0;
+        }
+    }
+
+} // namespace Athena
\ No newline at end of file
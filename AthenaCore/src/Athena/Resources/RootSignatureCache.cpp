@@ -0,0 +1,209 @@
+#include "Athena/Resources/RootSignatureCache.h"
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Utils/Hash.h"
+#include "Athena/Utils/Logger.h"
+#include <climits>
+#include <stdexcept>
+
+namespace Athena {
+
+    namespace {
+        D3D12_STATIC_SAMPLER_DESC MakeStaticSampler(UINT shaderRegister, D3D12_FILTER filter,
+                                                    D3D12_TEXTURE_ADDRESS_MODE addressMode,
+                                                    D3D12_STATIC_BORDER_COLOR borderColor) {
+            D3D12_STATIC_SAMPLER_DESC sampler = {};
+            sampler.Filter = filter;
+            sampler.AddressU = addressMode;
+            sampler.AddressV = addressMode;
+            sampler.AddressW = addressMode;
+            sampler.MipLODBias = 0.0f;
+            sampler.MaxAnisotropy = 1;
+            sampler.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
+            sampler.BorderColor = borderColor;
+            sampler.MinLOD = 0.0f;
+            sampler.MaxLOD = D3D12_FLOAT32_MAX;
+            sampler.ShaderRegister = shaderRegister;
+            sampler.RegisterSpace = 0;
+            sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+            return sampler;
+        }
+
+        /**
+         * @brief 共通ルートシグネチャの記述（内部を指すポインタを持つためコピー不可）
+         */
+        struct GlobalRootSignatureLayout {
+            D3D12_DESCRIPTOR_RANGE textureRange = {};
+            D3D12_DESCRIPTOR_RANGE bindlessRange = {};
+            D3D12_ROOT_PARAMETER parameters[RootSignatureCache::GlobalParameterCount] = {};
+            D3D12_STATIC_SAMPLER_DESC samplers[3] = {};
+            D3D12_ROOT_SIGNATURE_DESC desc = {};
+
+            GlobalRootSignatureLayout() {
+                parameters[RootSignatureCache::Constants].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+                parameters[RootSignatureCache::Constants].Descriptor.ShaderRegister = 0;
+                parameters[RootSignatureCache::Constants].Descriptor.RegisterSpace = 0;
+                parameters[RootSignatureCache::Constants].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+                // パスごとのテクスチャ（G-Buffer は3枚）
+                textureRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+                textureRange.NumDescriptors = RootSignatureCache::GlobalTextureCount;
+                textureRange.BaseShaderRegister = 0;
+                textureRange.RegisterSpace = 0;
+                textureRange.OffsetInDescriptorsFromTableStart = 0;
+
+                parameters[RootSignatureCache::Textures].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+                parameters[RootSignatureCache::Textures].DescriptorTable.NumDescriptorRanges = 1;
+                parameters[RootSignatureCache::Textures].DescriptorTable.pDescriptorRanges = &textureRange;
+                parameters[RootSignatureCache::Textures].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+                // Bindless テクスチャ（定数バッファのインデックスで参照、Resource Binding Tier 2 以上）
+                bindlessRange.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+                bindlessRange.NumDescriptors = UINT_MAX;
+                bindlessRange.BaseShaderRegister = 0;
+                bindlessRange.RegisterSpace = 1;
+                bindlessRange.OffsetInDescriptorsFromTableStart = 0;
+
+                parameters[RootSignatureCache::BindlessTextures].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+                parameters[RootSignatureCache::BindlessTextures].DescriptorTable.NumDescriptorRanges = 1;
+                parameters[RootSignatureCache::BindlessTextures].DescriptorTable.pDescriptorRanges = &bindlessRange;
+                parameters[RootSignatureCache::BindlessTextures].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+                samplers[0] = MakeStaticSampler(0, D3D12_FILTER_MIN_MAG_MIP_LINEAR,
+                                                D3D12_TEXTURE_ADDRESS_MODE_WRAP, D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE);
+                samplers[1] = MakeStaticSampler(1, D3D12_FILTER_MIN_MAG_MIP_POINT,
+                                                D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK);
+                samplers[2] = MakeStaticSampler(2, D3D12_FILTER_MIN_MAG_MIP_LINEAR,
+                                                D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_STATIC_BORDER_COLOR_OPAQUE_BLACK);
+
+                desc.NumParameters = RootSignatureCache::GlobalParameterCount;
+                desc.pParameters = parameters;
+                desc.NumStaticSamplers = 3;
+                desc.pStaticSamplers = samplers;
+                desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+            }
+
+            GlobalRootSignatureLayout(const GlobalRootSignatureLayout&) = delete;
+            GlobalRootSignatureLayout& operator=(const GlobalRootSignatureLayout&) = delete;
+        };
+    }
+
+    void RootSignatureCache::Initialize(ID3D12Device* device) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->device = device;
+        rootSignatures.clear();
+        stats = {};
+    }
+
+    void RootSignatureCache::Shutdown() {
+        std::lock_guard<std::mutex> lock(mutex);
+        rootSignatures.clear();
+        device.Reset();
+    }
+
+    ComPtr<ID3D12RootSignature> RootSignatureCache::GetRootSignature(const D3D12_ROOT_SIGNATURE_DESC& desc) {
+        uint64_t hash = ComputeHash(desc);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = rootSignatures.find(hash);
+        if (it != rootSignatures.end()) {
+            stats.hits++;
+            return it->second;
+        }
+
+        ComPtr<ID3D12RootSignature> rootSignature = Create(device.Get(), desc);
+        rootSignatures.emplace(hash, rootSignature);
+        stats.creates++;
+        return rootSignature;
+    }
+
+    ComPtr<ID3D12RootSignature> RootSignatureCache::GetGlobalRootSignature() {
+        GlobalRootSignatureLayout layout;
+        return GetRootSignature(layout.desc);
+    }
+
+    ComPtr<ID3D12RootSignature> RootSignatureCache::Create(ID3D12Device* device, const D3D12_ROOT_SIGNATURE_DESC& desc) {
+        ComPtr<ID3DBlob> signature;
+        ComPtr<ID3DBlob> error;
+        HRESULT hr = D3D12SerializeRootSignature(&desc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
+        if (FAILED(hr)) {
+            if (error) {
+                Logger::Error("Root signature error: %s", (char*)error->GetBufferPointer());
+            }
+            throw std::runtime_error("Failed to serialize root signature");
+        }
+
+        ComPtr<ID3D12RootSignature> rootSignature;
+        hr = device->CreateRootSignature(
+            0,
+            signature->GetBufferPointer(),
+            signature->GetBufferSize(),
+            IID_PPV_ARGS(&rootSignature)
+        );
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create root signature");
+        }
+
+        // PSO キャッシュのキーを実行間で固定し、プリウォームの対象にする
+        if (PipelineCache* pipelineCache = PipelineCache::GetGlobal()) {
+            pipelineCache->RegisterRootSignature(rootSignature.Get(), signature->GetBufferPointer(), signature->GetBufferSize());
+        }
+        return rootSignature;
+    }
+
+    uint64_t RootSignatureCache::ComputeHash(const D3D12_ROOT_SIGNATURE_DESC& desc) {
+        uint64_t hash = FnvOffsetBasis;
+        HashValue(hash, desc.NumParameters);
+        for (UINT i = 0; i < desc.NumParameters; ++i) {
+            const D3D12_ROOT_PARAMETER& parameter = desc.pParameters[i];
+            HashValue(hash, parameter.ParameterType);
+            HashValue(hash, parameter.ShaderVisibility);
+            switch (parameter.ParameterType) {
+            case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+                HashValue(hash, parameter.DescriptorTable.NumDescriptorRanges);
+                for (UINT r = 0; r < parameter.DescriptorTable.NumDescriptorRanges; ++r) {
+                    HashValue(hash, parameter.DescriptorTable.pDescriptorRanges[r]);
+                }
+                break;
+            case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+                HashValue(hash, parameter.Constants);
+                break;
+            default:
+                HashValue(hash, parameter.Descriptor);
+                break;
+            }
+        }
+
+        HashValue(hash, desc.NumStaticSamplers);
+        for (UINT i = 0; i < desc.NumStaticSamplers; ++i) {
+            HashValue(hash, desc.pStaticSamplers[i]);
+        }
+        HashValue(hash, desc.Flags);
+        return hash;
+    }
+
+    RootSignatureCache::Stats RootSignatureCache::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    void RootSignatureCache::LogStats() const {
+        Stats current = GetStats();
+        Logger::Info("RootSignatureCache: %llu hits, %llu creates",
+                    static_cast<unsigned long long>(current.hits),
+                    static_cast<unsigned long long>(current.creates));
+    }
+
+    ComPtr<ID3D12RootSignature> RootSignatureCache::LoadRootSignature(ID3D12Device* device,
+                                                                      const D3D12_ROOT_SIGNATURE_DESC& desc) {
+        if (RootSignatureCache* cache = GetGlobal()) {
+            return cache->GetRootSignature(desc);
+        }
+        return Create(device, desc);
+    }
+
+    ComPtr<ID3D12RootSignature> RootSignatureCache::LoadGlobalRootSignature(ID3D12Device* device) {
+        GlobalRootSignatureLayout layout;
+        return LoadRootSignature(device, layout.desc);
+    }
+
+} // namespace Athena
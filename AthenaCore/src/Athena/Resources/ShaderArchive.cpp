@@ -0,0 +1,249 @@
+#include "Athena/Resources/ShaderArchive.h"
+#include "Athena/Utils/Logger.h"
+#include <Windows.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <tuple>
+
+namespace Athena {
+
+    namespace {
+        constexpr uint64_t BytecodeAlignment = 16;
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        bool EntryLess(const ShaderArchive::EntryRecord& entry, const std::pair<uint64_t, ShaderPermutationKey>& key) {
+            return std::tie(entry.setId, entry.key) < std::tie(key.first, key.second);
+        }
+    }
+
+    // =====================================================
+    // ShaderArchive
+    // =====================================================
+
+    bool ShaderArchive::Open(const std::filesystem::path& path) {
+        Close();
+
+        HANDLE fileHandle = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<long long>(sizeof(Header))) {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            if (mappingHandle) {
+                CloseHandle(mappingHandle);
+            }
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        file = fileHandle;
+        mapping = mappingHandle;
+        if (!Parse(view, static_cast<size_t>(fileSize.QuadPart))) {
+            Logger::Warning("ShaderArchive: %s is not a valid shader archive", path.string().c_str());
+            data = static_cast<const uint8_t*>(view);  // Close() で解放するため
+            Close();
+            return false;
+        }
+
+        Logger::Info("ShaderArchive: mapped %s (%u shaders, %zu bytes)", path.string().c_str(), entryCount, size);
+        return true;
+    }
+
+    bool ShaderArchive::OpenMemory(const void* data, size_t size) {
+        Close();
+        if (!Parse(data, size)) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void ShaderArchive::Close() {
+        if (file) {
+            if (data) {
+                UnmapViewOfFile(data);
+            }
+            CloseHandle(mapping);
+            CloseHandle(file);
+        }
+
+        file = nullptr;
+        mapping = nullptr;
+        data = nullptr;
+        size = 0;
+        sets = nullptr;
+        setCount = 0;
+        entries = nullptr;
+        entryCount = 0;
+    }
+
+    bool ShaderArchive::Parse(const void* data, size_t size) {
+        if (!data || size < sizeof(Header)) {
+            return false;
+        }
+
+        Header header;
+        memcpy(&header, data, sizeof(Header));
+        if (header.magic != Magic || header.version != Version) {
+            return false;
+        }
+
+        uint64_t tableEnd = sizeof(Header) +
+                            static_cast<uint64_t>(header.setCount) * sizeof(SetRecord) +
+                            static_cast<uint64_t>(header.entryCount) * sizeof(EntryRecord);
+        if (tableEnd > size) {
+            return false;
+        }
+
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        const EntryRecord* entryTable = reinterpret_cast<const EntryRecord*>(
+            bytes + sizeof(Header) + header.setCount * sizeof(SetRecord));
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            const EntryRecord& entry = entryTable[i];
+            if (entry.offset < tableEnd || entry.size > size || entry.offset > size - entry.size) {
+                return false;
+            }
+        }
+
+        this->data = bytes;
+        this->size = size;
+        sets = reinterpret_cast<const SetRecord*>(bytes + sizeof(Header));
+        setCount = header.setCount;
+        entries = entryTable;
+        entryCount = header.entryCount;
+        return true;
+    }
+
+    D3D12_SHADER_BYTECODE ShaderArchive::Find(uint64_t setId, ShaderPermutationKey key) const {
+        if (!entries) {
+            return {};
+        }
+
+        auto search = std::make_pair(setId, key);
+        const EntryRecord* end = entries + entryCount;
+        const EntryRecord* it = std::lower_bound(entries, end, search, EntryLess);
+        if (it == end || it->setId != setId || it->key != key) {
+            return {};
+        }
+        return { data + it->offset, static_cast<SIZE_T>(it->size) };
+    }
+
+    bool ShaderArchive::FindSourceHash(uint64_t setId, uint64_t& sourceHash) const {
+        for (uint32_t i = 0; i < setCount; ++i) {
+            if (sets[i].setId == setId) {
+                sourceHash = sets[i].sourceHash;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // =====================================================
+    // ShaderArchiveWriter
+    // =====================================================
+
+    void ShaderArchiveWriter::AddSet(uint64_t setId, uint64_t sourceHash) {
+        for (ShaderArchive::SetRecord& set : sets) {
+            if (set.setId == setId) {
+                set.sourceHash = sourceHash;
+                return;
+            }
+        }
+        sets.push_back({ setId, sourceHash });
+    }
+
+    void ShaderArchiveWriter::AddShader(uint64_t setId, ShaderPermutationKey key, const void* bytecode, size_t size) {
+        Shader shader;
+        shader.setId = setId;
+        shader.key = key;
+        shader.bytecode.assign(static_cast<const char*>(bytecode), static_cast<const char*>(bytecode) + size);
+        shaders.push_back(std::move(shader));
+    }
+
+    std::vector<char> ShaderArchiveWriter::Build() const {
+        // 目次は (setId, key) の順（同じキーは最初に追加したものを使う）
+        std::vector<const Shader*> sorted;
+        for (const Shader& shader : shaders) {
+            sorted.push_back(&shader);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Shader* a, const Shader* b) {
+            return std::tie(a->setId, a->key) < std::tie(b->setId, b->key);
+        });
+        sorted.erase(std::unique(sorted.begin(), sorted.end(), [](const Shader* a, const Shader* b) {
+            return a->setId == b->setId && a->key == b->key;
+        }), sorted.end());
+
+        ShaderArchive::Header header = {};
+        header.magic = ShaderArchive::Magic;
+        header.version = ShaderArchive::Version;
+        header.setCount = static_cast<uint32_t>(sets.size());
+        header.entryCount = static_cast<uint32_t>(sorted.size());
+
+        uint64_t offset = sizeof(header) + sets.size() * sizeof(ShaderArchive::SetRecord) +
+                          sorted.size() * sizeof(ShaderArchive::EntryRecord);
+        std::vector<ShaderArchive::EntryRecord> entries;
+        for (const Shader* shader : sorted) {
+            offset = AlignUp(offset, BytecodeAlignment);
+            entries.push_back({ shader->setId, shader->key, 0, offset, shader->bytecode.size() });
+            offset += shader->bytecode.size();
+        }
+
+        std::vector<char> output(static_cast<size_t>(offset), 0);
+        char* cursor = output.data();
+        memcpy(cursor, &header, sizeof(header));
+        cursor += sizeof(header);
+        if (!sets.empty()) {
+            memcpy(cursor, sets.data(), sets.size() * sizeof(ShaderArchive::SetRecord));
+            cursor += sets.size() * sizeof(ShaderArchive::SetRecord);
+        }
+        if (!entries.empty()) {
+            memcpy(cursor, entries.data(), entries.size() * sizeof(ShaderArchive::EntryRecord));
+        }
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            if (!sorted[i]->bytecode.empty()) {
+                memcpy(output.data() + entries[i].offset, sorted[i]->bytecode.data(), sorted[i]->bytecode.size());
+            }
+        }
+        return output;
+    }
+
+    bool ShaderArchiveWriter::Write(const std::filesystem::path& path) const {
+        std::vector<char> contents = Build();
+
+        std::error_code error;
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path(), error);
+        }
+
+        std::filesystem::path temporary = path;
+        temporary += L".tmp";
+        {
+            std::ofstream output(temporary, std::ios::binary | std::ios::trunc);
+            if (!output) {
+                return false;
+            }
+            output.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        }
+
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Athena
@@ -0,0 +1,390 @@
+#include "Athena/Resources/ShaderCache.h"
+#include "Athena/Utils/Hash.h"
+#include "Athena/Utils/Logger.h"
+#include <d3dcompiler.h>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <system_error>
+#include <sstream>
+#include <stdexcept>
+
+namespace Athena {
+
+    namespace {
+        bool ReadFile(const std::filesystem::path& path, std::string& contents) {
+            std::ifstream file(path, std::ios::binary);
+            if (!file) {
+                return false;
+            }
+            contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return true;
+        }
+
+        /**
+         * @brief コメントを空白に置き換える（改行は残すので行の区切りは変わらない）
+         */
+        std::string StripComments(const std::string& source) {
+            std::string result = source;
+            size_t i = 0;
+            while (i < result.size()) {
+                if (result[i] == '"') {
+                    // 文字列の中の // や /* はコメントではない
+                    for (++i; i < result.size() && result[i] != '"' && result[i] != '\n'; ++i) {
+                        if (result[i] == '\\') {
+                            ++i;
+                        }
+                    }
+                    ++i;
+                } else if (result.compare(i, 2, "//") == 0) {
+                    for (; i < result.size() && result[i] != '\n'; ++i) {
+                        result[i] = ' ';
+                    }
+                } else if (result.compare(i, 2, "/*") == 0) {
+                    size_t end = result.find("*/", i + 2);
+                    end = (end == std::string::npos) ? result.size() : end + 2;
+                    for (; i < end; ++i) {
+                        if (result[i] != '\n') {
+                            result[i] = ' ';
+                        }
+                    }
+                } else {
+                    ++i;
+                }
+            }
+            return result;
+        }
+
+        enum class Condition { False, True, Unknown };
+
+        /**
+         * @brief #if / #elif の条件を評価（マクロ定義で変わる条件は分からないので Unknown）
+         */
+        Condition EvaluateCondition(const std::string& expression) {
+            size_t begin = expression.find_first_not_of(" \t\r");
+            if (begin == std::string::npos) {
+                return Condition::Unknown;
+            }
+            size_t end = expression.find_last_not_of(" \t\r");
+            std::string value = expression.substr(begin, end - begin + 1);
+            if (value == "0") {
+                return Condition::False;
+            }
+            if (value == "1") {
+                return Condition::True;
+            }
+            return Condition::Unknown;
+        }
+
+        /**
+         * @brief ソースが参照する #include のパスを書かれた順に集める
+         *
+         * コメント内と #if 0 などの無効なブロック内は除く。条件が分からない分岐はすべて辿る
+         * （余分なファイルがキーに入るだけで、必要なファイルを見落とすことはない）。
+         */
+        std::vector<std::string> FindIncludes(const std::string& source) {
+            struct Branch {
+                bool parentActive;
+                bool active;
+                bool taken;        // 真と分かっている分岐を通過済み（以降の #elif / #else は無効）
+            };
+            std::vector<Branch> branches;
+            std::vector<std::string> includes;
+
+            std::istringstream lines(StripComments(source));
+            std::string line;
+            while (std::getline(lines, line)) {
+                size_t hashPos = line.find_first_not_of(" \t");
+                if (hashPos == std::string::npos || line[hashPos] != '#') {
+                    continue;
+                }
+                size_t nameBegin = line.find_first_not_of(" \t", hashPos + 1);
+                if (nameBegin == std::string::npos) {
+                    continue;
+                }
+                size_t nameEnd = line.find_first_of(" \t\r\"<", nameBegin);
+                std::string directive = line.substr(nameBegin, nameEnd - nameBegin);
+                std::string argument = (nameEnd == std::string::npos) ? std::string() : line.substr(nameEnd);
+                bool active = branches.empty() || (branches.back().parentActive && branches.back().active);
+
+                if (directive == "if" || directive == "ifdef" || directive == "ifndef") {
+                    Condition condition = (directive == "if") ? EvaluateCondition(argument) : Condition::Unknown;
+                    branches.push_back({ active, condition != Condition::False, condition == Condition::True });
+                } else if (directive == "elif" && !branches.empty()) {
+                    Branch& branch = branches.back();
+                    Condition condition = EvaluateCondition(argument);
+                    branch.active = !branch.taken && condition != Condition::False;
+                    branch.taken |= condition == Condition::True;
+                } else if (directive == "else" && !branches.empty()) {
+                    Branch& branch = branches.back();
+                    branch.active = !branch.taken;
+                    branch.taken = true;
+                } else if (directive == "endif" && !branches.empty()) {
+                    branches.pop_back();
+                } else if (directive == "include" && active) {
+                    size_t open = argument.find_first_of("\"<");
+                    if (open == std::string::npos) {
+                        continue;
+                    }
+                    size_t close = argument.find_first_of("\">", open + 1);
+                    if (close == std::string::npos) {
+                        continue;
+                    }
+                    includes.push_back(argument.substr(open + 1, close - open - 1));
+                }
+            }
+            return includes;
+        }
+    }
+
+    void ShaderCache::HashSourceTree(uint64_t& hash, const std::filesystem::path& root, SourceFileMap& files) {
+        // 書かれた順に深さ優先で辿り、同じファイルは1回だけ加える
+        std::vector<std::filesystem::path> pending = { root.lexically_normal() };
+        std::set<std::filesystem::path> visited;
+        while (!pending.empty()) {
+            std::filesystem::path path = std::move(pending.back());
+            pending.pop_back();
+            if (!visited.insert(path).second) {
+                continue;
+            }
+
+            std::error_code error;
+            std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(path, error);
+            auto it = files.find(path.native());
+            if (!error && (it == files.end() || it->second.lastWriteTime != lastWriteTime)) {
+                std::string source;
+                if (ReadFile(path, source)) {
+                    SourceFile file;
+                    file.lastWriteTime = lastWriteTime;
+                    file.contentHash = FnvOffsetBasis;
+                    HashString(file.contentHash, source);
+                    for (const std::string& include : FindIncludes(source)) {
+                        // インクルードするファイルからの相対パス
+                        file.includes.push_back((path.parent_path() / include).lexically_normal());
+                    }
+                    it = files.insert_or_assign(path.native(), std::move(file)).first;
+                } else {
+                    error = std::make_error_code(std::errc::io_error);
+                }
+            }
+
+            if (error) {
+                // 見つからないファイルは名前だけ加え、後から作成された場合にキーが変わるようにする
+                if (it != files.end()) {
+                    files.erase(it);
+                }
+                HashString(hash, "<missing>");
+                HashString(hash, path.filename().string());
+                continue;
+            }
+
+            HashValue(hash, it->second.contentHash);
+            pending.insert(pending.end(), it->second.includes.rbegin(), it->second.includes.rend());
+        }
+    }
+
+    void ShaderCache::Initialize(const Settings& settings) {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->settings = settings;
+        blobs.clear();
+        stats = {};
+
+        if (settings.useDiskCache) {
+            std::error_code error;
+            std::filesystem::create_directories(settings.cacheDirectory, error);
+            if (error) {
+                Logger::Warning("ShaderCache: failed to create cache directory, disk cache disabled");
+                this->settings.useDiskCache = false;
+            }
+        }
+
+        Logger::Info("ShaderCache initialized (%s, disk cache: %s)",
+                    settings.debugShaders ? "debug" : "optimized",
+                    this->settings.useDiskCache ? "on" : "off");
+    }
+
+    void ShaderCache::Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        blobs.clear();
+    }
+
+    void ShaderCache::ReloadSources() {
+        std::lock_guard<std::mutex> lock(sourceMutex);
+        sourceFiles.clear();
+    }
+
+    uint32_t ShaderCache::GetCompileFlags() const {
+        return settings.debugShaders
+            ? (D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION)
+            : D3DCOMPILE_OPTIMIZATION_LEVEL3;
+    }
+
+    uint64_t ShaderCache::ComputeHash(const ShaderDesc& desc) const {
+        uint64_t hash = FnvOffsetBasis;
+
+        {
+            std::lock_guard<std::mutex> lock(sourceMutex);
+            HashSourceTree(hash, std::filesystem::path(desc.filepath), sourceFiles);
+        }
+
+        HashString(hash, desc.entryPoint);
+        HashString(hash, desc.target);
+        for (const ShaderDefine& define : desc.defines) {
+            HashString(hash, define.name);
+            HashString(hash, define.value);
+        }
+
+        uint32_t flags = GetCompileFlags();
+        HashBytes(hash, &flags, sizeof(flags));
+        return hash;
+    }
+
+    uint64_t ShaderCache::ComputeSourceHash(const std::filesystem::path& filepath) {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(filepath, error)) {
+            throw std::runtime_error("Failed to read shader source: " + filepath.string());
+        }
+
+        uint64_t hash = FnvOffsetBasis;
+        SourceFileMap files;
+        HashSourceTree(hash, filepath, files);
+        return hash;
+    }
+
+    ComPtr<ID3DBlob> ShaderCache::GetShader(const ShaderDesc& desc) {
+        uint64_t hash = ComputeHash(desc);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = blobs.find(hash);
+            if (it != blobs.end()) {
+                stats.memoryHits++;
+                return it->second;
+            }
+        }
+
+        ComPtr<ID3DBlob> blob = settings.useDiskCache ? LoadFromDisk(hash) : nullptr;
+        bool fromDisk = blob != nullptr;
+        if (!blob) {
+            blob = Compile(desc, GetCompileFlags());
+            if (settings.useDiskCache) {
+                SaveToDisk(hash, blob.Get());
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (fromDisk) {
+            stats.diskHits++;
+        } else {
+            stats.compiles++;
+        }
+        // 別スレッドが同時に作成した場合は先に登録された方を使う
+        auto [it, inserted] = blobs.emplace(hash, blob);
+        return it->second;
+    }
+
+    ComPtr<ID3DBlob> ShaderCache::LoadShader(const std::wstring& filepath, const std::string& entryPoint,
+                                             const std::string& target, const std::vector<ShaderDefine>& defines) {
+        ShaderDesc desc;
+        desc.filepath = filepath;
+        desc.entryPoint = entryPoint;
+        desc.target = target;
+        desc.defines = defines;
+
+        if (ShaderCache* cache = GetGlobal()) {
+            return cache->GetShader(desc);
+        }
+        return Compile(desc, D3DCOMPILE_OPTIMIZATION_LEVEL3);
+    }
+
+    ComPtr<ID3DBlob> ShaderCache::Compile(const ShaderDesc& desc, uint32_t flags) {
+        std::vector<D3D_SHADER_MACRO> macros;
+        macros.reserve(desc.defines.size() + 1);
+        for (const ShaderDefine& define : desc.defines) {
+            macros.push_back({ define.name.c_str(), define.value.c_str() });
+        }
+        macros.push_back({ nullptr, nullptr });
+
+        ComPtr<ID3DBlob> shader;
+        ComPtr<ID3DBlob> error;
+
+        HRESULT hr = D3DCompileFromFile(
+            desc.filepath.c_str(),
+            macros.data(),
+            D3D_COMPILE_STANDARD_FILE_INCLUDE,
+            desc.entryPoint.c_str(),
+            desc.target.c_str(),
+            flags, 0,
+            &shader, &error
+        );
+
+        if (FAILED(hr)) {
+            if (error) {
+                Logger::Error("Shader compilation failed: %s", (char*)error->GetBufferPointer());
+            }
+            Logger::Error("Failed to compile shader: %S", desc.filepath.c_str());
+            throw std::runtime_error("Failed to compile shader");
+        }
+
+        Logger::Info("Shader compiled: %S (%s)", desc.filepath.c_str(), desc.target.c_str());
+        return shader;
+    }
+
+    std::filesystem::path ShaderCache::GetCachePath(uint64_t hash) const {
+        char name[32];
+        snprintf(name, sizeof(name), "%016llx.cso", static_cast<unsigned long long>(hash));
+        return settings.cacheDirectory / name;
+    }
+
+    ComPtr<ID3DBlob> ShaderCache::LoadFromDisk(uint64_t hash) const {
+        std::string contents;
+        if (!ReadFile(GetCachePath(hash), contents) || contents.empty()) {
+            return nullptr;
+        }
+
+        ComPtr<ID3DBlob> blob;
+        if (FAILED(D3DCreateBlob(contents.size(), &blob))) {
+            return nullptr;
+        }
+        memcpy(blob->GetBufferPointer(), contents.data(), contents.size());
+        return blob;
+    }
+
+    void ShaderCache::SaveToDisk(uint64_t hash, ID3DBlob* blob) const {
+        // 書き込み途中のファイルを読まないよう、一時ファイルに書いてから置き換える
+        std::filesystem::path path = GetCachePath(hash);
+        std::filesystem::path temporary = path;
+        temporary += L".tmp";
+
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                Logger::Warning("ShaderCache: failed to write %s", path.string().c_str());
+                return;
+            }
+            file.write(static_cast<const char*>(blob->GetBufferPointer()),
+                       static_cast<std::streamsize>(blob->GetBufferSize()));
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+        }
+    }
+
+    ShaderCache::Stats ShaderCache::GetStats() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    void ShaderCache::LogStats() const {
+        Stats current = GetStats();
+        Logger::Info("ShaderCache: %llu memory hits, %llu disk hits, %llu compiles",
+                    static_cast<unsigned long long>(current.memoryHits),
+                    static_cast<unsigned long long>(current.diskHits),
+                    static_cast<unsigned long long>(current.compiles));
+    }
+
+} // namespace Athena
@@ -0,0 +1,103 @@
+#include "Athena/Resources/ShaderPermutation.h"
+#include "Athena/Utils/Hash.h"
+#include "Athena/Utils/Logger.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    void ShaderPermutationSet::Initialize(const ShaderPermutationDesc& desc, const ShaderArchive* archive) {
+        if (desc.keywords.size() > MaxKeywords) {
+            throw std::invalid_argument("ShaderPermutationSet: too many keywords");
+        }
+
+        this->desc = desc;
+        id = ComputeId(desc);
+        variants.clear();
+        variants.resize(size_t(1) << desc.keywords.size());
+
+        uint64_t archivedHash = 0;
+        if (!archive || !archive->IsOpen() || !archive->FindSourceHash(id, archivedHash)) {
+            return;
+        }
+
+        // ソースが更新されていればアーカイブは古いので使わない
+        try {
+            if (ShaderCache::ComputeSourceHash(desc.filepath) != archivedHash) {
+                Logger::Warning("ShaderPermutationSet: archive is out of date for %S, compiling at runtime",
+                              desc.filepath.c_str());
+                return;
+            }
+        }
+        catch (const std::exception&) {
+            // ソースがない場合はアーカイブをそのまま使う
+        }
+
+        uint32_t loaded = 0;
+        for (ShaderPermutationKey key = 0; key < variants.size(); ++key) {
+            D3D12_SHADER_BYTECODE bytecode = archive->Find(id, key);
+            if (bytecode.pShaderBytecode) {
+                variants[key].bytecode = bytecode;
+                ++loaded;
+            }
+        }
+        Logger::Info("ShaderPermutationSet: %u/%u variants of %S loaded from archive",
+                   loaded, GetPermutationCount(), desc.filepath.c_str());
+    }
+
+    ShaderPermutationKey ShaderPermutationSet::GetKeywordMask(const std::string& keyword) const {
+        for (size_t i = 0; i < desc.keywords.size(); ++i) {
+            if (desc.keywords[i] == keyword) {
+                return ShaderPermutationKey(1) << i;
+            }
+        }
+        throw std::invalid_argument("ShaderPermutationSet: undeclared keyword " + keyword);
+    }
+
+    D3D12_SHADER_BYTECODE ShaderPermutationSet::Get(ShaderPermutationKey key) {
+        if (key >= variants.size()) {
+            throw std::out_of_range("ShaderPermutationSet: invalid permutation key");
+        }
+
+        Variant& variant = variants[key];
+        if (!variant.bytecode.pShaderBytecode) {
+            variant.blob = ShaderCache::LoadShader(desc.filepath, desc.entryPoint, desc.target, MakeDefines(key));
+            variant.bytecode = { variant.blob->GetBufferPointer(), variant.blob->GetBufferSize() };
+        }
+        return variant.bytecode;
+    }
+
+    bool ShaderPermutationSet::IsLoaded(ShaderPermutationKey key) const {
+        return key < variants.size() && variants[key].bytecode.pShaderBytecode != nullptr;
+    }
+
+    std::vector<ShaderDefine> ShaderPermutationSet::MakeDefines(ShaderPermutationKey key) const {
+        std::vector<ShaderDefine> defines;
+        defines.reserve(desc.keywords.size());
+        for (size_t i = 0; i < desc.keywords.size(); ++i) {
+            defines.push_back({ desc.keywords[i], (key & (ShaderPermutationKey(1) << i)) ? "1" : "0" });
+        }
+        return defines;
+    }
+
+    uint64_t ShaderPermutationSet::ComputeId(const ShaderPermutationDesc& desc) {
+        uint64_t hash = FnvOffsetBasis;
+        HashBytes(hash, desc.filepath.data(), desc.filepath.size() * sizeof(wchar_t));
+        HashBytes(hash, "", 1);
+        HashString(hash, desc.entryPoint);
+        HashString(hash, desc.target);
+        for (const std::string& keyword : desc.keywords) {
+            HashString(hash, keyword);
+        }
+        return hash;
+    }
+
+    void ShaderPermutationSet::CompileAll(ShaderArchiveWriter& writer) {
+        writer.AddSet(id, ShaderCache::ComputeSourceHash(desc.filepath));
+        for (ShaderPermutationKey key = 0; key < variants.size(); ++key) {
+            D3D12_SHADER_BYTECODE bytecode = Get(key);
+            writer.AddShader(id, key, bytecode.pShaderBytecode, bytecode.BytecodeLength);
+        }
+        Logger::Info("ShaderPermutationSet: compiled %u variants of %S", GetPermutationCount(), desc.filepath.c_str());
+    }
+
+} // namespace Athena
@@ -0,0 +1,215 @@
+#include "Athena/Resources/StreamingUploadQueue.h"
+#include "Athena/Resources/UploadScheduler.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace Athena {
+
+    StreamingUploadQueue::RequestId StreamingUploadQueue::Enqueue(
+        UploadPriority priority, std::vector<UploadChunk> chunks, std::function<void()> onComplete) {
+
+        if (priority >= UploadPriority::Count) {
+            throw std::invalid_argument("Invalid upload priority");
+        }
+
+        Request request;
+        request.id = nextRequestId++;
+        request.chunks = std::move(chunks);
+        request.onComplete = std::move(onComplete);
+
+        RequestId id = request.id;
+        queues[static_cast<size_t>(priority)].push_back(std::move(request));
+        return id;
+    }
+
+    StreamingUploadQueue::RequestId StreamingUploadQueue::EnqueueBuffer(
+        ID3D12Resource* destination, std::vector<uint8_t> data, UploadPriority priority,
+        D3D12_RESOURCE_STATES finalState, std::function<void()> onComplete) {
+
+        if (!destination || data.empty()) {
+            throw std::invalid_argument("Invalid buffer upload arguments");
+        }
+
+        auto source = std::make_shared<std::vector<uint8_t>>(std::move(data));
+        ComPtr<ID3D12Resource> target = destination;
+        uint64_t totalSize = source->size();
+        uint64_t chunkSize = std::max<uint64_t>(settings.chunkSize, 1);
+
+        std::vector<UploadChunk> chunks;
+        for (uint64_t offset = 0; offset < totalSize; offset += chunkSize) {
+            uint64_t size = std::min(chunkSize, totalSize - offset);
+            bool last = offset + size == totalSize;
+            D3D12_RESOURCE_STATES state = last ? finalState : D3D12_RESOURCE_STATE_COMMON;
+
+            UploadChunk chunk;
+            chunk.size = size;
+            chunk.record = [source, target, offset, size, state](UploadScheduler& scheduler) {
+                scheduler.UploadBuffer(target.Get(), source->data() + offset, size, offset, state);
+            };
+            chunks.push_back(std::move(chunk));
+        }
+
+        return Enqueue(priority, std::move(chunks), std::move(onComplete));
+    }
+
+    StreamingUploadQueue::RequestId StreamingUploadQueue::EnqueueTexture(
+        ID3D12Resource* destination, std::vector<D3D12_SUBRESOURCE_DATA> subresources,
+        std::shared_ptr<void> sourceData, UploadPriority priority,
+        D3D12_RESOURCE_STATES finalState, std::function<void()> onComplete) {
+
+        if (!destination || subresources.empty()) {
+            throw std::invalid_argument("Invalid texture upload arguments");
+        }
+
+        auto data = std::make_shared<std::vector<D3D12_SUBRESOURCE_DATA>>(std::move(subresources));
+        ComPtr<ID3D12Resource> target = destination;
+        uint32_t count = static_cast<uint32_t>(data->size());
+
+        // 連続したサブリソースを chunkSize 程度までまとめる（大きなミップは単独のチャンク）
+        std::vector<UploadChunk> chunks;
+        uint32_t first = 0;
+        while (first < count) {
+            uint32_t end = first;
+            uint64_t size = 0;
+            do {
+                size += static_cast<uint64_t>((*data)[end].SlicePitch);
+                ++end;
+            } while (end < count && size + static_cast<uint64_t>((*data)[end].SlicePitch) <= settings.chunkSize);
+
+            bool last = end == count;
+            D3D12_RESOURCE_STATES state = last ? finalState : D3D12_RESOURCE_STATE_COMMON;
+
+            UploadChunk chunk;
+            chunk.size = size;
+            chunk.record = [data, sourceData, target, first, end, state](UploadScheduler& scheduler) {
+                scheduler.UploadTexture(target.Get(), data->data() + first, end - first, state, first);
+            };
+            chunks.push_back(std::move(chunk));
+            first = end;
+        }
+
+        return Enqueue(priority, std::move(chunks), std::move(onComplete));
+    }
+
+    uint32_t StreamingUploadQueue::ProcessFrame(UploadScheduler* scheduler) {
+        using Clock = std::chrono::steady_clock;
+        Clock::time_point start = Clock::now();
+
+        uint64_t bytes = 0;
+        uint32_t chunkCount = 0;
+        bool batchOpen = false;
+        bool budgetExhausted = false;
+        std::vector<std::function<void()>> finished;
+
+        for (auto& queue : queues) {
+            while (!queue.empty() && !budgetExhausted) {
+                Request& request = queue.front();
+
+                while (request.nextChunk < request.chunks.size()) {
+                    UploadChunk& chunk = request.chunks[request.nextChunk];
+
+                    // 1つ目のチャンクは予算に関係なく処理する
+                    if (chunkCount > 0) {
+                        double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                        if (bytes + chunk.size > settings.bytesPerFrame || elapsed >= settings.millisecondsPerFrame) {
+                            budgetExhausted = true;
+                            break;
+                        }
+                    }
+
+                    if (scheduler) {
+                        if (!batchOpen) {
+                            scheduler->BeginBatch();
+                            batchOpen = true;
+                        }
+                        chunk.record(*scheduler);
+                    }
+
+                    // 記録済みのチャンクが保持するデータはここで手放す
+                    chunk.record = nullptr;
+                    bytes += chunk.size;
+                    chunkCount++;
+                    request.nextChunk++;
+                }
+
+                if (request.nextChunk < request.chunks.size()) {
+                    break;
+                }
+
+                if (request.onComplete) {
+                    finished.push_back(std::move(request.onComplete));
+                }
+                completedRequests++;
+                queue.pop_front();
+            }
+        }
+
+        if (batchOpen) {
+            UploadTicket ticket = scheduler->Submit();
+            for (auto& callback : finished) {
+                scheduler->OnComplete(ticket, std::move(callback));
+            }
+        } else {
+            for (auto& callback : finished) {
+                callback();
+            }
+        }
+
+        lastFrameBytes = bytes;
+        lastFrameChunks = chunkCount;
+        lastFrameMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        totalBytes += bytes;
+        return chunkCount;
+    }
+
+    bool StreamingUploadQueue::IsPending(RequestId id) const {
+        for (const auto& queue : queues) {
+            for (const Request& request : queue) {
+                if (request.id == id) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool StreamingUploadQueue::IsEmpty() const {
+        for (const auto& queue : queues) {
+            if (!queue.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    StreamingUploadQueue::Stats StreamingUploadQueue::GetStats() const {
+        Stats stats;
+        for (size_t priority = 0; priority < queues.size(); ++priority) {
+            for (const Request& request : queues[priority]) {
+                for (size_t i = request.nextChunk; i < request.chunks.size(); ++i) {
+                    stats.pendingBytes[priority] += request.chunks[i].size;
+                }
+                stats.pendingRequests++;
+            }
+        }
+        stats.lastFrameBytes = lastFrameBytes;
+        stats.lastFrameChunks = lastFrameChunks;
+        stats.lastFrameMilliseconds = lastFrameMilliseconds;
+        stats.totalBytes = totalBytes;
+        stats.completedRequests = completedRequests;
+        return stats;
+    }
+
+    void StreamingUploadQueue::LogStats() const {
+        Stats stats = GetStats();
+        Logger::Info("StreamingUploadQueue: %u pending requests (visible %.1f KB, prefetch %.1f KB, background %.1f KB)",
+                    stats.pendingRequests,
+                    stats.pendingBytes[0] / 1024.0, stats.pendingBytes[1] / 1024.0, stats.pendingBytes[2] / 1024.0);
+        Logger::Info("  Last frame: %u chunks, %.1f KB in %.3f ms; total %.1f MB, %llu requests completed",
+                    stats.lastFrameChunks, stats.lastFrameBytes / 1024.0, stats.lastFrameMilliseconds,
+                    stats.totalBytes / (1024.0 * 1024.0), static_cast<unsigned long long>(stats.completedRequests));
+    }
+
+} // namespace Athena
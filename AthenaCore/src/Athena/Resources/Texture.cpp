@@ -1,5 +1,8 @@
 ﻿#include "Athena/Resources/Texture.h"
 #include "Athena/Resources/UploadContext.h"
+#include "Athena/Resources/UploadScheduler.h"
+#include "Athena/Resources/MemoryBudgetManager.h"
+#include "Athena/Core/DeferredReleaseQueue.h"
 #include "Athena/Utils/Logger.h"
 #include <DirectXTex.h>
 #include <stdexcept>
@@ -93,21 +96,7 @@ namespace Athena {
         textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
         textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-        D3D12_HEAP_PROPERTIES heapProps = {};
-        heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
-
-        hr = device->CreateCommittedResource(
-            &heapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &textureDesc,
-            D3D12_RESOURCE_STATE_COPY_DEST,
-            nullptr,
-            IID_PPV_ARGS(&resource)
-        );
-
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create texture resource");
-        }
+        AllocateResource(device, textureDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr);
 
         std::vector<D3D12_SUBRESOURCE_DATA> subresources(mipLevels);
         const DirectX::Image* images = scratchImage.GetImages();
@@ -169,6 +158,57 @@ namespace Athena {
         Logger::Info("Texture uploaded to GPU successfully");
     }
 
+    void Texture::UploadToGPU(UploadScheduler& scheduler) {
+        if (!tempImageData.GetImageCount()) {
+            Logger::Warning("No image data to upload");
+            return;
+        }
+
+        std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+        for (size_t i = 0; i < tempImageData.GetImageCount(); ++i) {
+            const DirectX::Image* img = tempImageData.GetImage(0, i, 0);
+            D3D12_SUBRESOURCE_DATA subresource = {};
+            subresource.pData = img->pixels;
+            subresource.RowPitch = static_cast<LONG_PTR>(img->rowPitch);
+            subresource.SlicePitch = static_cast<LONG_PTR>(img->slicePitch);
+            subresources.push_back(subresource);
+        }
+
+        // ステージング領域へコピー済みなので画像データはすぐに解放できる
+        scheduler.UploadTexture(
+            resource.Get(),
+            subresources.data(),
+            static_cast<uint32_t>(subresources.size()),
+            D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE
+        );
+
+        tempImageData.Release();
+    }
+
+    void Texture::EnqueueUpload(StreamingUploadQueue& queue, UploadPriority priority,
+                                std::function<void()> onComplete) {
+        if (!tempImageData.GetImageCount()) {
+            Logger::Warning("No image data to upload");
+            return;
+        }
+
+        // 画像データは転送が終わるまでキューが保持する
+        auto image = std::make_shared<DirectX::ScratchImage>(std::move(tempImageData));
+
+        std::vector<D3D12_SUBRESOURCE_DATA> subresources;
+        for (size_t i = 0; i < image->GetImageCount(); ++i) {
+            const DirectX::Image* img = image->GetImage(0, i, 0);
+            D3D12_SUBRESOURCE_DATA subresource = {};
+            subresource.pData = img->pixels;
+            subresource.RowPitch = static_cast<LONG_PTR>(img->rowPitch);
+            subresource.SlicePitch = static_cast<LONG_PTR>(img->slicePitch);
+            subresources.push_back(subresource);
+        }
+
+        queue.EnqueueTexture(resource.Get(), std::move(subresources), image, priority,
+                             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, std::move(onComplete));
+    }
+
     void Texture::CreateFromMemory(
         ID3D12Device* device,
         uint32_t width,
@@ -266,8 +306,22 @@ namespace Athena {
 
     void Texture::Shutdown() {
         tempImageData.Release();
-        uploadBuffer.Reset();
-        resource.Reset();
+        ReleaseResources();
+    }
+
+    void Texture::ReleaseResources() {
+        UnregisterResidency();
+
+        // GPUが参照中の可能性があるため、フレームの完了まで解放を遅らせる
+        if (uploadBuffer) {
+            DeferredReleaseQueue::DeferRelease(std::move(uploadBuffer));
+        }
+        if (resource) {
+            DeferredReleaseQueue::DeferRelease(std::move(resource));
+        }
+        if (allocation.IsValid()) {
+            DeferredReleaseQueue::DeferRelease(std::move(allocation));
+        }
     }
 
     void Texture::CreateSRV(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuHandle) {
@@ -327,20 +381,83 @@ namespace Athena {
         resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
         resourceDesc.Flags = flags;
 
-        D3D12_HEAP_PROPERTIES heapProps = {};
-        heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+        AllocateResource(device, resourceDesc, initialState, clearValue);
+    }
 
-        HRESULT hr = device->CreateCommittedResource(
-            &heapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &resourceDesc,
-            initialState,
-            clearValue,
-            IID_PPV_ARGS(&resource)
-        );
+    void Texture::AllocateResource(
+        ID3D12Device* device,
+        const D3D12_RESOURCE_DESC& resourceDesc,
+        D3D12_RESOURCE_STATES initialState,
+        const D3D12_CLEAR_VALUE* clearValue) {
 
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create texture resource");
+        // 再作成の場合は以前のリソースを解放
+        UnregisterResidency();
+        if (resource) {
+            DeferredReleaseQueue::DeferRelease(std::move(resource));
+        }
+        if (allocation.IsValid()) {
+            DeferredReleaseQueue::DeferRelease(std::move(allocation));
+        }
+
+        if (memoryAllocator) {
+            allocation = memoryAllocator->CreateResource(resourceDesc, D3D12_HEAP_TYPE_DEFAULT, initialState, clearValue);
+            resource = allocation.GetResource();
+        } else {
+            D3D12_HEAP_PROPERTIES heapProps = {};
+            heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+            HRESULT hr = device->CreateCommittedResource(
+                &heapProps,
+                D3D12_HEAP_FLAG_NONE,
+                &resourceDesc,
+                initialState,
+                clearValue,
+                IID_PPV_ARGS(&resource)
+            );
+
+            if (FAILED(hr)) {
+                throw std::runtime_error("Failed to create texture resource");
+            }
+        }
+
+        RegisterResidency(device, resourceDesc);
+    }
+
+    void Texture::RegisterResidency(ID3D12Device* device, const D3D12_RESOURCE_DESC& resourceDesc) {
+        MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal();
+        if (!budgetManager) {
+            return;
+        }
+
+        // レンダーターゲット・深度は毎フレーム書き込むため退避の対象にしない
+        bool isAttachment = (resourceDesc.Flags &
+            (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0;
+        BudgetCategory category = isAttachment ? BudgetCategory::RenderTarget : BudgetCategory::Texture;
+
+        uint64_t sizeInBytes = allocation.IsValid()
+            ? allocation.GetSize()
+            : device->GetResourceAllocationInfo(0, 1, &resourceDesc).SizeInBytes;
+
+        // ヒープに配置したリソースはヒープ単位のため個別に退避しない
+        residencyId = budgetManager->Register(
+            static_cast<ID3D12Pageable*>(resource.Get()), category, sizeInBytes, !allocation.IsValid());
+    }
+
+    void Texture::UnregisterResidency() {
+        if (residencyId == MemoryBudgetManager::InvalidId) {
+            return;
+        }
+        if (MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal()) {
+            budgetManager->Unregister(residencyId);
+        }
+        residencyId = MemoryBudgetManager::InvalidId;
+    }
+
+    void Texture::MarkUsed() const {
+        if (residencyId != MemoryBudgetManager::InvalidId) {
+            if (MemoryBudgetManager* budgetManager = MemoryBudgetManager::GetGlobal()) {
+                budgetManager->MarkUsed(residencyId);
+            }
         }
     }
 
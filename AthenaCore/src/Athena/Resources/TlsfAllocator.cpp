@@ -0,0 +1,372 @@
+#include "Athena/Resources/TlsfAllocator.h"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace Athena {
+
+    namespace {
+        uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        uint32_t FloorLog2(uint64_t value) {
+            return static_cast<uint32_t>(std::bit_width(value) - 1);
+        }
+    }
+
+    void TlsfAllocator::Reset(uint64_t size, uint64_t granularity) {
+        if (granularity == 0 || (granularity & (granularity - 1)) != 0) {
+            throw std::invalid_argument("TLSF granularity must be a power of two");
+        }
+
+        this->granularity = granularity;
+        totalSize = size & ~(granularity - 1);
+        usedSize = 0;
+        allocationCount = 0;
+        freeBlockCount = 0;
+
+        nodes.clear();
+        unusedNodes.clear();
+        firstLevelBitmap = 0;
+        std::fill(std::begin(secondLevelBitmap), std::end(secondLevelBitmap), 0u);
+        for (auto& heads : freeHeads) {
+            std::fill(std::begin(heads), std::end(heads), InvalidNode);
+        }
+
+        if (totalSize > 0) {
+            InsertFree(CreateNode(0, totalSize));
+        }
+    }
+
+    TlsfAllocator::Allocation TlsfAllocator::Allocate(uint64_t size, uint64_t alignment) {
+        if (size == 0 || size > totalSize) {
+            return {};
+        }
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            throw std::invalid_argument("TLSF alignment must be a power of two");
+        }
+
+        size = AlignUp(size, granularity);
+        uint64_t blockAlignment = std::max(alignment, granularity);
+
+        // アライメント調整で先頭が削られても収まるサイズで検索する
+        uint64_t searchSize = size + (blockAlignment - granularity);
+        uint32_t node = FindFreeNode(searchSize);
+        if (node == InvalidNode) {
+            return {};
+        }
+
+        RemoveFree(node);
+
+        // 先頭のパディングを空きブロックとして切り出す
+        uint64_t alignedOffset = AlignUp(nodes[node].offset, blockAlignment);
+        uint64_t padding = alignedOffset - nodes[node].offset;
+        if (padding > 0) {
+            uint32_t front = CreateNode(nodes[node].offset, padding);
+            uint32_t previous = nodes[node].prevPhysical;
+            nodes[front].prevPhysical = previous;
+            nodes[front].nextPhysical = node;
+            if (previous != InvalidNode) {
+                nodes[previous].nextPhysical = front;
+            }
+            nodes[node].prevPhysical = front;
+            nodes[node].offset = alignedOffset;
+            nodes[node].size -= padding;
+            InsertFree(front);
+        }
+
+        // 余りを空きブロックとして切り出す
+        uint64_t remaining = nodes[node].size - size;
+        if (remaining > 0) {
+            uint32_t back = CreateNode(nodes[node].offset + size, remaining);
+            uint32_t next = nodes[node].nextPhysical;
+            nodes[back].prevPhysical = node;
+            nodes[back].nextPhysical = next;
+            if (next != InvalidNode) {
+                nodes[next].prevPhysical = back;
+            }
+            nodes[node].nextPhysical = back;
+            nodes[node].size = size;
+            InsertFree(back);
+        }
+
+        usedSize += size;
+        allocationCount++;
+
+        Allocation allocation;
+        allocation.offset = nodes[node].offset;
+        allocation.size = size;
+        allocation.node = node;
+        return allocation;
+    }
+
+    void TlsfAllocator::Free(const Allocation& allocation) {
+        if (!allocation.IsValid()) {
+            return;
+        }
+
+        uint32_t node = allocation.node;
+        if (node >= nodes.size() || !nodes[node].isAlive || nodes[node].isFree ||
+            nodes[node].offset != allocation.offset) {
+            throw std::invalid_argument("Invalid or already freed TLSF allocation");
+        }
+
+        usedSize -= nodes[node].size;
+        allocationCount--;
+
+        // 前の空きブロックと結合
+        uint32_t previous = nodes[node].prevPhysical;
+        if (previous != InvalidNode && nodes[previous].isFree) {
+            RemoveFree(previous);
+            uint32_t next = nodes[node].nextPhysical;
+            nodes[previous].size += nodes[node].size;
+            nodes[previous].nextPhysical = next;
+            if (next != InvalidNode) {
+                nodes[next].prevPhysical = previous;
+            }
+            DestroyNode(node);
+            node = previous;
+        }
+
+        // 次の空きブロックと結合
+        uint32_t next = nodes[node].nextPhysical;
+        if (next != InvalidNode && nodes[next].isFree) {
+            RemoveFree(next);
+            uint32_t afterNext = nodes[next].nextPhysical;
+            nodes[node].size += nodes[next].size;
+            nodes[node].nextPhysical = afterNext;
+            if (afterNext != InvalidNode) {
+                nodes[afterNext].prevPhysical = node;
+            }
+            DestroyNode(next);
+        }
+
+        InsertFree(node);
+    }
+
+    TlsfAllocator::Stats TlsfAllocator::GetStats() const {
+        Stats stats;
+        stats.totalSize = totalSize;
+        stats.usedSize = usedSize;
+        stats.freeSize = totalSize - usedSize;
+        stats.allocationCount = allocationCount;
+        stats.freeBlockCount = freeBlockCount;
+
+        // 最上位クラスのブロックは下位クラスのどのブロックよりも大きい
+        if (firstLevelBitmap != 0) {
+            uint32_t firstLevel = 63 - static_cast<uint32_t>(std::countl_zero(firstLevelBitmap));
+            uint32_t secondLevel = 31 - static_cast<uint32_t>(std::countl_zero(secondLevelBitmap[firstLevel]));
+            for (uint32_t node = freeHeads[firstLevel][secondLevel]; node != InvalidNode; node = nodes[node].nextFree) {
+                stats.largestFreeBlock = std::max(stats.largestFreeBlock, nodes[node].size);
+            }
+        }
+        return stats;
+    }
+
+    bool TlsfAllocator::Validate() const {
+        // 物理ブロックの連続性
+        uint32_t head = InvalidNode;
+        uint32_t aliveCount = 0;
+        for (uint32_t i = 0; i < nodes.size(); ++i) {
+            if (!nodes[i].isAlive) {
+                continue;
+            }
+            aliveCount++;
+            if (nodes[i].prevPhysical == InvalidNode) {
+                if (head != InvalidNode) {
+                    return false;
+                }
+                head = i;
+            }
+        }
+        if (totalSize == 0) {
+            return aliveCount == 0 && allocationCount == 0;
+        }
+
+        uint64_t expectedOffset = 0;
+        uint64_t walkedUsed = 0;
+        uint32_t walkedCount = 0;
+        uint32_t walkedAllocations = 0;
+        uint32_t walkedFree = 0;
+        bool previousFree = false;
+        for (uint32_t node = head; node != InvalidNode; node = nodes[node].nextPhysical) {
+            const Node& n = nodes[node];
+            if (!n.isAlive || n.offset != expectedOffset || n.size == 0 || (n.size & (granularity - 1)) != 0) {
+                return false;
+            }
+            if (n.isFree && previousFree) {
+                return false;  // 隣接する空きブロックが結合されていない
+            }
+            if (n.nextPhysical != InvalidNode && nodes[n.nextPhysical].prevPhysical != node) {
+                return false;
+            }
+            if (n.isFree) {
+                walkedFree++;
+            }
+            else {
+                walkedUsed += n.size;
+                walkedAllocations++;
+            }
+            previousFree = n.isFree;
+            expectedOffset += n.size;
+            if (++walkedCount > aliveCount) {
+                return false;  // 循環
+            }
+        }
+        if (expectedOffset != totalSize || walkedCount != aliveCount ||
+            walkedUsed != usedSize || walkedAllocations != allocationCount) {
+            return false;
+        }
+
+        // 空きリストとビットマップ
+        uint32_t listedFree = 0;
+        for (uint32_t firstLevel = 0; firstLevel < FirstLevelCount; ++firstLevel) {
+            bool firstLevelSet = (firstLevelBitmap >> firstLevel) & 1;
+            if (firstLevelSet != (secondLevelBitmap[firstLevel] != 0)) {
+                return false;
+            }
+            for (uint32_t secondLevel = 0; secondLevel < SecondLevelCount; ++secondLevel) {
+                uint32_t listHead = freeHeads[firstLevel][secondLevel];
+                bool secondLevelSet = (secondLevelBitmap[firstLevel] >> secondLevel) & 1;
+                if (secondLevelSet != (listHead != InvalidNode)) {
+                    return false;
+                }
+
+                uint32_t previous = InvalidNode;
+                for (uint32_t node = listHead; node != InvalidNode; node = nodes[node].nextFree) {
+                    uint32_t mappedFirst = 0;
+                    uint32_t mappedSecond = 0;
+                    MapInsert(nodes[node].size, mappedFirst, mappedSecond);
+                    if (!nodes[node].isFree || nodes[node].prevFree != previous ||
+                        mappedFirst != firstLevel || mappedSecond != secondLevel) {
+                        return false;
+                    }
+                    previous = node;
+                    if (++listedFree > walkedFree) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return listedFree == walkedFree && listedFree == freeBlockCount;
+    }
+
+    void TlsfAllocator::MapInsert(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const {
+        uint64_t units = size / granularity;
+        if (units < SecondLevelCount) {
+            // 小さいサイズは線形に分割
+            firstLevel = 0;
+            secondLevel = static_cast<uint32_t>(units);
+            return;
+        }
+
+        uint32_t log2 = FloorLog2(units);
+        firstLevel = log2 - SecondLevelLog2 + 1;
+        secondLevel = static_cast<uint32_t>(units >> (log2 - SecondLevelLog2)) - SecondLevelCount;
+    }
+
+    void TlsfAllocator::MapSearch(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel) const {
+        // 次のクラスの先頭まで切り上げ、見つかったリストのどのブロックでも収まるようにする
+        uint64_t units = (size + granularity - 1) / granularity;
+        if (units >= SecondLevelCount) {
+            units += (1ull << (FloorLog2(units) - SecondLevelLog2)) - 1;
+        }
+        MapInsert(units * granularity, firstLevel, secondLevel);
+    }
+
+    uint32_t TlsfAllocator::FindFreeNode(uint64_t size) const {
+        uint32_t firstLevel = 0;
+        uint32_t secondLevel = 0;
+        MapSearch(size, firstLevel, secondLevel);
+        if (firstLevel >= FirstLevelCount) {
+            return InvalidNode;
+        }
+
+        uint32_t secondLevelMap = secondLevelBitmap[firstLevel] & (~0u << secondLevel);
+        if (secondLevelMap == 0) {
+            uint64_t firstLevelMap = (firstLevel + 1 < FirstLevelCount) ? firstLevelBitmap & (~0ull << (firstLevel + 1)) : 0;
+            if (firstLevelMap == 0) {
+                return InvalidNode;
+            }
+            firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+            secondLevelMap = secondLevelBitmap[firstLevel];
+        }
+
+        secondLevel = static_cast<uint32_t>(std::countr_zero(secondLevelMap));
+        return freeHeads[firstLevel][secondLevel];
+    }
+
+    void TlsfAllocator::InsertFree(uint32_t node) {
+        uint32_t firstLevel = 0;
+        uint32_t secondLevel = 0;
+        MapInsert(nodes[node].size, firstLevel, secondLevel);
+
+        uint32_t head = freeHeads[firstLevel][secondLevel];
+        nodes[node].isFree = true;
+        nodes[node].prevFree = InvalidNode;
+        nodes[node].nextFree = head;
+        if (head != InvalidNode) {
+            nodes[head].prevFree = node;
+        }
+        freeHeads[firstLevel][secondLevel] = node;
+
+        firstLevelBitmap |= 1ull << firstLevel;
+        secondLevelBitmap[firstLevel] |= 1u << secondLevel;
+        freeBlockCount++;
+    }
+
+    void TlsfAllocator::RemoveFree(uint32_t node) {
+        uint32_t firstLevel = 0;
+        uint32_t secondLevel = 0;
+        MapInsert(nodes[node].size, firstLevel, secondLevel);
+
+        uint32_t previous = nodes[node].prevFree;
+        uint32_t next = nodes[node].nextFree;
+        if (previous != InvalidNode) {
+            nodes[previous].nextFree = next;
+        }
+        else {
+            freeHeads[firstLevel][secondLevel] = next;
+            if (next == InvalidNode) {
+                secondLevelBitmap[firstLevel] &= ~(1u << secondLevel);
+                if (secondLevelBitmap[firstLevel] == 0) {
+                    firstLevelBitmap &= ~(1ull << firstLevel);
+                }
+            }
+        }
+        if (next != InvalidNode) {
+            nodes[next].prevFree = previous;
+        }
+
+        nodes[node].isFree = false;
+        nodes[node].prevFree = InvalidNode;
+        nodes[node].nextFree = InvalidNode;
+        freeBlockCount--;
+    }
+
+    uint32_t TlsfAllocator::CreateNode(uint64_t offset, uint64_t size) {
+        uint32_t index;
+        if (!unusedNodes.empty()) {
+            index = unusedNodes.back();
+            unusedNodes.pop_back();
+        }
+        else {
+            index = static_cast<uint32_t>(nodes.size());
+            nodes.emplace_back();
+        }
+
+        Node& node = nodes[index];
+        node = Node{};
+        node.offset = offset;
+        node.size = size;
+        node.isAlive = true;
+        return index;
+    }
+
+    void TlsfAllocator::DestroyNode(uint32_t node) {
+        nodes[node] = Node{};
+        unusedNodes.push_back(node);
+    }
+
+} // namespace Athena
\ No newline at end of file
@@ -10,36 +10,16 @@ namespace Athena {
         //Shutdown();
     }
 
-    void UploadContext::Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue) {
+    void UploadContext::Initialize(ID3D12Device* device, ID3D12CommandQueue* commandQueue,
+                                   uint64_t ringBufferSize) {
         this->device = device;
         this->commandQueue = commandQueue;
 
-        // R}hAP[^쐬
-        HRESULT hr = device->CreateCommandAllocator(
-            D3D12_COMMAND_LIST_TYPE_DIRECT,
-            IID_PPV_ARGS(&commandAllocator)
-        );
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create command allocator for upload context");
-        }
-
-        // R}hXg쐬
-        hr = device->CreateCommandList(
-            0,
-            D3D12_COMMAND_LIST_TYPE_DIRECT,
-            commandAllocator.Get(),
-            nullptr,
-            IID_PPV_ARGS(&commandList)
-        );
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create command list for upload context");
-        }
-
-        // Ԃ͕Ă
-        commandList->Close();
+        // R}hAP[^ER}hXg̓v[擾
+        commandListPool.Initialize(device, D3D12_COMMAND_LIST_TYPE_DIRECT);
 
         // tFX쐬
-        hr = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
+        HRESULT hr = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
         if (FAILED(hr)) {
             throw std::runtime_error("Failed to create fence for upload context");
         }
@@ -50,6 +30,9 @@ namespace Athena {
             throw std::runtime_error("Failed to create fence event for upload context");
         }
 
+        // Xe[WOpOobt@쐬
+        ringBuffer.Initialize(device, ringBufferSize);
+
         Logger::Info("UploadContext initialized");
     }
 
@@ -58,8 +41,8 @@ namespace Athena {
             return;  // ɉς
         }
 
-        // Abv[hobt@NA
-        uploadBuffers.clear();
+        // Oobt@iEnd()Ŋ҂ς݁j
+        ringBuffer.Shutdown();
 
         // Cxgnh
         if (fenceEvent) {
@@ -69,22 +52,35 @@ namespace Athena {
 
         // ComPtr̃\[X
         fence.Reset();
-        commandList.Reset();
-        commandAllocator.Reset();
+        commandListPool.Shutdown();
+        currentList = nullptr;
 
         commandQueue = nullptr;
         device = nullptr;
     }
 
     void UploadContext::Begin() {
-        // R}hAP[^Zbg
-        commandAllocator->Reset();
+        // Zbgς݂̃R}hXg擾iEnd() őҋ@ς݂̂ߒʏ͍ėpj
+        currentList = &commandListPool.Acquire(fence->GetCompletedValue());
+
+        // ς݃ob`̃Xe[WÖ
+        ringBuffer.ReleaseCompleted(fence->GetCompletedValue());
+    }
 
-        // R}hXgZbg
-        commandList->Reset(commandAllocator.Get(), nullptr);
+    UploadAllocation UploadContext::AllocateStaging(uint64_t size, uint64_t alignment) {
+        UploadAllocation allocation;
+        while (!ringBuffer.TryAllocate(size, alignment, allocation)) {
+            if (!ringBuffer.HasPendingBatches()) {
+                // L^̃ob`ŃO܂ꍇ͐pobt@g
+                return ringBuffer.AllocateDedicated(size);
+            }
 
-        // ÕAbv[hobt@NA
-        uploadBuffers.clear();
+            // łÂob`̊҂ė̈
+            uint64_t oldestFence = ringBuffer.GetOldestPendingFence();
+            WaitForFenceValue(oldestFence);
+            ringBuffer.ReleaseCompleted(fence->GetCompletedValue());
+        }
+        return allocation;
     }
 
     void UploadContext::UploadBuffer(
@@ -92,45 +88,14 @@ namespace Athena {
         const void* data,
         uint64_t dataSize) {
 
-        // Abv[hobt@쐬
-        D3D12_HEAP_PROPERTIES uploadHeapProps = {};
-        uploadHeapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-        D3D12_RESOURCE_DESC uploadBufferDesc = {};
-        uploadBufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        uploadBufferDesc.Width = dataSize;
-        uploadBufferDesc.Height = 1;
-        uploadBufferDesc.DepthOrArraySize = 1;
-        uploadBufferDesc.MipLevels = 1;
-        uploadBufferDesc.Format = DXGI_FORMAT_UNKNOWN;
-        uploadBufferDesc.SampleDesc.Count = 1;
-        uploadBufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-        ComPtr<ID3D12Resource> uploadBuffer;
-        HRESULT hr = device->CreateCommittedResource(
-            &uploadHeapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &uploadBufferDesc,
-            D3D12_RESOURCE_STATE_GENERIC_READ,
-            nullptr,
-            IID_PPV_ARGS(&uploadBuffer)
-        );
+        // Xe[WÖ蓖
+        UploadAllocation staging = AllocateStaging(dataSize, UploadRingBuffer::BufferAlignment);
 
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create upload buffer");
-        }
-
-        // f[^Abv[hobt@ɃRs[
-        void* mappedData = nullptr;
-        uploadBuffer->Map(0, nullptr, &mappedData);
-        memcpy(mappedData, data, dataSize);
-        uploadBuffer->Unmap(0, nullptr);
+        // f[^Xe[WÖɃRs[ii}bvς݁j
+        memcpy(staging.cpuAddress, data, dataSize);
 
         // GPUɃRs[
-        commandList->CopyBufferRegion(destinationResource, 0, uploadBuffer.Get(), 0, dataSize);
-
-        // Abv[hobt@ێiEnd()܂Łj
-        uploadBuffers.push_back(uploadBuffer);
+        currentList->commandList->CopyBufferRegion(destinationResource, 0, staging.resource, staging.offset, dataSize);
     }
 
     void UploadContext::UploadTexture(
@@ -158,37 +123,16 @@ namespace Athena {
             &uploadBufferSize
         );
 
-        // Abv[hobt@쐬
-        D3D12_HEAP_PROPERTIES uploadHeapProps = {};
-        uploadHeapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
-
-        D3D12_RESOURCE_DESC uploadBufferDesc = {};
-        uploadBufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
-        uploadBufferDesc.Width = uploadBufferSize;
-        uploadBufferDesc.Height = 1;
-        uploadBufferDesc.DepthOrArraySize = 1;
-        uploadBufferDesc.MipLevels = 1;
-        uploadBufferDesc.Format = DXGI_FORMAT_UNKNOWN;
-        uploadBufferDesc.SampleDesc.Count = 1;
-        uploadBufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
-
-        ComPtr<ID3D12Resource> uploadBuffer;
-        HRESULT hr = device->CreateCommittedResource(
-            &uploadHeapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &uploadBufferDesc,
-            D3D12_RESOURCE_STATE_GENERIC_READ,
-            nullptr,
-            IID_PPV_ARGS(&uploadBuffer)
-        );
+        // Xe[WÖ蓖āitbgvg512oCgEj
+        UploadAllocation staging = AllocateStaging(uploadBufferSize, UploadRingBuffer::TextureAlignment);
 
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create texture upload buffer");
+        // tbgvg̃ItZbgXe[WÖ̈ʒuɂ炷
+        for (auto& layout : layouts) {
+            layout.Offset += staging.offset;
         }
 
-        // f[^Abv[hobt@ɃRs[
-        uint8_t* mappedData = nullptr;
-        uploadBuffer->Map(0, nullptr, reinterpret_cast<void**>(&mappedData));
+        // f[^Xe[WÖɃRs[
+        uint8_t* mappedData = staging.cpuAddress - staging.offset;
 
         for (uint32_t i = 0; i < numSubresources; ++i) {
             const D3D12_SUBRESOURCE_DATA& srcData = subresourceData[i];
@@ -206,8 +150,6 @@ namespace Athena {
             }
         }
 
-        uploadBuffer->Unmap(0, nullptr);
-
         // GPUɃRs[
         for (uint32_t i = 0; i < numSubresources; ++i) {
             D3D12_TEXTURE_COPY_LOCATION destLocation = {};
@@ -216,15 +158,12 @@ namespace Athena {
             destLocation.SubresourceIndex = i;
 
             D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
-            srcLocation.pResource = uploadBuffer.Get();
+            srcLocation.pResource = staging.resource;
             srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
             srcLocation.PlacedFootprint = layouts[i];
 
-            commandList->CopyTextureRegion(&destLocation, 0, 0, 0, &srcLocation, nullptr);
+            currentList->commandList->CopyTextureRegion(&destLocation, 0, 0, 0, &srcLocation, nullptr);
         }
-
-        // Abv[hobt@ێiEnd()܂Łj
-        uploadBuffers.push_back(uploadBuffer);
     }
 
     void UploadContext::TransitionResource(
@@ -240,37 +179,36 @@ namespace Athena {
         barrier.Transition.StateAfter = stateAfter;
         barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
 
-        commandList->ResourceBarrier(1, &barrier);
+        currentList->commandList->ResourceBarrier(1, &barrier);
     }
 
     void UploadContext::End() {
         // R}hXg
-        commandList->Close();
+        currentList->commandList->Close();
 
         // R}hL[ɑM
-        ID3D12CommandList* cmdLists[] = { commandList.Get() };
+        ID3D12CommandList* cmdLists[] = { currentList->commandList.Get() };
         commandQueue->ExecuteCommandLists(1, cmdLists);
 
+        // Xe[WÖƃR}hXg̃ob`̃tFXlɕRt
+        ++fenceValue;
+        commandQueue->Signal(fence.Get(), fenceValue);
+        ringBuffer.FinishBatch(fenceValue);
+        commandListPool.Release(*currentList, fenceValue);
+        currentList = nullptr;
+
         // GPUҋ@
-        WaitForGPU();
+        WaitForFenceValue(fenceValue);
 
-        // Abv[hobt@NAi폜j
-        uploadBuffers.clear();
+        // Xe[WÖiOobt@͕̂ێj
+        ringBuffer.ReleaseCompleted(fenceValue);
     }
 
-    void UploadContext::WaitForGPU() {
-        ++fenceValue;
-        commandQueue->Signal(fence.Get(), fenceValue);
-
-        if (fence->GetCompletedValue() < fenceValue) {
-            fence->SetEventOnCompletion(fenceValue, fenceEvent);
+    void UploadContext::WaitForFenceValue(uint64_t value) {
+        if (fence->GetCompletedValue() < value) {
+            fence->SetEventOnCompletion(value, fenceEvent);
             WaitForSingleObject(fenceEvent, INFINITE);
         }
     }
 
-    void UploadContext::ResetCommandList() {
-        commandAllocator->Reset();
-        commandList->Reset(commandAllocator.Get(), nullptr);
-    }
-
 } // namespace Athena
\ No newline at end of file
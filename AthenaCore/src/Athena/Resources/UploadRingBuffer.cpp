@@ -0,0 +1,149 @@
+#include "Athena/Resources/UploadRingBuffer.h"
+#include "Athena/Utils/Logger.h"
+#include <stdexcept>
+
+namespace Athena {
+
+    UploadRingBuffer::~UploadRingBuffer() {
+        Shutdown();
+    }
+
+    void UploadRingBuffer::Initialize(ID3D12Device* device, uint64_t capacity) {
+        if (!device) {
+            throw std::invalid_argument("Device is null");
+        }
+
+        this->device = device;
+
+        // 容量はテクスチャのアライメント単位に切り上げる
+        capacity = (capacity + TextureAlignment - 1) & ~(TextureAlignment - 1);
+        allocator.Reset(capacity);
+
+        if (capacity > 0) {
+            ringResource = CreateUploadBuffer(capacity);
+
+            // 永続マップ（CPUからは読み込まない）
+            D3D12_RANGE readRange = { 0, 0 };
+            HRESULT hr = ringResource->Map(0, &readRange, reinterpret_cast<void**>(&mappedData));
+            if (FAILED(hr)) {
+                ringResource.Reset();
+                throw std::runtime_error("Failed to map upload ring buffer");
+            }
+        }
+
+        Logger::Info("UploadRingBuffer initialized: %llu bytes", static_cast<unsigned long long>(capacity));
+    }
+
+    void UploadRingBuffer::Shutdown() {
+        if (ringResource && mappedData) {
+            ringResource->Unmap(0, nullptr);
+        }
+        mappedData = nullptr;
+        ringResource.Reset();
+        currentDedicated.clear();
+        pendingDedicated.clear();
+        allocator.Reset(0);
+        device = nullptr;
+    }
+
+    bool UploadRingBuffer::TryAllocate(uint64_t size, uint64_t alignment, UploadAllocation& allocation) {
+        // 容量の半分を超えるアップロードはリングを占有しないよう専用バッファにする
+        if (!ringResource || size > allocator.GetCapacity() / 2) {
+            allocation = AllocateDedicated(size);
+            return true;
+        }
+
+        uint64_t offset = allocator.Allocate(size, alignment);
+        if (offset == RingBufferAllocator::InvalidOffset) {
+            return false;
+        }
+
+        allocation.resource = ringResource.Get();
+        allocation.offset = offset;
+        allocation.cpuAddress = mappedData + offset;
+        allocation.size = size;
+        allocation.isDedicated = false;
+        return true;
+    }
+
+    UploadAllocation UploadRingBuffer::AllocateDedicated(uint64_t size) {
+        ComPtr<ID3D12Resource> buffer = CreateUploadBuffer(size);
+
+        UploadAllocation allocation;
+        allocation.resource = buffer.Get();
+        allocation.offset = 0;
+        allocation.size = size;
+        allocation.isDedicated = true;
+
+        D3D12_RANGE readRange = { 0, 0 };
+        HRESULT hr = buffer->Map(0, &readRange, reinterpret_cast<void**>(&allocation.cpuAddress));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to map dedicated upload buffer");
+        }
+
+        // 書き込み後もマップしたまま保持し、解放時にリソースごと破棄する
+        currentDedicated.push_back(std::move(buffer));
+        dedicatedAllocationCount++;
+        return allocation;
+    }
+
+    void UploadRingBuffer::FinishBatch(uint64_t fenceValue) {
+        allocator.FinishBatch(fenceValue);
+
+        if (!currentDedicated.empty()) {
+            pendingDedicated.push_back({ fenceValue, std::move(currentDedicated) });
+            currentDedicated.clear();
+        }
+    }
+
+    void UploadRingBuffer::ReleaseCompleted(uint64_t completedFenceValue) {
+        allocator.ReleaseCompleted(completedFenceValue);
+
+        while (!pendingDedicated.empty() && pendingDedicated.front().fenceValue <= completedFenceValue) {
+            pendingDedicated.pop_front();
+        }
+    }
+
+    uint64_t UploadRingBuffer::GetOldestPendingFence() const {
+        uint64_t oldest = allocator.GetOldestPendingFence();
+        if (!pendingDedicated.empty() && (oldest == 0 || pendingDedicated.front().fenceValue < oldest)) {
+            oldest = pendingDedicated.front().fenceValue;
+        }
+        return oldest;
+    }
+
+    bool UploadRingBuffer::HasPendingBatches() const {
+        return allocator.HasPendingBatches() || !pendingDedicated.empty();
+    }
+
+    ComPtr<ID3D12Resource> UploadRingBuffer::CreateUploadBuffer(uint64_t size) {
+        D3D12_HEAP_PROPERTIES uploadHeapProps = {};
+        uploadHeapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+        D3D12_RESOURCE_DESC bufferDesc = {};
+        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        bufferDesc.Width = size > 0 ? size : 1;
+        bufferDesc.Height = 1;
+        bufferDesc.DepthOrArraySize = 1;
+        bufferDesc.MipLevels = 1;
+        bufferDesc.Format = DXGI_FORMAT_UNKNOWN;
+        bufferDesc.SampleDesc.Count = 1;
+        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+        ComPtr<ID3D12Resource> buffer;
+        HRESULT hr = device->CreateCommittedResource(
+            &uploadHeapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &bufferDesc,
+            D3D12_RESOURCE_STATE_GENERIC_READ,
+            nullptr,
+            IID_PPV_ARGS(&buffer)
+        );
+
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create upload buffer");
+        }
+        return buffer;
+    }
+
+} // namespace Athena
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include "Athena/Resources/UploadScheduler.h"
+#include "Athena/Utils/Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Athena {
+
+    UploadScheduler::~UploadScheduler() {
+        Shutdown();
+    }
+
+    void UploadScheduler::Initialize(ID3D12Device* device, ID3D12CommandQueue* graphicsQueue,
+                                     uint64_t ringBufferSize) {
+        if (!device || !graphicsQueue) {
+            throw std::invalid_argument("Device or graphics queue is null");
+        }
+
+        this->device = device;
+        this->graphicsQueue = graphicsQueue;
+
+        // 専用コピーキュー作成
+        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+        queueDesc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_NORMAL;
+        queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+        queueDesc.NodeMask = 0;
+
+        HRESULT hr = device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&copyQueue));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create copy queue for upload scheduler");
+        }
+
+        // フェンス作成（チケット = フェンス値）
+        hr = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence));
+        if (FAILED(hr)) {
+            throw std::runtime_error("Failed to create fence for upload scheduler");
+        }
+
+        fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+        if (!fenceEvent) {
+            throw std::runtime_error("Failed to create fence event for upload scheduler");
+        }
+
+        nextFenceValue = 1;
+        ringBuffer.Initialize(device, ringBufferSize);
+        commandListPool.Initialize(device, D3D12_COMMAND_LIST_TYPE_COPY);
+
+        Logger::Info("UploadScheduler initialized (copy queue)");
+    }
+
+    void UploadScheduler::Shutdown() {
+        if (!copyQueue) {
+            return;  // 既に解放済み
+        }
+
+        if (currentContext) {
+            Logger::Warning("UploadScheduler: shutting down with an unsubmitted batch");
+            currentContext->commandList->Close();
+            commandListPool.Release(*currentContext, 0);
+            currentContext = nullptr;
+        }
+
+        // 送信済みバッチの完了を待つ
+        WaitForFenceValue(nextFenceValue - 1);
+        ProcessCompletions();
+
+        ringBuffer.Shutdown();
+        commandListPool.Shutdown();
+        batchAcquires.clear();
+        submittedAcquires.clear();
+        callbacks.clear();
+
+        if (fenceEvent) {
+            CloseHandle(fenceEvent);
+            fenceEvent = nullptr;
+        }
+
+        fence.Reset();
+        copyQueue.Reset();
+        graphicsQueue.Reset();
+        device.Reset();
+    }
+
+    void UploadScheduler::BeginBatch() {
+        if (currentContext) {
+            Logger::Warning("UploadScheduler: BeginBatch() called twice without Submit()");
+            return;
+        }
+
+        // 完了済みバッチの領域を先に回収
+        ProcessCompletions();
+
+        currentContext = &commandListPool.Acquire(fence->GetCompletedValue());
+    }
+
+    UploadAllocation UploadScheduler::AllocateStaging(uint64_t size, uint64_t alignment) {
+        UploadAllocation allocation;
+        while (!ringBuffer.TryAllocate(size, alignment, allocation)) {
+            if (!ringBuffer.HasPendingBatches()) {
+                // 記録中のバッチだけでリングが埋まった場合は専用バッファを使う
+                return ringBuffer.AllocateDedicated(size);
+            }
+
+            // 最も古いバッチの完了を待って領域を回収
+            WaitForFenceValue(ringBuffer.GetOldestPendingFence());
+            ringBuffer.ReleaseCompleted(fence->GetCompletedValue());
+        }
+        return allocation;
+    }
+
+    void UploadScheduler::UploadBuffer(ID3D12Resource* destination, const void* data, uint64_t dataSize,
+                                       uint64_t destinationOffset, D3D12_RESOURCE_STATES finalState) {
+        if (!currentContext) {
+            throw std::runtime_error("UploadScheduler: BeginBatch() must be called before UploadBuffer()");
+        }
+        if (!destination || !data) {
+            throw std::invalid_argument("Upload destination or data is null");
+        }
+
+        UploadAllocation staging = AllocateStaging(dataSize, UploadRingBuffer::BufferAlignment);
+        memcpy(staging.cpuAddress, data, dataSize);
+
+        // バッファはCOMMONからCOPY_DESTへ暗黙的に昇格する
+        currentContext->commandList->CopyBufferRegion(
+            destination, destinationOffset, staging.resource, staging.offset, dataSize);
+
+        batchAcquires.push_back({ 0, destination, finalState });
+    }
+
+    void UploadScheduler::UploadTexture(ID3D12Resource* destination, const D3D12_SUBRESOURCE_DATA* subresourceData,
+                                        uint32_t numSubresources, D3D12_RESOURCE_STATES finalState,
+                                        uint32_t firstSubresource) {
+        if (!currentContext) {
+            throw std::runtime_error("UploadScheduler: BeginBatch() must be called before UploadTexture()");
+        }
+        if (!destination || !subresourceData || numSubresources == 0) {
+            throw std::invalid_argument("Invalid texture upload arguments");
+        }
+
+        D3D12_RESOURCE_DESC destDesc = destination->GetDesc();
+
+        std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(numSubresources);
+        std::vector<uint32_t> numRows(numSubresources);
+        std::vector<uint64_t> rowSizeInBytes(numSubresources);
+        uint64_t uploadSize = 0;
+
+        device->GetCopyableFootprints(
+            &destDesc,
+            firstSubresource,
+            numSubresources,
+            0,
+            layouts.data(),
+            numRows.data(),
+            rowSizeInBytes.data(),
+            &uploadSize
+        );
+
+        UploadAllocation staging = AllocateStaging(uploadSize, UploadRingBuffer::TextureAlignment);
+        uint8_t* stagingBase = staging.cpuAddress - staging.offset;
+
+        for (uint32_t i = 0; i < numSubresources; ++i) {
+            D3D12_PLACED_SUBRESOURCE_FOOTPRINT& layout = layouts[i];
+            layout.Offset += staging.offset;
+
+            const uint8_t* srcSlice = reinterpret_cast<const uint8_t*>(subresourceData[i].pData);
+            uint8_t* destSlice = stagingBase + layout.Offset;
+            for (uint32_t row = 0; row < numRows[i]; ++row) {
+                memcpy(
+                    destSlice + row * layout.Footprint.RowPitch,
+                    srcSlice + row * subresourceData[i].RowPitch,
+                    rowSizeInBytes[i]
+                );
+            }
+
+            D3D12_TEXTURE_COPY_LOCATION destLocation = {};
+            destLocation.pResource = destination;
+            destLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+            destLocation.SubresourceIndex = firstSubresource + i;
+
+            D3D12_TEXTURE_COPY_LOCATION srcLocation = {};
+            srcLocation.pResource = staging.resource;
+            srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+            srcLocation.PlacedFootprint = layout;
+
+            currentContext->commandList->CopyTextureRegion(&destLocation, 0, 0, 0, &srcLocation, nullptr);
+        }
+
+        batchAcquires.push_back({ 0, destination, finalState });
+    }
+
+    UploadTicket UploadScheduler::Submit() {
+        if (!currentContext) {
+            Logger::Warning("UploadScheduler: Submit() called without BeginBatch()");
+            return UploadTicket{};
+        }
+
+        PooledCommandList& context = *currentContext;
+        currentContext = nullptr;
+        context.commandList->Close();
+
+        if (batchAcquires.empty()) {
+            commandListPool.Release(context, 0);
+            return UploadTicket{};  // 記録なし（コマンドリストは次回再利用）
+        }
+
+        ID3D12CommandList* cmdLists[] = { context.commandList.Get() };
+        copyQueue->ExecuteCommandLists(1, cmdLists);
+
+        UploadTicket ticket;
+        ticket.fenceValue = nextFenceValue++;
+        copyQueue->Signal(fence.Get(), ticket.fenceValue);
+
+        commandListPool.Release(context, ticket.fenceValue);
+        ringBuffer.FinishBatch(ticket.fenceValue);
+
+        for (auto& acquire : batchAcquires) {
+            acquire.fenceValue = ticket.fenceValue;
+            submittedAcquires.push_back(std::move(acquire));
+        }
+        batchAcquires.clear();
+
+        return ticket;
+    }
+
+    bool UploadScheduler::IsComplete(const UploadTicket& ticket) const {
+        return !ticket.IsValid() || GetCompletedFenceValue() >= ticket.fenceValue;
+    }
+
+    void UploadScheduler::Wait(const UploadTicket& ticket) {
+        if (!ticket.IsValid()) return;
+        WaitForFenceValue(ticket.fenceValue);
+    }
+
+    void UploadScheduler::OnComplete(const UploadTicket& ticket, std::function<void()> callback) {
+        if (!callback) return;
+        callbacks.push_back({ ticket.fenceValue, std::move(callback) });
+    }
+
+    void UploadScheduler::ProcessCompletions() {
+        if (!fence) return;
+
+        uint64_t completed = fence->GetCompletedValue();
+        ringBuffer.ReleaseCompleted(completed);
+
+        // 完了したコールバックを実行（コールバック内での OnComplete() 追加に備えて分離）
+        std::vector<PendingCallback> ready;
+        auto split = std::stable_partition(callbacks.begin(), callbacks.end(),
+            [completed](const PendingCallback& pending) { return pending.fenceValue > completed; });
+        std::move(split, callbacks.end(), std::back_inserter(ready));
+        callbacks.erase(split, callbacks.end());
+
+        for (auto& pending : ready) {
+            pending.callback();
+        }
+    }
+
+    uint32_t UploadScheduler::AcquireUploads(ID3D12GraphicsCommandList* commandList) {
+        if (submittedAcquires.empty()) {
+            return 0;
+        }
+
+        // 同じリソースへの複数のアップロードは、最後の最終状態への1回の遷移にまとめる
+        // （コピーキューでの実行が終わるたびに COMMON へ減衰するため、遷移前は常に COMMON）
+        std::vector<D3D12_RESOURCE_BARRIER> barriers;
+        std::unordered_map<ID3D12Resource*, size_t> barrierIndices;
+        barriers.reserve(submittedAcquires.size());
+        uint64_t lastFence = 0;
+        for (const auto& acquire : submittedAcquires) {
+            lastFence = std::max(lastFence, acquire.fenceValue);
+
+            auto found = barrierIndices.find(acquire.resource.Get());
+            if (found != barrierIndices.end()) {
+                barriers[found->second].Transition.StateAfter = acquire.finalState;
+                continue;
+            }
+
+            D3D12_RESOURCE_BARRIER barrier = {};
+            barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            barrier.Transition.pResource = acquire.resource.Get();
+            barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COMMON;
+            barrier.Transition.StateAfter = acquire.finalState;
+            barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            barrierIndices.emplace(acquire.resource.Get(), barriers.size());
+            barriers.push_back(barrier);
+        }
+        barriers.erase(std::remove_if(barriers.begin(), barriers.end(),
+            [](const D3D12_RESOURCE_BARRIER& barrier) {
+                return barrier.Transition.StateAfter == D3D12_RESOURCE_STATE_COMMON;
+            }), barriers.end());
+
+        // テクスチャは暗黙の昇格がないため、遷移を記録できない場合は移行せずに失敗させる
+        if (!barriers.empty() && !commandList) {
+            throw std::invalid_argument("UploadScheduler: AcquireUploads() needs a command list for non-COMMON final states");
+        }
+
+        // グラフィックスキューにコピー完了をGPU上で待機させる
+        graphicsQueue->Wait(fence.Get(), lastFence);
+        if (!barriers.empty()) {
+            commandList->ResourceBarrier(static_cast<UINT>(barriers.size()), barriers.data());
+        }
+
+        uint32_t acquiredCount = static_cast<uint32_t>(submittedAcquires.size());
+        submittedAcquires.clear();
+        return acquiredCount;
+    }
+
+    void UploadScheduler::WaitOnQueue(const UploadTicket& ticket, ID3D12CommandQueue* queue) const {
+        if (!ticket.IsValid() || !queue) return;
+        queue->Wait(fence.Get(), ticket.fenceValue);
+    }
+
+    uint64_t UploadScheduler::GetCompletedFenceValue() const {
+        return fence ? fence->GetCompletedValue() : 0;
+    }
+
+    void UploadScheduler::WaitForFenceValue(uint64_t value) {
+        if (value == 0 || fence->GetCompletedValue() >= value) {
+            return;
+        }
+        fence->SetEventOnCompletion(value, fenceEvent);
+        WaitForSingleObject(fenceEvent, INFINITE);
+    }
+
+} // namespace Athena
\ No newline at end of file
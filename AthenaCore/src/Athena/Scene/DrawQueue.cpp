@@ -0,0 +1,161 @@
+#include "Athena/Scene/DrawQueue.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace Athena {
+
+    namespace {
+        constexpr uint64_t FieldMask(uint32_t bits) {
+            return (uint64_t(1) << bits) - 1;
+        }
+    }
+
+    uint32_t DrawQueue::QuantizeDepth(float viewDepth) {
+        // NaN もここで 0 になる
+        if (!(viewDepth > 0.0f)) {
+            return 0;
+        }
+        uint32_t bits;
+        std::memcpy(&bits, &viewDepth, sizeof(bits));
+        return bits >> (32 - DepthBits - 1);   // 符号ビットは常に 0
+    }
+
+    uint64_t DrawQueue::MakeOpaqueKey(uint32_t pipelineId, uint32_t materialId, uint32_t meshId, uint32_t depth) {
+        uint64_t coarseDepth = (depth & FieldMask(DepthBits)) >> (DepthBits - OpaqueDepthBits);
+        return ((pipelineId & FieldMask(PipelineBits)) << (MaterialBits + OpaqueMeshBits + OpaqueDepthBits)) |
+               ((materialId & FieldMask(MaterialBits)) << (OpaqueMeshBits + OpaqueDepthBits)) |
+               ((meshId & FieldMask(OpaqueMeshBits)) << OpaqueDepthBits) |
+               coarseDepth;
+    }
+
+    uint64_t DrawQueue::MakeTransparentKey(uint32_t pipelineId, uint32_t materialId, uint32_t meshId, uint32_t depth) {
+        uint64_t farFirst = FieldMask(DepthBits) - (depth & FieldMask(DepthBits));
+        return (farFirst << (PipelineBits + MaterialBits + TransparentMeshBits)) |
+               ((pipelineId & FieldMask(PipelineBits)) << (MaterialBits + TransparentMeshBits)) |
+               ((materialId & FieldMask(MaterialBits)) << TransparentMeshBits) |
+               (meshId & FieldMask(TransparentMeshBits));
+    }
+
+    void DrawQueue::Sort() {
+        uint32_t count = Size();
+        if (count < 2) {
+            return;
+        }
+
+        // 全要素で同じ値のビットは順序に関係しないので桁から除く
+        uint64_t firstKey = items[0].key;
+        uint64_t varyingBits = 0;
+        for (const Item& item : items) {
+            varyingBits |= item.key ^ firstKey;
+        }
+        if (varyingBits == 0) {
+            return;
+        }
+
+        // 変化するビットの連続した区間を下位から集める
+        struct BitRun {
+            uint32_t start;
+            uint32_t length;
+        };
+        BitRun runs[64];
+        uint32_t runCount = 0;
+        for (uint32_t bit = 0; bit < 64;) {
+            if (!((varyingBits >> bit) & 1)) {
+                ++bit;
+                continue;
+            }
+            uint32_t runStart = bit;
+            while (bit < 64 && ((varyingBits >> bit) & 1)) {
+                ++bit;
+            }
+            runs[runCount++] = { runStart, bit - runStart };
+        }
+
+        // 区間が多いと桁の取り出しが遅くなるため、短い隙間から埋めて MaxBitRuns 個以下にする
+        while (runCount > MaxBitRuns) {
+            uint32_t merged = 0;
+            uint32_t shortestGap = UINT32_MAX;
+            for (uint32_t i = 0; i + 1 < runCount; ++i) {
+                uint32_t gap = runs[i + 1].start - (runs[i].start + runs[i].length);
+                if (gap < shortestGap) {
+                    shortestGap = gap;
+                    merged = i;
+                }
+            }
+            runs[merged].length = runs[merged + 1].start + runs[merged + 1].length - runs[merged].start;
+            for (uint32_t i = merged + 1; i + 1 < runCount; ++i) {
+                runs[i] = runs[i + 1];
+            }
+            --runCount;
+        }
+
+        // 区間をつないだビット列をパス数が最小になる均等な幅で切り分ける
+        uint32_t totalBits = 0;
+        for (uint32_t i = 0; i < runCount; ++i) {
+            totalBits += runs[i].length;
+        }
+        uint32_t passCount = (totalBits + MaxRadixBits - 1) / MaxRadixBits;
+        uint32_t radixBits = (totalBits + passCount - 1) / passCount;
+        uint32_t radixSize = 1u << radixBits;
+
+        DigitLayout layouts[MaxPassCount];
+        uint32_t pass = 0;
+        uint32_t filled = 0;
+        for (uint32_t i = 0; i < runCount; ++i) {
+            uint32_t consumed = 0;
+            while (consumed < runs[i].length) {
+                uint32_t taken = (std::min)(runs[i].length - consumed, radixBits - filled);
+                layouts[pass].parts[layouts[pass].partCount++] = { runs[i].start + consumed, taken, filled };
+                consumed += taken;
+                filled += taken;
+                if (filled == radixBits) {
+                    ++pass;
+                    filled = 0;
+                }
+            }
+        }
+
+        // 最初のパスの度数だけ先に数え、以降のパスの度数は1つ前のパスで要素を移すときに数える
+        histograms.assign(static_cast<size_t>(passCount) * radixSize, 0);
+        for (const Item& item : items) {
+            histograms[ExtractDigit(item.key, layouts[0])]++;
+        }
+
+        scratch.resize(count);
+        Item* source = items.data();
+        Item* destination = scratch.data();
+        for (uint32_t p = 0; p < passCount; ++p) {
+            // 度数を書き込み開始位置に変える
+            uint32_t* offsets = histograms.data() + p * radixSize;
+            uint32_t total = 0;
+            for (uint32_t digit = 0; digit < radixSize; ++digit) {
+                uint32_t digitCount = offsets[digit];
+                offsets[digit] = total;
+                total += digitCount;
+            }
+
+            const DigitLayout& layout = layouts[p];
+            if (p + 1 < passCount) {
+                uint32_t* nextCounts = offsets + radixSize;
+                const DigitLayout& nextLayout = layouts[p + 1];
+                for (uint32_t i = 0; i < count; ++i) {
+                    uint64_t key = source[i].key;
+                    destination[offsets[ExtractDigit(key, layout)]++] = source[i];
+                    nextCounts[ExtractDigit(key, nextLayout)]++;
+                }
+            } else {
+                for (uint32_t i = 0; i < count; ++i) {
+                    destination[offsets[ExtractDigit(source[i].key, layout)]++] = source[i];
+                }
+            }
+            std::swap(source, destination);
+        }
+
+        // パスが奇数回の場合、結果は作業領域の側にある
+        if (source != items.data()) {
+            items.swap(scratch);
+        }
+    }
+
+} // namespace Athena
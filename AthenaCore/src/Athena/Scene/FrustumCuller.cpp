@@ -0,0 +1,344 @@
+#include "Athena/Scene/FrustumCuller.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ATHENA_CULLING_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define ATHENA_CULLING_NEON
+#include <arm_neon.h>
+#endif
+
+// MSVC は /arch の指定なしで AVX 命令を生成できる。GCC / Clang は関数単位で有効にする
+#if defined(ATHENA_CULLING_X86) && !defined(_MSC_VER)
+#define ATHENA_TARGET_AVX __attribute__((target("avx")))
+#else
+#define ATHENA_TARGET_AVX
+#endif
+
+namespace Athena {
+
+    namespace {
+
+        /**
+         * @brief 1平面ぶんの判定に使う値
+         *
+         * 距離はどのカーネルでも x, y, z, d の順に足し、スカラー版と結果を揃える。
+         * 法線の各成分が正なら max、負なら min の配列を読む（p-vertex）。
+         * p-vertex が平面の外側にあれば AABB 全体が外側にある。
+         */
+        struct PlaneInput {
+            const float* x;
+            const float* y;
+            const float* z;
+            float nx, ny, nz, d;
+        };
+
+        struct PlaneInputs {
+            PlaneInput planes[6];
+        };
+
+        /**
+         * @brief 交差したレーンのインデックスを昇順に書き出す（範囲の外のレーンは除く）
+         *
+         * マスクは毎回ばらばらで分岐予測が効かないため、全レーンを書いて個数だけ進める。
+         * 書き込み位置は常にそのレーンの範囲内の位置以下なので、領域は範囲の要素数ぶんで足りる。
+         */
+        template<uint32_t LaneCount>
+        inline uint32_t WriteLanes(uint32_t mask, uint32_t base, uint32_t end,
+                                   uint32_t* outIndices, uint32_t written) {
+            if (end - base >= LaneCount) {
+                // 定数回のループにしてコンパイラに展開させる
+                for (uint32_t lane = 0; lane < LaneCount; ++lane) {
+                    outIndices[written] = base + lane;
+                    written += (mask >> lane) & 1;
+                }
+            } else {
+                for (uint32_t lane = 0; lane < end - base; ++lane) {
+                    outIndices[written] = base + lane;
+                    written += (mask >> lane) & 1;
+                }
+            }
+            return written;
+        }
+
+        uint32_t CullScalar(const PlaneInputs& inputs, uint32_t begin, uint32_t end, uint32_t* outIndices) {
+            uint32_t written = 0;
+            for (uint32_t i = begin; i < end; ++i) {
+                bool inside = true;
+                for (const PlaneInput& plane : inputs.planes) {
+                    float distance = plane.nx * plane.x[i] + plane.ny * plane.y[i] + plane.nz * plane.z[i] + plane.d;
+                    if (distance < 0.0f) {
+                        inside = false;
+                        break;
+                    }
+                }
+                if (inside) {
+                    outIndices[written++] = i;
+                }
+            }
+            return written;
+        }
+
+#if defined(ATHENA_CULLING_X86)
+        uint32_t CullSSE(const PlaneInputs& inputs, uint32_t begin, uint32_t end, uint32_t* outIndices) {
+            const __m128 zero = _mm_setzero_ps();
+            __m128 normalX[6], normalY[6], normalZ[6], distance[6];
+            for (int p = 0; p < 6; ++p) {
+                normalX[p] = _mm_set1_ps(inputs.planes[p].nx);
+                normalY[p] = _mm_set1_ps(inputs.planes[p].ny);
+                normalZ[p] = _mm_set1_ps(inputs.planes[p].nz);
+                distance[p] = _mm_set1_ps(inputs.planes[p].d);
+            }
+
+            uint32_t written = 0;
+            for (uint32_t i = begin; i < end; i += 4) {
+                __m128 inside = _mm_cmpeq_ps(zero, zero);
+                for (int p = 0; p < 6; ++p) {
+                    const PlaneInput& plane = inputs.planes[p];
+                    __m128 d = _mm_mul_ps(normalX[p], _mm_loadu_ps(plane.x + i));
+                    d = _mm_add_ps(d, _mm_mul_ps(normalY[p], _mm_loadu_ps(plane.y + i)));
+                    d = _mm_add_ps(d, _mm_mul_ps(normalZ[p], _mm_loadu_ps(plane.z + i)));
+                    d = _mm_add_ps(d, distance[p]);
+                    inside = _mm_and_ps(inside, _mm_cmpge_ps(d, zero));
+                }
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(inside));
+                written = WriteLanes<4>(mask, i, end, outIndices, written);
+            }
+            return written;
+        }
+
+        ATHENA_TARGET_AVX
+        uint32_t CullAVX(const PlaneInputs& inputs, uint32_t begin, uint32_t end, uint32_t* outIndices) {
+            const __m256 zero = _mm256_setzero_ps();
+            __m256 normalX[6], normalY[6], normalZ[6], distance[6];
+            for (int p = 0; p < 6; ++p) {
+                normalX[p] = _mm256_set1_ps(inputs.planes[p].nx);
+                normalY[p] = _mm256_set1_ps(inputs.planes[p].ny);
+                normalZ[p] = _mm256_set1_ps(inputs.planes[p].nz);
+                distance[p] = _mm256_set1_ps(inputs.planes[p].d);
+            }
+
+            uint32_t written = 0;
+            for (uint32_t i = begin; i < end; i += 8) {
+                __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+                for (int p = 0; p < 6; ++p) {
+                    const PlaneInput& plane = inputs.planes[p];
+                    __m256 d = _mm256_mul_ps(normalX[p], _mm256_loadu_ps(plane.x + i));
+                    d = _mm256_add_ps(d, _mm256_mul_ps(normalY[p], _mm256_loadu_ps(plane.y + i)));
+                    d = _mm256_add_ps(d, _mm256_mul_ps(normalZ[p], _mm256_loadu_ps(plane.z + i)));
+                    d = _mm256_add_ps(d, distance[p]);
+                    inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, zero, _CMP_GE_OQ));
+                }
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(inside));
+                written = WriteLanes<8>(mask, i, end, outIndices, written);
+            }
+            return written;
+        }
+
+        bool DetectAVX() {
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            // OS が YMM レジスタを退避するか
+            return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+            return __builtin_cpu_supports("avx");
+#endif
+        }
+#endif
+
+#if defined(ATHENA_CULLING_NEON)
+        uint32_t CullNEON(const PlaneInputs& inputs, uint32_t begin, uint32_t end, uint32_t* outIndices) {
+            const float32x4_t zero = vdupq_n_f32(0.0f);
+            static const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+            const uint32x4_t bits = vld1q_u32(laneBits);
+
+            uint32_t written = 0;
+            for (uint32_t i = begin; i < end; i += 4) {
+                uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+                for (const PlaneInput& plane : inputs.planes) {
+                    float32x4_t d = vmulq_n_f32(vld1q_f32(plane.x + i), plane.nx);
+                    d = vaddq_f32(d, vmulq_n_f32(vld1q_f32(plane.y + i), plane.ny));
+                    d = vaddq_f32(d, vmulq_n_f32(vld1q_f32(plane.z + i), plane.nz));
+                    d = vaddq_f32(d, vdupq_n_f32(plane.d));
+                    inside = vandq_u32(inside, vcgeq_f32(d, zero));
+                }
+                uint32_t mask = vaddvq_u32(vandq_u32(inside, bits));
+                written = WriteLanes<4>(mask, i, end, outIndices, written);
+            }
+            return written;
+        }
+#endif
+
+    } // namespace
+
+    void FrustumCuller::Assign(const Vector3* boundsMin, const Vector3* boundsMax, uint32_t count) {
+        this->count = count;
+
+        // 末尾のブロックもそのまま読めるように詰め物をする（判定結果はマスクで捨てる）
+        size_t paddedCount = (static_cast<size_t>(count) + LaneCount - 1) / LaneCount * LaneCount;
+        for (std::vector<float>* axis : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ }) {
+            axis->resize(paddedCount);
+            std::fill(axis->begin() + count, axis->end(), 0.0f);
+        }
+        float* outMinX = minX.data();
+        float* outMinY = minY.data();
+        float* outMinZ = minZ.data();
+        float* outMaxX = maxX.data();
+        float* outMaxY = maxY.data();
+        float* outMaxZ = maxZ.data();
+        for (uint32_t i = 0; i < count; ++i) {
+            outMinX[i] = boundsMin[i].x;
+            outMinY[i] = boundsMin[i].y;
+            outMinZ[i] = boundsMin[i].z;
+            outMaxX[i] = boundsMax[i].x;
+            outMaxY[i] = boundsMax[i].y;
+            outMaxZ[i] = boundsMax[i].z;
+        }
+    }
+
+    void FrustumCuller::Clear() {
+        minX.clear();
+        minY.clear();
+        minZ.clear();
+        maxX.clear();
+        maxY.clear();
+        maxZ.clear();
+        count = 0;
+    }
+
+    uint32_t FrustumCuller::Cull(const Vector4 planes[6], uint32_t* outIndices) const {
+        return Cull(planes, outIndices, GetBestKernel());
+    }
+
+    uint32_t FrustumCuller::Cull(const Vector4 planes[6], uint32_t* outIndices, Kernel kernel) const {
+        return CullRange(planes, 0, count, outIndices, kernel);
+    }
+
+    uint32_t FrustumCuller::CullRange(const Vector4 planes[6], uint32_t begin, uint32_t end,
+                                      uint32_t* outIndices, Kernel kernel) const {
+        if (!IsKernelSupported(kernel)) {
+            throw std::invalid_argument(std::string("Culling kernel is not supported: ") + GetKernelName(kernel));
+        }
+        if (begin % LaneCount != 0 || begin > end || end > count) {
+            throw std::out_of_range("Culling range must start at a multiple of LaneCount and lie within the elements");
+        }
+        if (begin == end) {
+            return 0;
+        }
+
+        PlaneInputs inputs;
+        for (int p = 0; p < 6; ++p) {
+            const Vector4& plane = planes[p];
+            inputs.planes[p] = {
+                plane.x >= 0.0f ? maxX.data() : minX.data(),
+                plane.y >= 0.0f ? maxY.data() : minY.data(),
+                plane.z >= 0.0f ? maxZ.data() : minZ.data(),
+                plane.x, plane.y, plane.z, plane.w,
+            };
+        }
+
+        switch (kernel) {
+#if defined(ATHENA_CULLING_X86)
+        case Kernel::SSE:
+            return CullSSE(inputs, begin, end, outIndices);
+        case Kernel::AVX:
+            return CullAVX(inputs, begin, end, outIndices);
+#endif
+#if defined(ATHENA_CULLING_NEON)
+        case Kernel::NEON:
+            return CullNEON(inputs, begin, end, outIndices);
+#endif
+        default:
+            return CullScalar(inputs, begin, end, outIndices);
+        }
+    }
+
+    FrustumCuller::Kernel FrustumCuller::GetBestKernel() {
+#if defined(ATHENA_CULLING_X86)
+        static const Kernel best = DetectAVX() ? Kernel::AVX : Kernel::SSE;
+        return best;
+#elif defined(ATHENA_CULLING_NEON)
+        return Kernel::NEON;
+#else
+        return Kernel::Scalar;
+#endif
+    }
+
+    bool FrustumCuller::IsKernelSupported(Kernel kernel) {
+        switch (kernel) {
+        case Kernel::Scalar:
+            return true;
+#if defined(ATHENA_CULLING_X86)
+        case Kernel::SSE:
+            return true;
+        case Kernel::AVX:
+            return GetBestKernel() == Kernel::AVX;
+#endif
+#if defined(ATHENA_CULLING_NEON)
+        case Kernel::NEON:
+            return true;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    const char* FrustumCuller::GetKernelName(Kernel kernel) {
+        switch (kernel) {
+        case Kernel::Scalar: return "Scalar";
+        case Kernel::SSE: return "SSE";
+        case Kernel::AVX: return "AVX";
+        case Kernel::NEON: return "NEON";
+        }
+        return "Unknown";
+    }
+
+    void FrustumCuller::ExtractPlanes(const Matrix4x4& viewProjection, Vector4 outPlanes[6]) {
+        // 行ベクトルなのでクリップ座標の各成分は列との内積。D3D の深度範囲は 0 <= z <= w
+        const auto& m = viewProjection.m;
+        for (int i = 0; i < 6; ++i) {
+            int axis = i / 2;
+            float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+            Vector4 plane;
+            if (i == 4) {
+                plane = Vector4(m[0][2], m[1][2], m[2][2], m[3][2]);
+            } else {
+                plane = Vector4(m[0][3] + sign * m[0][axis],
+                                m[1][3] + sign * m[1][axis],
+                                m[2][3] + sign * m[2][axis],
+                                m[3][3] + sign * m[3][axis]);
+            }
+
+            float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f) {
+                plane = Vector4(plane.x / length, plane.y / length, plane.z / length, plane.w / length);
+            }
+            outPlanes[i] = plane;
+        }
+    }
+
+    bool FrustumCuller::Intersects(const Vector4 planes[6], const Vector3& boundsMin, const Vector3& boundsMax) {
+        for (int p = 0; p < 6; ++p) {
+            const Vector4& plane = planes[p];
+            float distance = plane.x * (plane.x >= 0.0f ? boundsMax.x : boundsMin.x)
+                           + plane.y * (plane.y >= 0.0f ? boundsMax.y : boundsMin.y)
+                           + plane.z * (plane.z >= 0.0f ? boundsMax.z : boundsMin.z)
+                           + plane.w;
+            if (distance < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace Athena
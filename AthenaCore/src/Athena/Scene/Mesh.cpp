@@ -30,7 +30,7 @@ namespace Athena {
         Logger::Info("Mesh: Set %u indices (%u triangles)", indexCount, indexCount / 3);
     }
 
-    void Mesh::UploadToGPU(ID3D12Device* device) {
+    void Mesh::UploadToGPU(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator) {
         if (vertices.empty() || indices.empty()) {
             Logger::Warning("Mesh: Cannot upload empty mesh to GPU");
             return;
@@ -42,7 +42,8 @@ namespace Athena {
             device,
             static_cast<uint32_t>(vertices.size() * sizeof(StandardVertex)),
             BufferType::Vertex,
-            D3D12_HEAP_TYPE_UPLOAD
+            D3D12_HEAP_TYPE_UPLOAD,
+            memoryAllocator
         );
         vertexBuffer->Upload(vertices.data(), static_cast<uint32_t>(vertices.size() * sizeof(StandardVertex)));
 
@@ -52,7 +53,8 @@ namespace Athena {
             device,
             static_cast<uint32_t>(indices.size() * sizeof(uint32_t)),
             BufferType::Index,
-            D3D12_HEAP_TYPE_UPLOAD
+            D3D12_HEAP_TYPE_UPLOAD,
+            memoryAllocator
         );
         indexBuffer->Upload(indices.data(), static_cast<uint32_t>(indices.size() * sizeof(uint32_t)));
 
@@ -80,6 +82,10 @@ namespace Athena {
         D3D12_INDEX_BUFFER_VIEW ibv = indexBuffer->GetIndexBufferView();
         commandList->IASetIndexBuffer(&ibv);
 
+        // 退避中なら描画前に復帰させる
+        vertexBuffer->MarkUsed();
+        indexBuffer->MarkUsed();
+
         // プリミティブトポロジー設定
         commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
@@ -215,7 +221,7 @@ namespace Athena {
         Logger::Info("Mesh::SetIndexData - {} indices, {} bytes total", indexCount, dataSize);
     }
     
-    void Mesh::CreateBuffers(ID3D12Device* device) {
+    void Mesh::CreateBuffers(ID3D12Device* device, GpuMemoryAllocator* memoryAllocator) {
         Logger::Info("Mesh::CreateBuffers - vertex data: {} bytes, index data: {} bytes", 
                     rawVertexData.size(), rawIndexData.size());
         
@@ -230,7 +236,8 @@ namespace Athena {
             device,
             static_cast<uint32_t>(rawVertexData.size()),
             BufferType::Vertex,
-            D3D12_HEAP_TYPE_UPLOAD
+            D3D12_HEAP_TYPE_UPLOAD,
+            memoryAllocator
         );
         vertexBuffer->Upload(rawVertexData.data(), static_cast<uint32_t>(rawVertexData.size()));
         
@@ -240,7 +247,8 @@ namespace Athena {
             device,
             static_cast<uint32_t>(rawIndexData.size()),
             BufferType::Index,
-            D3D12_HEAP_TYPE_UPLOAD
+            D3D12_HEAP_TYPE_UPLOAD,
+            memoryAllocator
         );
         indexBuffer->Upload(rawIndexData.data(), static_cast<uint32_t>(rawIndexData.size()));
         
@@ -83,7 +83,7 @@ std::shared_ptr<Model> ModelLoader::LoadModel(
     }
     
     // Process node hierarchy to extract mesh data
-    ProcessNode(scene, scene->mRootNode, model.get(), device, model->directory);
+    ProcessNode(scene, scene->mRootNode, ModelNode::InvalidParent, model.get(), device, model->directory);
     
     // Calculate basic bounds
     model->CalculateBounds();
@@ -96,22 +96,35 @@ std::shared_ptr<Model> ModelLoader::LoadModel(
 void ModelLoader::ProcessNode(
     const aiScene* scene,
     aiNode* node,
+    uint32_t parentNode,
     Model* model,
     std::shared_ptr<Device> device,
     const std::string& directory) {
     
+    // aiMatrix4x4 も列ベクトル（平行移動は a4, b4, c4）なので行ごとにそのまま写す
+    uint32_t nodeIndex = static_cast<uint32_t>(model->nodes.size());
+    ModelNode& modelNode = model->nodes.emplace_back();
+    modelNode.name = node->mName.C_Str();
+    modelNode.parent = parentNode;
+    for (unsigned int row = 0; row < 4; ++row) {
+        for (unsigned int column = 0; column < 4; ++column) {
+            modelNode.localMatrix.m[row][column] = static_cast<float>(node->mTransformation[row][column]);
+        }
+    }
+    
     // Process all meshes in this node
     for (uint32_t i = 0; i < node->mNumMeshes; ++i) {
         aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
         auto processedMesh = ProcessMesh(scene, mesh, mesh->mMaterialIndex, device);
         if (processedMesh) {
+            model->nodes[nodeIndex].meshes.push_back(static_cast<uint32_t>(model->meshes.size()));
             model->meshes.push_back(processedMesh);
         }
     }
     
     // Process children recursively
     for (uint32_t i = 0; i < node->mNumChildren; ++i) {
-        ProcessNode(scene, node->mChildren[i], model, device, directory);
+        ProcessNode(scene, node->mChildren[i], nodeIndex, model, device, directory);
     }
 }
 
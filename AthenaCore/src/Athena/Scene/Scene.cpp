@@ -1,104 +1,892 @@
 #include "Athena/Scene/Scene.h"
 #include "Athena/Scene/ModelLoader.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Core/JobSystem.h"
+#include "Athena/Utils/Hash.h"
 #include "Athena/Utils/Logger.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <float.h>
+#include <stdexcept>
 
 namespace Athena {
 
+    namespace {
+        bool SameMaterial(const MaterialData& a, const MaterialData& b) {
+            return a.albedo.x == b.albedo.x && a.albedo.y == b.albedo.y && a.albedo.z == b.albedo.z &&
+                   a.metallic == b.metallic && a.roughness == b.roughness && a.ao == b.ao &&
+                   a.name == b.name &&
+                   a.albedoTexturePath == b.albedoTexturePath &&
+                   a.normalTexturePath == b.normalTexturePath &&
+                   a.metallicTexturePath == b.metallicTexturePath &&
+                   a.roughnessTexturePath == b.roughnessTexturePath &&
+                   a.aoTexturePath == b.aoTexturePath &&
+                   a.albedoTexture == b.albedoTexture &&
+                   a.normalTexture == b.normalTexture &&
+                   a.metallicTexture == b.metallicTexture &&
+                   a.roughnessTexture == b.roughnessTexture &&
+                   a.aoTexture == b.aoTexture;
+        }
+
+        /**
+         * @brief SameMaterial() で等しいマテリアルが同じ値になるハッシュ
+         */
+        uint64_t HashMaterial(const MaterialData& material) {
+            uint64_t hash = FnvOffsetBasis;
+            // 0.0f と -0.0f は等しいのでビット列を揃えてから加える
+            const float factors[] = {
+                material.albedo.x + 0.0f, material.albedo.y + 0.0f, material.albedo.z + 0.0f,
+                material.metallic + 0.0f, material.roughness + 0.0f, material.ao + 0.0f
+            };
+            HashValue(hash, factors);
+            HashString(hash, material.name);
+            HashString(hash, material.albedoTexturePath);
+            HashString(hash, material.normalTexturePath);
+            HashString(hash, material.metallicTexturePath);
+            HashString(hash, material.roughnessTexturePath);
+            HashString(hash, material.aoTexturePath);
+            HashValue(hash, material.albedoTexture.get());
+            HashValue(hash, material.normalTexture.get());
+            HashValue(hash, material.metallicTexture.get());
+            HashValue(hash, material.roughnessTexture.get());
+            HashValue(hash, material.aoTexture.get());
+            return hash;
+        }
+
+        /**
+         * @brief ローカル AABB をワールド空間に変換（中心と半径で計算し、8頂点の変換を省く）
+         */
+        void TransformBounds(const Matrix4x4& world, const Vector3& localMin, const Vector3& localMax,
+                             Vector3& outMin, Vector3& outMax) {
+            Vector3 center = (localMin + localMax) * 0.5f;
+            Vector3 extent = (localMax - localMin) * 0.5f;
+            float c[3];
+            float e[3];
+            for (int i = 0; i < 3; ++i) {
+                c[i] = world.m[i][0] * center.x + world.m[i][1] * center.y + world.m[i][2] * center.z + world.m[i][3];
+                e[i] = std::fabs(world.m[i][0]) * extent.x + std::fabs(world.m[i][1]) * extent.y +
+                       std::fabs(world.m[i][2]) * extent.z;
+            }
+            outMin = Vector3(c[0] - e[0], c[1] - e[1], c[2] - e[2]);
+            outMax = Vector3(c[0] + e[0], c[1] + e[1], c[2] + e[2]);
+        }
+
+        /**
+         * @brief 最下行が (0, 0, 0, 1) の行列同士の積 a * b
+         */
+        Matrix4x4 MultiplyAffine(const Matrix4x4& a, const Matrix4x4& b) {
+            Matrix4x4 result;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                    result.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j];
+                }
+                result.m[i][3] += a.m[i][3];
+            }
+            return result;
+        }
+    }
+
     Scene::Scene(const std::string& name) : name(name) {
-        Logger::Info("Scene '{}' created", name);
+        Logger::Info("Scene '%s' created", name.c_str());
     }
 
-    void Scene::AddObject(std::shared_ptr<SceneObject> object) {
-        // Stub implementation
-        Logger::Info("Scene::AddObject stub called");
+    // =====================================================
+    // オブジェクト管理
+    // =====================================================
+
+    SceneHandle Scene::AddObject(const SceneObject& object, SceneHandle parent) {
+        uint32_t parentIndex = SceneComponents::InvalidId;
+        uint32_t parentSlot = SceneComponents::InvalidId;
+        if (parent.IsValid()) {
+            parentIndex = Resolve(parent);
+            parentSlot = parent.index;
+        }
+
+        uint32_t slotIndex;
+        if (!freeSlots.empty()) {
+            slotIndex = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        const Transform& transform = object.GetTransform();
+        uint32_t objectFlags = object.IsVisible() ? SceneComponents::Visible : 0;
+        slots[slotIndex].componentIndex = components.Push(
+            transform.position, transform.rotation, transform.scale,
+            RegisterMesh(object.GetMesh()), RegisterMaterial(object.GetMaterial()),
+            objectFlags, slotIndex, parentIndex, parentSlot, object.GetName());
+
+        SceneHandle handle = { slotIndex, slots[slotIndex].generation };
+        objectsByName[object.GetName()] = handle;
+        bvhStructureDirty = true;
+        cullerDirty = true;
+        return handle;
     }
 
-    void Scene::AddModel(std::shared_ptr<ModelObject> model) {
-        // Stub implementation  
-        Logger::Info("Scene::AddModel stub called");
+    SceneHandle Scene::AddObject(std::shared_ptr<SceneObject> object, SceneHandle parent) {
+        if (!object) {
+            return {};
+        }
+        return AddObject(*object, parent);
+    }
+
+    std::vector<SceneHandle> Scene::AddModel(std::shared_ptr<ModelObject> model) {
+        std::vector<SceneHandle> handles;
+        if (!model) {
+            return handles;
+        }
+
+        this->models.push_back(model);
+
+        // ModelObjectから生成したSceneObjectはコンポーネントにコピーした後は不要
+        // ノードは親が先に並んでいるので、親のハンドルは追加済み
+        auto sceneNodes = model->CreateSceneObjects();
+        components.Reserve(components.Size() + sceneNodes.size());
+        handles.reserve(sceneNodes.size());
+        for (const ModelSceneNode& node : sceneNodes) {
+            SceneHandle parent = node.parent != ModelSceneNode::InvalidParent ? handles[node.parent] : SceneHandle{};
+            handles.push_back(AddObject(*node.object, parent));
+        }
+
+        Logger::Info("Model '%s' added to scene '%s' (%zu objects)",
+                     model->GetName().c_str(), name.c_str(), sceneNodes.size());
+        return handles;
     }
 
     void Scene::RemoveObject(const std::string& name) {
-        // Stub implementation
-        Logger::Info("Scene::RemoveObject stub called for: {}", name);
+        auto it = this->objectsByName.find(name);
+        if (it == this->objectsByName.end()) {
+            Logger::Warning("Object '%s' not found in scene '%s'", name.c_str(), this->name.c_str());
+            return;
+        }
+        RemoveObject(it->second);
     }
 
-    void Scene::RemoveObject(std::shared_ptr<SceneObject> object) {
-        // Stub implementation
-        Logger::Info("Scene::RemoveObject stub called");
+    void Scene::RemoveObject(SceneHandle handle) {
+        if (!IsAlive(handle)) {
+            return;
+        }
+
+        // 子孫は親より後ろにしかないので、root から後ろを1回走査すれば集まる
+        UpdateHierarchy();
+        uint32_t root = slots[handle.index].componentIndex;
+        uint32_t count = components.Size();
+        std::vector<uint8_t> inSubtree(count - root, 0);
+        std::vector<uint32_t> removed = { root };
+        inSubtree[0] = 1;
+        for (uint32_t i = root + 1; i < count; ++i) {
+            uint32_t parent = components.parents[i];
+            if (parent != SceneComponents::InvalidId && parent >= root && inSubtree[parent - root]) {
+                inSubtree[i - root] = 1;
+                removed.push_back(i);
+            }
+        }
+
+        // 後ろから削除すれば、末尾から移動してくる要素が削除対象であることはない
+        for (auto it = removed.rbegin(); it != removed.rend(); ++it) {
+            RemoveComponent(*it);
+        }
+
+        hierarchyDirty = true;
+        bvhStructureDirty = true;
+        cullerDirty = true;
     }
 
-    std::shared_ptr<SceneObject> Scene::FindObject(const std::string& name) const {
-        // Stub implementation
-        return nullptr;
+    void Scene::RemoveComponent(uint32_t index) {
+        uint32_t slotIndex = components.slots[index];
+        Slot& slot = slots[slotIndex];
+        SceneHandle handle = { slotIndex, slot.generation };
+
+        // 名前の索引が別のオブジェクトを指している場合（同名で追加し直した場合）は残す
+        auto it = objectsByName.find(components.names[index]);
+        if (it != objectsByName.end() && it->second == handle) {
+            objectsByName.erase(it);
+        }
+
+        // 末尾の要素が index に移動するので、そのスロットを付け替える
+        uint32_t movedSlot = components.slots.back();
+        components.SwapRemove(index);
+        if (movedSlot != slotIndex) {
+            slots[movedSlot].componentIndex = index;
+        }
+
+        slot.componentIndex = SceneComponents::InvalidId;
+        slot.generation++;
+        freeSlots.push_back(slotIndex);
+    }
+
+    SceneHandle Scene::FindObject(const std::string& name) const {
+        auto it = this->objectsByName.find(name);
+        return (it != this->objectsByName.end()) ? it->second : SceneHandle{};
+    }
+
+    bool Scene::IsAlive(SceneHandle handle) const {
+        return handle.index < slots.size() &&
+               slots[handle.index].generation == handle.generation &&
+               slots[handle.index].componentIndex != SceneComponents::InvalidId;
+    }
+
+    std::vector<SceneHandle> Scene::GetObjects() const {
+        std::vector<SceneHandle> handles;
+        handles.reserve(components.Size());
+        for (uint32_t i = 0; i < components.Size(); ++i) {
+            handles.push_back(GetHandle(i));
+        }
+        return handles;
     }
 
     void Scene::ClearObjects() {
-        // Stub implementation
-        Logger::Info("Scene::ClearObjects stub called");
+        // 既存のハンドルを無効にするため世代は進めてスロットは再利用する
+        freeSlots.clear();
+        for (uint32_t i = 0; i < slots.size(); ++i) {
+            if (slots[i].componentIndex != SceneComponents::InvalidId) {
+                slots[i].componentIndex = SceneComponents::InvalidId;
+                slots[i].generation++;
+            }
+            freeSlots.push_back(static_cast<uint32_t>(slots.size()) - 1 - i);
+        }
+
+        components.Clear();
+        this->objectsByName.clear();
+        this->meshes.clear();
+        this->meshIdsByPointer.clear();
+        this->materials.clear();
+        this->materialIdsByHash.clear();
+        this->models.clear();
+        hierarchyDirty = false;
+        bvh.Clear();
+        bvhStructureDirty = false;
+        bvhBoundsDirty = false;
+        culler.Clear();
+        cullerDirty = false;
+        Logger::Info("All objects cleared from scene '%s'", name.c_str());
+    }
+
+    // =====================================================
+    // オブジェクトのコンポーネント
+    // =====================================================
+
+    uint32_t Scene::Resolve(SceneHandle handle) const {
+        if (!IsAlive(handle)) {
+            throw std::invalid_argument("Scene: handle does not refer to a live object");
+        }
+        return slots[handle.index].componentIndex;
+    }
+
+    uint32_t Scene::GetComponentIndex(SceneHandle handle) const {
+        return IsAlive(handle) ? slots[handle.index].componentIndex : SceneComponents::InvalidId;
+    }
+
+    SceneHandle Scene::GetHandle(uint32_t componentIndex) const {
+        if (componentIndex >= components.Size()) {
+            return {};
+        }
+        uint32_t slotIndex = components.slots[componentIndex];
+        return { slotIndex, slots[slotIndex].generation };
+    }
+
+    Vector3 Scene::GetPosition(SceneHandle handle) const {
+        return components.positions[Resolve(handle)];
+    }
+
+    Vector3 Scene::GetRotation(SceneHandle handle) const {
+        return components.rotations[Resolve(handle)];
+    }
+
+    Vector3 Scene::GetScale(SceneHandle handle) const {
+        return components.scales[Resolve(handle)];
+    }
+
+    void Scene::SetPosition(SceneHandle handle, const Vector3& position) {
+        uint32_t index = Resolve(handle);
+        components.positions[index] = position;
+        components.flags[index] |= SceneComponents::TransformDirty;
+    }
+
+    void Scene::SetRotation(SceneHandle handle, const Vector3& rotation) {
+        uint32_t index = Resolve(handle);
+        components.rotations[index] = rotation;
+        components.flags[index] |= SceneComponents::TransformDirty;
+    }
+
+    void Scene::SetScale(SceneHandle handle, const Vector3& scale) {
+        uint32_t index = Resolve(handle);
+        components.scales[index] = scale;
+        components.flags[index] |= SceneComponents::TransformDirty;
+    }
+
+    const Matrix4x4& Scene::GetWorldMatrix(SceneHandle handle) const {
+        return components.worldMatrices[Resolve(handle)];
+    }
+
+    void Scene::GetWorldBounds(SceneHandle handle, Vector3& outMin, Vector3& outMax) const {
+        uint32_t index = Resolve(handle);
+        outMin = components.boundsMin[index];
+        outMax = components.boundsMax[index];
+    }
+
+    std::shared_ptr<Mesh> Scene::GetMesh(SceneHandle handle) const {
+        uint32_t meshId = components.meshIds[Resolve(handle)];
+        return meshId != SceneComponents::InvalidId ? meshes[meshId] : nullptr;
+    }
+
+    const MaterialData& Scene::GetMaterial(SceneHandle handle) const {
+        return materials[components.materialIds[Resolve(handle)]];
+    }
+
+    void Scene::SetMaterial(SceneHandle handle, const MaterialData& material) {
+        uint32_t index = Resolve(handle);
+        components.materialIds[index] = RegisterMaterial(material);
+    }
+
+    const std::string& Scene::GetObjectName(SceneHandle handle) const {
+        return components.names[Resolve(handle)];
+    }
+
+    void Scene::SetParent(SceneHandle handle, SceneHandle parent) {
+        uint32_t index = Resolve(handle);
+        uint32_t parentSlot = SceneComponents::InvalidId;
+        if (parent.IsValid()) {
+            Resolve(parent);
+            // 親をたどって自分に行き着く場合は循環する
+            for (uint32_t slot = parent.index; slot != SceneComponents::InvalidId;
+                 slot = components.parentSlots[slots[slot].componentIndex]) {
+                if (slot == handle.index) {
+                    throw std::invalid_argument("Scene: parent would create a cycle");
+                }
+            }
+            parentSlot = parent.index;
+        }
+
+        components.parentSlots[index] = parentSlot;
+        components.flags[index] |= SceneComponents::TransformDirty;
+        hierarchyDirty = true;
+    }
+
+    SceneHandle Scene::GetParent(SceneHandle handle) const {
+        uint32_t parentSlot = components.parentSlots[Resolve(handle)];
+        if (parentSlot == SceneComponents::InvalidId) {
+            return {};
+        }
+        return { parentSlot, slots[parentSlot].generation };
+    }
+
+    std::vector<SceneHandle> Scene::GetChildren(SceneHandle handle) const {
+        Resolve(handle);
+        std::vector<SceneHandle> children;
+        for (uint32_t i = 0; i < components.Size(); ++i) {
+            if (components.parentSlots[i] == handle.index) {
+                children.push_back(GetHandle(i));
+            }
+        }
+        return children;
+    }
+
+    void Scene::UpdateHierarchy() {
+        if (!hierarchyDirty) {
+            return;
+        }
+        hierarchyDirty = false;
+
+        uint32_t count = components.Size();
+        bool ordered = true;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t parentSlot = components.parentSlots[i];
+            uint32_t parent = parentSlot != SceneComponents::InvalidId ? slots[parentSlot].componentIndex : SceneComponents::InvalidId;
+            components.parents[i] = parent;
+            ordered = ordered && (parent == SceneComponents::InvalidId || parent < i);
+        }
+        if (ordered) {
+            return;
+        }
+
+        // 深さで安定に並べ替える（親は子より浅いので先に並ぶ）
+        std::vector<uint32_t> depths(count, SceneComponents::InvalidId);
+        std::vector<uint32_t> chain;
+        uint32_t maxDepth = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t node = i;
+            while (depths[node] == SceneComponents::InvalidId && components.parents[node] != SceneComponents::InvalidId) {
+                chain.push_back(node);
+                node = components.parents[node];
+            }
+            if (depths[node] == SceneComponents::InvalidId) {
+                depths[node] = 0;
+            }
+            uint32_t depth = depths[node];
+            while (!chain.empty()) {
+                depths[chain.back()] = ++depth;
+                chain.pop_back();
+            }
+            maxDepth = std::max(maxDepth, depth);
+        }
+
+        std::vector<uint32_t> offsets(maxDepth + 2, 0);
+        for (uint32_t i = 0; i < count; ++i) {
+            offsets[depths[i] + 1]++;
+        }
+        for (uint32_t d = 1; d < offsets.size(); ++d) {
+            offsets[d] += offsets[d - 1];
+        }
+        std::vector<uint32_t> order(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            order[offsets[depths[i]]++] = i;
+        }
+
+        components.Permute(order);
+        for (uint32_t i = 0; i < count; ++i) {
+            slots[components.slots[i]].componentIndex = i;
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t parentSlot = components.parentSlots[i];
+            components.parents[i] = parentSlot != SceneComponents::InvalidId ? slots[parentSlot].componentIndex : SceneComponents::InvalidId;
+        }
+
+        bvhStructureDirty = true;
+        cullerDirty = true;
     }
 
+    void Scene::SetVisible(SceneHandle handle, bool visible) {
+        uint32_t index = Resolve(handle);
+        if (visible) {
+            components.flags[index] |= SceneComponents::Visible;
+        } else {
+            components.flags[index] &= ~SceneComponents::Visible;
+        }
+    }
+
+    bool Scene::IsVisible(SceneHandle handle) const {
+        return (components.flags[Resolve(handle)] & SceneComponents::Visible) != 0;
+    }
+
+    void Scene::SetTransparent(SceneHandle handle, bool transparent) {
+        uint32_t index = Resolve(handle);
+        if (transparent) {
+            components.flags[index] |= SceneComponents::Transparent;
+        } else {
+            components.flags[index] &= ~SceneComponents::Transparent;
+        }
+    }
+
+    bool Scene::IsTransparent(SceneHandle handle) const {
+        return (components.flags[Resolve(handle)] & SceneComponents::Transparent) != 0;
+    }
+
+    void Scene::SetPipeline(SceneHandle handle, uint32_t pipelineId) {
+        components.pipelineIds[Resolve(handle)] = pipelineId;
+    }
+
+    uint32_t Scene::GetPipeline(SceneHandle handle) const {
+        return components.pipelineIds[Resolve(handle)];
+    }
+
+    uint32_t Scene::RegisterMesh(const std::shared_ptr<Mesh>& mesh) {
+        if (!mesh) {
+            return SceneComponents::InvalidId;
+        }
+
+        auto it = meshIdsByPointer.find(mesh.get());
+        if (it != meshIdsByPointer.end()) {
+            return it->second;
+        }
+
+        uint32_t meshId = static_cast<uint32_t>(meshes.size());
+        meshes.push_back(mesh);
+        meshIdsByPointer.emplace(mesh.get(), meshId);
+        return meshId;
+    }
+
+    uint32_t Scene::RegisterMaterial(const MaterialData& material) {
+        // 全フィールドの比較はハッシュが一致したものだけに行う
+        uint64_t hash = HashMaterial(material);
+        auto range = materialIdsByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (SameMaterial(materials[it->second], material)) {
+                return it->second;
+            }
+        }
+
+        uint32_t materialId = static_cast<uint32_t>(materials.size());
+        materials.push_back(material);
+        materialIdsByHash.emplace(hash, materialId);
+        return materialId;
+    }
+
+    // =====================================================
+    // ライト管理
+    // =====================================================
+
     void Scene::AddLight(const std::string& name, const SceneLight& light) {
-        // Stub implementation
-        Logger::Info("Scene::AddLight stub called for: {}", name);
+        this->lights[name] = light;
+        Logger::Info("Light '%s' added to scene '%s'", name.c_str(), this->name.c_str());
     }
 
     void Scene::RemoveLight(const std::string& name) {
-        // Stub implementation
-        Logger::Info("Scene::RemoveLight stub called for: {}", name);
+        auto it = this->lights.find(name);
+        if (it != this->lights.end()) {
+            this->lights.erase(it);
+            Logger::Info("Light '%s' removed from scene '%s'", name.c_str(), this->name.c_str());
+        } else {
+            Logger::Warning("Light '%s' not found in scene '%s'", name.c_str(), this->name.c_str());
+        }
     }
 
     SceneLight* Scene::GetLight(const std::string& name) {
-        // Stub implementation
-        return nullptr;
+        auto it = this->lights.find(name);
+        return (it != this->lights.end()) ? &it->second : nullptr;
     }
 
     const SceneLight* Scene::GetLight(const std::string& name) const {
-        // Stub implementation
-        return nullptr;
+        auto it = this->lights.find(name);
+        return (it != this->lights.end()) ? &it->second : nullptr;
     }
 
     std::vector<SceneLight> Scene::GetActiveLights() const {
-        // Stub implementation
-        return std::vector<SceneLight>();
+        std::vector<SceneLight> activeLights;
+        for (const auto& pair : this->lights) {
+            if (pair.second.enabled) {
+                activeLights.push_back(pair.second);
+            }
+        }
+        return activeLights;
     }
 
     void Scene::ClearLights() {
-        // Stub implementation
-        Logger::Info("Scene::ClearLights stub called");
+        this->lights.clear();
+        Logger::Info("All lights cleared from scene '%s'", name.c_str());
     }
 
+    // =====================================================
+    // 更新・レンダリング
+    // =====================================================
+
     void Scene::Update(float deltaTime) {
-        // Stub implementation
+        // カメラの更新
+        if (this->mainCamera) {
+            this->mainCamera->Update(deltaTime);
+        }
+
+        UpdateTransforms();
+
+        // 統計情報をリセット
+        this->renderStats.Reset();
+        this->renderStats.totalObjects = components.Size();
+    }
+
+    void Scene::UpdateTransforms() {
+        UpdateHierarchy();
+
+        bool moved = false;
+        uint32_t count = components.Size();
+        for (uint32_t i = 0; i < count; ++i) {
+            uint32_t objectFlags = components.flags[i];
+            uint32_t parent = components.parents[i];
+            bool parentChanged = parent != SceneComponents::InvalidId &&
+                                 (components.flags[parent] & SceneComponents::WorldChanged);
+            if (!(objectFlags & SceneComponents::TransformDirty) && !parentChanged) {
+                if (objectFlags & SceneComponents::WorldChanged) {
+                    components.flags[i] = objectFlags & ~SceneComponents::WorldChanged;
+                }
+                continue;
+            }
+
+            if (objectFlags & SceneComponents::TransformDirty) {
+                Transform transform;
+                transform.position = components.positions[i];
+                transform.rotation = components.rotations[i];
+                transform.scale = components.scales[i];
+                components.localMatrices[i] = transform.GetWorldMatrix();
+            }
+            components.worldMatrices[i] = parent != SceneComponents::InvalidId
+                ? MultiplyAffine(components.worldMatrices[parent], components.localMatrices[i])
+                : components.localMatrices[i];
+
+            uint32_t meshId = components.meshIds[i];
+            if (meshId != SceneComponents::InvalidId) {
+                const Mesh& mesh = *meshes[meshId];
+                TransformBounds(components.worldMatrices[i], mesh.GetBoundsMin(), mesh.GetBoundsMax(),
+                                components.boundsMin[i], components.boundsMax[i]);
+            } else {
+                const Matrix4x4& world = components.worldMatrices[i];
+                components.boundsMin[i] = components.boundsMax[i] = Vector3(world.m[0][3], world.m[1][3], world.m[2][3]);
+            }
+            if (!cullerDirty) {
+                culler.Update(i, components.boundsMin[i], components.boundsMax[i]);
+            }
+
+            components.flags[i] = (objectFlags & ~SceneComponents::TransformDirty) | SceneComponents::WorldChanged;
+            moved = true;
+        }
+
+        if (moved) {
+            bvhBoundsDirty = true;
+        }
     }
 
-    std::vector<std::shared_ptr<SceneObject>> Scene::GetVisibleObjects(const Camera* camera) const {
-        // Stub implementation
-        return std::vector<std::shared_ptr<SceneObject>>();
+    const SceneBVH& Scene::GetBVH() const {
+        if (bvhStructureDirty) {
+            // 追加・削除でコンポーネント配列の位置が変わるため作り直す
+            bvh.Build(components.boundsMin.data(), components.boundsMax.data(), components.Size());
+        } else if (bvhBoundsDirty) {
+            bvh.Refit(components.boundsMin.data(), components.boundsMax.data());
+            if (bvh.NeedsRebuild()) {
+                bvh.Build(components.boundsMin.data(), components.boundsMax.data(), components.Size());
+            }
+        }
+        bvhStructureDirty = false;
+        bvhBoundsDirty = false;
+        return bvh;
     }
 
-    std::vector<std::shared_ptr<SceneObject>> Scene::GetTransparentObjects(const Camera* camera) const {
-        // Stub implementation
-        return std::vector<std::shared_ptr<SceneObject>>();
+    const FrustumCuller& Scene::GetCuller() const {
+        if (cullerDirty) {
+            culler.Assign(components.boundsMin.data(), components.boundsMax.data(), components.Size());
+            cullerDirty = false;
+        }
+        return culler;
+    }
+
+    void Scene::CullChunks(const Camera* camera, uint32_t requiredFlags, CulledChunks& outChunks) const {
+        Vector4 frustumPlanes[6];
+        const FrustumCuller* frustumCuller = nullptr;
+        if (camera) {
+            CalculateFrustumPlanes(camera, frustumPlanes);
+            frustumCuller = &GetCuller();
+        }
+
+        uint32_t count = components.Size();
+        uint32_t chunkCount = (count + CullingChunkSize - 1) / CullingChunkSize;
+        outChunks.indices.resize(count);
+        outChunks.counts.assign(chunkCount, 0);
+        outChunks.offsets.assign(chunkCount, 0);
+        outChunks.rejected.assign(chunkCount, 0);
+
+        // 各チャンクは自分の範囲の位置にだけ書くため、スレッド間で出力を共有しない
+        JobSystem::Run(chunkCount, [&](uint32_t chunk) {
+            uint32_t begin = chunk * CullingChunkSize;
+            uint32_t end = (std::min)(begin + CullingChunkSize, count);
+            uint32_t* indices = outChunks.indices.data() + begin;
+
+            uint32_t candidateCount = end - begin;
+            if (frustumCuller) {
+                candidateCount = frustumCuller->CullRange(frustumPlanes, begin, end, indices);
+                outChunks.rejected[chunk] = (end - begin) - candidateCount;
+            } else {
+                for (uint32_t i = begin; i < end; ++i) {
+                    indices[i - begin] = i;
+                }
+            }
+
+            uint32_t kept = 0;
+            for (uint32_t i = 0; i < candidateCount; ++i) {
+                uint32_t index = indices[i];
+                indices[kept] = index;
+                kept += (components.flags[index] & requiredFlags) == requiredFlags;
+            }
+            outChunks.counts[chunk] = kept;
+        });
+
+        uint32_t total = 0;
+        uint32_t rejectedTotal = 0;
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            outChunks.offsets[chunk] = total;
+            total += outChunks.counts[chunk];
+            rejectedTotal += outChunks.rejected[chunk];
+        }
+        outChunks.total = total;
+        outChunks.rejectedTotal = rejectedTotal;
+    }
+
+    std::vector<SceneHandle> Scene::GetVisibleObjects(const Camera* camera) const {
+        CulledChunks chunks;
+        CullChunks(camera, SceneComponents::Visible, chunks);
+
+        // チャンクの番号順に結合する（書き込み先は累積で決まっているためロック不要）
+        std::vector<SceneHandle> visibleObjects(chunks.total);
+        JobSystem::Run(static_cast<uint32_t>(chunks.counts.size()), [&](uint32_t chunk) {
+            const uint32_t* indices = chunks.indices.data() + chunk * CullingChunkSize;
+            SceneHandle* output = visibleObjects.data() + chunks.offsets[chunk];
+            for (uint32_t i = 0; i < chunks.counts[chunk]; ++i) {
+                output[i] = GetHandle(indices[i]);
+            }
+        });
+        return visibleObjects;
+    }
+
+    std::vector<SceneHandle> Scene::GetTransparentObjects(const Camera* camera) const {
+        CulledChunks chunks;
+        CullChunks(camera, SceneComponents::Visible | SceneComponents::Transparent, chunks);
+
+        Vector3 cameraPosition = camera ? camera->GetPosition() : Vector3(0, 0, 0);
+        std::vector<std::pair<float, SceneHandle>> transparentObjects(chunks.total);
+        JobSystem::Run(static_cast<uint32_t>(chunks.counts.size()), [&](uint32_t chunk) {
+            const uint32_t* indices = chunks.indices.data() + chunk * CullingChunkSize;
+            std::pair<float, SceneHandle>* output = transparentObjects.data() + chunks.offsets[chunk];
+            for (uint32_t i = 0; i < chunks.counts[chunk]; ++i) {
+                uint32_t index = indices[i];
+                Vector3 center = (components.boundsMin[index] + components.boundsMax[index]) * 0.5f;
+                output[i] = { (center - cameraPosition).LengthSquared(), GetHandle(index) };
+            }
+        });
+
+        // 奥から手前へ
+        std::stable_sort(transparentObjects.begin(), transparentObjects.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        std::vector<SceneHandle> result;
+        result.reserve(transparentObjects.size());
+        for (const auto& entry : transparentObjects) {
+            result.push_back(entry.second);
+        }
+        return result;
+    }
+
+    void Scene::BuildDrawQueues(const Camera* camera, DrawQueue& outOpaque, DrawQueue& outTransparent) const {
+        CulledChunks chunks;
+        CullChunks(camera, SceneComponents::Visible, chunks);
+        BuildDrawQueues(camera, chunks, outOpaque, outTransparent);
+    }
+
+    void Scene::BuildDrawQueues(const Camera* camera, const CulledChunks& chunks, DrawQueue& outOpaque, DrawQueue& outTransparent) const {
+        uint32_t chunkCount = static_cast<uint32_t>(chunks.counts.size());
+
+        // チャンクごとに不透明・半透明の数を数え、両方のリストでの書き込み位置を決める
+        std::vector<uint32_t> opaqueOffsets(chunkCount);
+        std::vector<uint32_t> transparentOffsets(chunkCount);
+        JobSystem::Run(chunkCount, [&](uint32_t chunk) {
+            const uint32_t* indices = chunks.indices.data() + chunk * CullingChunkSize;
+            uint32_t opaqueCount = 0;
+            uint32_t transparentCount = 0;
+            for (uint32_t i = 0; i < chunks.counts[chunk]; ++i) {
+                uint32_t index = indices[i];
+                bool hasMesh = components.meshIds[index] != SceneComponents::InvalidId;
+                bool transparent = (components.flags[index] & SceneComponents::Transparent) != 0;
+                opaqueCount += hasMesh && !transparent;
+                transparentCount += hasMesh && transparent;
+            }
+            opaqueOffsets[chunk] = opaqueCount;
+            transparentOffsets[chunk] = transparentCount;
+        });
+
+        uint32_t opaqueTotal = 0;
+        uint32_t transparentTotal = 0;
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk) {
+            uint32_t opaqueCount = opaqueOffsets[chunk];
+            uint32_t transparentCount = transparentOffsets[chunk];
+            opaqueOffsets[chunk] = opaqueTotal;
+            transparentOffsets[chunk] = transparentTotal;
+            opaqueTotal += opaqueCount;
+            transparentTotal += transparentCount;
+        }
+        outOpaque.GetItems().resize(opaqueTotal);
+        outTransparent.GetItems().resize(transparentTotal);
+
+        // ビュー行列は行ベクトルなので、ビュー空間の奥行きは 3 列目との内積
+        Matrix4x4 view = camera ? camera->GetViewMatrix() : Matrix4x4();
+        JobSystem::Run(chunkCount, [&](uint32_t chunk) {
+            const uint32_t* indices = chunks.indices.data() + chunk * CullingChunkSize;
+            DrawQueue::Item* opaqueItems = outOpaque.GetItems().data() + opaqueOffsets[chunk];
+            DrawQueue::Item* transparentItems = outTransparent.GetItems().data() + transparentOffsets[chunk];
+            for (uint32_t i = 0; i < chunks.counts[chunk]; ++i) {
+                uint32_t index = indices[i];
+                uint32_t meshId = components.meshIds[index];
+                if (meshId == SceneComponents::InvalidId) {
+                    continue;
+                }
+
+                Vector3 center = (components.boundsMin[index] + components.boundsMax[index]) * 0.5f;
+                float viewDepth = center.x * view.m[0][2] + center.y * view.m[1][2] + center.z * view.m[2][2] + view.m[3][2];
+                uint32_t depth = DrawQueue::QuantizeDepth(viewDepth);
+                uint32_t pipelineId = components.pipelineIds[index];
+                uint32_t materialId = components.materialIds[index];
+                if (components.flags[index] & SceneComponents::Transparent) {
+                    *transparentItems++ = { DrawQueue::MakeTransparentKey(pipelineId, materialId, meshId, depth), index };
+                } else {
+                    *opaqueItems++ = { DrawQueue::MakeOpaqueKey(pipelineId, materialId, meshId, depth), index };
+                }
+            }
+        });
+
+        // 2つのリストは独立しているので並べ替えも並列に行う
+        JobSystem::Run(2, [&](uint32_t list) {
+            (list == 0 ? outOpaque : outTransparent).Sort();
+        });
+    }
+
+    void Scene::Render(std::shared_ptr<Camera> camera) {
+        using Clock = std::chrono::high_resolution_clock;
+
+        UpdateTransforms();
+
+        CulledChunks chunks;
+        auto cullingStart = Clock::now();
+        CullChunks(camera.get(), SceneComponents::Visible, chunks);
+        auto cullingEnd = Clock::now();
+        BuildDrawQueues(camera.get(), chunks, opaqueQueue, transparentQueue);
+
+        // 非表示やメッシュを持たないオブジェクトは描画しないが、カリングされたわけではない
+        this->renderStats.totalObjects = components.Size();
+        this->renderStats.renderedObjects = opaqueQueue.Size() + transparentQueue.Size();
+        this->renderStats.culledObjects = chunks.rejectedTotal;
+        this->renderStats.cullingTime = std::chrono::duration<float, std::milli>(cullingEnd - cullingStart).count();
+
+        // 不透明を状態ごとに手前から描いた後、半透明を奥から重ねる
+        for (const DrawQueue* queue : { &opaqueQueue, &transparentQueue }) {
+            for (const DrawQueue::Item& item : queue->GetItems()) {
+                const Mesh& mesh = *meshes[components.meshIds[item.componentIndex]];
+                this->renderStats.totalVertices += mesh.GetVertexCount();
+                this->renderStats.totalTriangles += mesh.GetIndexCount() / 3;
+                this->renderStats.drawCalls++;
+            }
+        }
     }
 
+    RenderStats Scene::GetRenderStats() const {
+        return renderStats;
+    }
+
+    void Scene::ResetRenderStats() {
+        renderStats.Reset();
+    }
+
+    // =====================================================
+    // ユーティリティ
+    // =====================================================
+
     void Scene::CalculateSceneBounds(Vector3& outMin, Vector3& outMax) const {
-        outMin = outMax = Vector3(0, 0, 0);
+        if (components.Empty()) {
+            outMin = outMax = Vector3(0, 0, 0);
+            return;
+        }
+
+        outMin = Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+        outMax = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (uint32_t i = 0; i < components.Size(); ++i) {
+            const Vector3& boundsMin = components.boundsMin[i];
+            const Vector3& boundsMax = components.boundsMax[i];
+            outMin = Vector3((std::min)(outMin.x, boundsMin.x), (std::min)(outMin.y, boundsMin.y), (std::min)(outMin.z, boundsMin.z));
+            outMax = Vector3((std::max)(outMax.x, boundsMax.x), (std::max)(outMax.y, boundsMax.y), (std::max)(outMax.z, boundsMax.z));
+        }
     }
 
-    std::shared_ptr<SceneObject> Scene::FindNearestObject(const Vector3& position) const {
-        // Stub implementation
-        return nullptr;
+    SceneHandle Scene::FindNearestObject(const Vector3& position) const {
+        return GetHandle(GetBVH().FindNearest(position));
     }
 
-    std::vector<std::shared_ptr<SceneObject>> Scene::RayIntersect(const Vector3& origin, const Vector3& direction) const {
-        // Stub implementation
-        return std::vector<std::shared_ptr<SceneObject>>();
+    std::vector<SceneHandle> Scene::RayIntersect(const Vector3& origin, const Vector3& direction) const {
+        std::vector<std::pair<float, uint32_t>> hits;
+        GetBVH().QueryRay(origin, direction, hits);
+        std::sort(hits.begin(), hits.end());
+
+        std::vector<SceneHandle> result;
+        result.reserve(hits.size());
+        for (const auto& hit : hits) {
+            result.push_back(GetHandle(hit.second));
+        }
+        return result;
     }
 
     void Scene::FrameAll(float margin) {
@@ -112,8 +900,18 @@ namespace Athena {
     }
 
     void Scene::CreateDefaultLighting() {
-        // Stub implementation
-        Logger::Info("Scene::CreateDefaultLighting stub called");
+        // デフォルト方向ライト
+        SceneLight sunLight(SceneLight::Directional);
+        sunLight.direction = Vector3(-0.5f, -1.0f, -0.3f).Normalize();
+        sunLight.color = Vector3(1.0f, 0.95f, 0.8f);
+        sunLight.intensity = 3.0f;
+        AddLight("Sun", sunLight);
+
+        // 環境光の設定
+        this->environment.ambientColor = Vector3(0.3f, 0.4f, 0.6f);
+        this->environment.ambientIntensity = 0.2f;
+
+        Logger::Info("Default lighting created for scene '%s'", name.c_str());
     }
 
     std::shared_ptr<ModelObject> Scene::LoadAndAddModel(
@@ -121,86 +919,70 @@ namespace Athena {
         const std::string& filepath,
         const std::string& name,
         const Vector3& position) {
-        
-        // Stub implementation
-        Logger::Info("Scene::LoadAndAddModel stub called for: {}", filepath);
-        return nullptr;
-    }
 
-    bool Scene::IsObjectInFrustum(const SceneObject* object, const Camera* camera) const {
-        // Stub implementation
-        return true;
+        // モデルを読み込み
+        auto model = ModelLoader::LoadModel(device, filepath);
+        if (!model) {
+            Logger::Error("Failed to load model: %s", filepath.c_str());
+            return nullptr;
+        }
+
+        // ModelObjectを作成
+        std::string modelName = name.empty() ? model->filename : name;
+        auto modelObject = std::make_shared<ModelObject>(modelName);
+        modelObject->SetModel(model);
+        modelObject->GetTransform().position = position;
+
+        // シーンに追加
+        AddModel(modelObject);
+
+        return modelObject;
     }
 
     void Scene::CalculateFrustumPlanes(const Camera* camera, Vector4 frustumPlanes[6]) const {
-        // Stub implementation
-        for (int i = 0; i < 6; ++i) {
-            frustumPlanes[i] = Vector4(0, 0, 0, 1);
-        }
+        // シェーダーと同じ行ベクトルの順（world * view * proj）で合成する
+        Matrix4x4 viewProjection = camera->GetViewMatrix() * camera->GetProjectionMatrix();
+        FrustumCuller::ExtractPlanes(viewProjection, frustumPlanes);
     }
 
     bool Scene::AABBIntersectsFrustum(const Vector3& aabbMin, const Vector3& aabbMax, const Vector4 frustumPlanes[6]) const {
-        // Stub implementation
-        return true;
-    }
-
-    std::vector<std::shared_ptr<SceneObject>> Scene::GetObjects() const {
-        // Stub implementation
-        return std::vector<std::shared_ptr<SceneObject>>();
+        return FrustumCuller::Intersects(frustumPlanes, aabbMin, aabbMax);
     }
 
     SceneEnvironment& Scene::GetEnvironment() {
-        // Stub implementation
-        static SceneEnvironment env;
-        return env;
+        return environment;
     }
 
     const SceneEnvironment& Scene::GetEnvironment() const {
-        // Stub implementation
-        static SceneEnvironment env;
-        return env;
-    }
-
-    RenderStats Scene::GetRenderStats() const {
-        // Stub implementation
-        RenderStats stats;
-        return stats;
+        return environment;
     }
 
-    void Scene::ResetRenderStats() {
-        // Stub implementation
-    }
-
-    void Scene::Render(std::shared_ptr<Camera> camera) {
-        // Stub implementation
-        Logger::Info("Scene::Render stub called");
-    }
+    // =====================================================
+    // デバッグ・可視化
+    // =====================================================
 
     void Scene::SetWireframeMode(bool enable) {
-        // Stub implementation
+        wireframeMode = enable;
     }
 
     bool Scene::GetWireframeMode() const {
-        // Stub implementation
-        return false;
+        return wireframeMode;
     }
 
     void Scene::SetShowBounds(bool show) {
-        // Stub implementation
+        showBounds = show;
     }
 
     bool Scene::GetShowBounds() const {
-        // Stub implementation
-        return false;
+        return showBounds;
     }
 
     void Scene::SetShowLights(bool show) {
-        // Stub implementation
+        showLights = show;
     }
 
     bool Scene::GetShowLights() const {
-        // Stub implementation
-        return false;
+        return showLights;
     }
 
-} // namespace Athena
\ No newline at end of file
+} // namespace Athena
@@ -0,0 +1,448 @@
+#include "Athena/Scene/SceneBVH.h"
+#include <algorithm>
+#include <float.h>
+
+namespace Athena {
+
+    namespace {
+        float Axis(const Vector3& v, int axis) {
+            return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+        }
+
+        Vector3 Min(const Vector3& a, const Vector3& b) {
+            return Vector3((std::min)(a.x, b.x), (std::min)(a.y, b.y), (std::min)(a.z, b.z));
+        }
+
+        Vector3 Max(const Vector3& a, const Vector3& b) {
+            return Vector3((std::max)(a.x, b.x), (std::max)(a.y, b.y), (std::max)(a.z, b.z));
+        }
+
+        float SurfaceArea(const Vector3& boundsMin, const Vector3& boundsMax) {
+            Vector3 size = boundsMax - boundsMin;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        /**
+         * @brief AABB が平面の外側（負の側）に完全に出ているか
+         */
+        bool OutsidePlane(const Vector4& plane, const Vector3& boundsMin, const Vector3& boundsMax) {
+            // 法線方向に最も遠い頂点（p-vertex）が外側なら AABB 全体が外側
+            float x = plane.x >= 0.0f ? boundsMax.x : boundsMin.x;
+            float y = plane.y >= 0.0f ? boundsMax.y : boundsMin.y;
+            float z = plane.z >= 0.0f ? boundsMax.z : boundsMin.z;
+            return plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f;
+        }
+
+        bool InsidePlane(const Vector4& plane, const Vector3& boundsMin, const Vector3& boundsMax) {
+            float x = plane.x >= 0.0f ? boundsMin.x : boundsMax.x;
+            float y = plane.y >= 0.0f ? boundsMin.y : boundsMax.y;
+            float z = plane.z >= 0.0f ? boundsMin.z : boundsMax.z;
+            return plane.x * x + plane.y * y + plane.z * z + plane.w >= 0.0f;
+        }
+
+        constexpr uint32_t AllPlanes = (1u << 6) - 1;
+    }
+
+    void SceneBVH::Build(const Vector3* boundsMin, const Vector3* boundsMax, uint32_t count) {
+        nodes.clear();
+        items.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            items[i].boundsMin = boundsMin[i];
+            items[i].boundsMax = boundsMax[i];
+            items[i].index = i;
+        }
+
+        if (count == 0) {
+            cost = buildCost = 0.0f;
+            return;
+        }
+
+        // リーフは1要素以上なのでノード数は 2N - 1 以下
+        nodes.reserve(static_cast<size_t>(count) * 2);
+        Node root;
+        root.leftFirst = 0;
+        root.count = count;
+        UpdateNodeBounds(root);
+        nodes.push_back(root);
+
+        std::vector<uint32_t> stack;
+        stack.push_back(0);
+        while (!stack.empty()) {
+            uint32_t nodeIndex = stack.back();
+            stack.pop_back();
+            Subdivide(nodeIndex, stack);
+        }
+
+        cost = buildCost = ComputeCost();
+    }
+
+    void SceneBVH::Subdivide(uint32_t nodeIndex, std::vector<uint32_t>& stack) {
+        const uint32_t first = nodes[nodeIndex].leftFirst;
+        const uint32_t count = nodes[nodeIndex].count;
+        if (count <= MaxLeafSize) {
+            return;
+        }
+
+        Vector3 centroidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+        Vector3 centroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (uint32_t i = first; i < first + count; ++i) {
+            Vector3 centroid = (items[i].boundsMin + items[i].boundsMax) * 0.5f;
+            centroidMin = Min(centroidMin, centroid);
+            centroidMax = Max(centroidMax, centroid);
+        }
+
+        // 3軸分のビンを1回の走査で集計する
+        struct Bin {
+            Vector3 boundsMin = Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+            Vector3 boundsMax = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+            uint32_t count = 0;
+        };
+        Bin bins[3][BinCount];
+        float low[3] = { centroidMin.x, centroidMin.y, centroidMin.z };
+        float scale[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            float extent = Axis(centroidMax, axis) - low[axis];
+            scale[axis] = extent > 0.0f ? BinCount / extent : 0.0f;
+        }
+        for (uint32_t i = first; i < first + count; ++i) {
+            const Item& item = items[i];
+            Vector3 centroid = (item.boundsMin + item.boundsMax) * 0.5f;
+            for (int axis = 0; axis < 3; ++axis) {
+                uint32_t bin = (std::min)(BinCount - 1, static_cast<uint32_t>((Axis(centroid, axis) - low[axis]) * scale[axis]));
+                Bin& target = bins[axis][bin];
+                target.boundsMin = Min(target.boundsMin, item.boundsMin);
+                target.boundsMax = Max(target.boundsMax, item.boundsMax);
+                target.count++;
+            }
+        }
+
+        // split 番目の境界は bins[0..split] と bins[split+1..] に分ける
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        float bestCost = FLT_MAX;
+        Node bestLeft;
+        Node bestRight;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (scale[axis] == 0.0f) {
+                continue;
+            }
+
+            Bin left[BinCount - 1];
+            Bin right[BinCount - 1];
+            Bin leftSum;
+            Bin rightSum;
+            for (uint32_t i = 0; i < BinCount - 1; ++i) {
+                const Bin& leftBin = bins[axis][i];
+                leftSum.boundsMin = Min(leftSum.boundsMin, leftBin.boundsMin);
+                leftSum.boundsMax = Max(leftSum.boundsMax, leftBin.boundsMax);
+                leftSum.count += leftBin.count;
+                left[i] = leftSum;
+
+                const Bin& rightBin = bins[axis][BinCount - 1 - i];
+                rightSum.boundsMin = Min(rightSum.boundsMin, rightBin.boundsMin);
+                rightSum.boundsMax = Max(rightSum.boundsMax, rightBin.boundsMax);
+                rightSum.count += rightBin.count;
+                right[BinCount - 2 - i] = rightSum;
+            }
+
+            for (uint32_t i = 0; i < BinCount - 1; ++i) {
+                if (left[i].count == 0 || right[i].count == 0) {
+                    continue;
+                }
+                float splitCost = left[i].count * SurfaceArea(left[i].boundsMin, left[i].boundsMax) +
+                                  right[i].count * SurfaceArea(right[i].boundsMin, right[i].boundsMax);
+                if (splitCost < bestCost) {
+                    bestCost = splitCost;
+                    bestAxis = axis;
+                    bestSplit = i;
+                    bestLeft.boundsMin = left[i].boundsMin;
+                    bestLeft.boundsMax = left[i].boundsMax;
+                    bestRight.boundsMin = right[i].boundsMin;
+                    bestRight.boundsMax = right[i].boundsMax;
+                }
+            }
+        }
+
+        const Node& node = nodes[nodeIndex];
+        float leafCost = count * SurfaceArea(node.boundsMin, node.boundsMax);
+        Node left;
+        Node right;
+        if (bestAxis >= 0 && (bestCost < leafCost || count > ForcedLeafSize)) {
+            auto* begin = items.data() + first;
+            auto* split = std::partition(begin, begin + count, [&](const Item& item) {
+                float centroid = (Axis(item.boundsMin, bestAxis) + Axis(item.boundsMax, bestAxis)) * 0.5f;
+                uint32_t bin = (std::min)(BinCount - 1, static_cast<uint32_t>((centroid - low[bestAxis]) * scale[bestAxis]));
+                return bin <= bestSplit;
+            });
+            left = bestLeft;
+            right = bestRight;
+            left.leftFirst = first;
+            left.count = static_cast<uint32_t>(split - begin);
+            right.leftFirst = first + left.count;
+            right.count = count - left.count;
+        } else if (count > ForcedLeafSize) {
+            // 重心がすべて一致する場合は並び順で半分に分ける
+            left.leftFirst = first;
+            left.count = count / 2;
+            right.leftFirst = first + left.count;
+            right.count = count - left.count;
+            UpdateNodeBounds(left);
+            UpdateNodeBounds(right);
+        } else {
+            return;
+        }
+
+        uint32_t leftIndex = static_cast<uint32_t>(nodes.size());
+        nodes.push_back(left);
+        nodes.push_back(right);
+        nodes[nodeIndex].leftFirst = leftIndex;
+        nodes[nodeIndex].count = 0;
+
+        stack.push_back(leftIndex);
+        stack.push_back(leftIndex + 1);
+    }
+
+    void SceneBVH::UpdateNodeBounds(Node& node) const {
+        node.boundsMin = Vector3(FLT_MAX, FLT_MAX, FLT_MAX);
+        node.boundsMax = Vector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+            node.boundsMin = Min(node.boundsMin, items[i].boundsMin);
+            node.boundsMax = Max(node.boundsMax, items[i].boundsMax);
+        }
+    }
+
+    void SceneBVH::Refit(const Vector3* boundsMin, const Vector3* boundsMax) {
+        for (Item& item : items) {
+            item.boundsMin = boundsMin[item.index];
+            item.boundsMax = boundsMax[item.index];
+        }
+
+        // 子は親より後ろにあるため、末尾から処理すれば子が先に更新される
+        for (size_t i = nodes.size(); i-- > 0;) {
+            Node& node = nodes[i];
+            if (node.IsLeaf()) {
+                UpdateNodeBounds(node);
+            } else {
+                const Node& left = nodes[node.leftFirst];
+                const Node& right = nodes[node.leftFirst + 1];
+                node.boundsMin = Min(left.boundsMin, right.boundsMin);
+                node.boundsMax = Max(left.boundsMax, right.boundsMax);
+            }
+        }
+
+        cost = ComputeCost();
+    }
+
+    void SceneBVH::Clear() {
+        nodes.clear();
+        items.clear();
+        cost = buildCost = 0.0f;
+    }
+
+    float SceneBVH::ComputeCost() const {
+        if (nodes.empty()) {
+            return 0.0f;
+        }
+
+        float total = 0.0f;
+        for (const Node& node : nodes) {
+            float area = SurfaceArea(node.boundsMin, node.boundsMax);
+            total += node.IsLeaf() ? area * node.count : area;
+        }
+
+        float rootArea = SurfaceArea(nodes[0].boundsMin, nodes[0].boundsMax);
+        return rootArea > 0.0f ? total / rootArea : 0.0f;
+    }
+
+    void SceneBVH::QueryFrustum(const Vector4 planes[6], std::vector<uint32_t>& outIndices) const {
+        if (nodes.empty()) {
+            return;
+        }
+
+        // planeMask のビット i が立っている平面だけを判定する（親で完全に内側だった平面は省く）
+        struct Entry {
+            uint32_t node;
+            uint32_t planeMask;
+        };
+        std::vector<Entry> stack;
+        stack.reserve(64);
+        stack.push_back({ 0, AllPlanes });
+
+        while (!stack.empty()) {
+            Entry entry = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[entry.node];
+
+            uint32_t planeMask = entry.planeMask;
+            bool outside = false;
+            for (uint32_t i = 0; i < 6 && !outside; ++i) {
+                if (!(planeMask & (1u << i))) {
+                    continue;
+                }
+                if (OutsidePlane(planes[i], node.boundsMin, node.boundsMax)) {
+                    outside = true;
+                } else if (InsidePlane(planes[i], node.boundsMin, node.boundsMax)) {
+                    planeMask &= ~(1u << i);
+                }
+            }
+            if (outside) {
+                continue;
+            }
+
+            if (planeMask == 0) {
+                // 部分木の要素は items 上で連続している
+                const Node* leftmost = &node;
+                while (!leftmost->IsLeaf()) {
+                    leftmost = &nodes[leftmost->leftFirst];
+                }
+                const Node* rightmost = &node;
+                while (!rightmost->IsLeaf()) {
+                    rightmost = &nodes[rightmost->leftFirst + 1];
+                }
+                for (uint32_t i = leftmost->leftFirst; i < rightmost->leftFirst + rightmost->count; ++i) {
+                    outIndices.push_back(items[i].index);
+                }
+                continue;
+            }
+
+            if (node.IsLeaf()) {
+                for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                    const Item& item = items[i];
+                    bool visible = true;
+                    for (uint32_t p = 0; p < 6 && visible; ++p) {
+                        if ((planeMask & (1u << p)) && OutsidePlane(planes[p], item.boundsMin, item.boundsMax)) {
+                            visible = false;
+                        }
+                    }
+                    if (visible) {
+                        outIndices.push_back(item.index);
+                    }
+                }
+                continue;
+            }
+
+            stack.push_back({ node.leftFirst + 1, planeMask });
+            stack.push_back({ node.leftFirst, planeMask });
+        }
+    }
+
+    void SceneBVH::QueryRay(const Vector3& origin, const Vector3& direction,
+                            std::vector<std::pair<float, uint32_t>>& outHits) const {
+        if (nodes.empty()) {
+            return;
+        }
+
+        std::vector<uint32_t> stack;
+        stack.reserve(64);
+        stack.push_back(0);
+        while (!stack.empty()) {
+            const Node& node = nodes[stack.back()];
+            stack.pop_back();
+
+            float distance;
+            if (!IntersectRay(origin, direction, node.boundsMin, node.boundsMax, distance)) {
+                continue;
+            }
+
+            if (node.IsLeaf()) {
+                for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                    if (IntersectRay(origin, direction, items[i].boundsMin, items[i].boundsMax, distance)) {
+                        outHits.emplace_back(distance, items[i].index);
+                    }
+                }
+                continue;
+            }
+
+            stack.push_back(node.leftFirst + 1);
+            stack.push_back(node.leftFirst);
+        }
+    }
+
+    uint32_t SceneBVH::FindNearest(const Vector3& point) const {
+        if (nodes.empty()) {
+            return InvalidIndex;
+        }
+
+        uint32_t nearest = InvalidIndex;
+        float nearestDistance = FLT_MAX;
+
+        struct Entry {
+            uint32_t node;
+            float distance;
+        };
+        std::vector<Entry> stack;
+        stack.reserve(64);
+        stack.push_back({ 0, DistanceSquared(point, nodes[0].boundsMin, nodes[0].boundsMax) });
+
+        while (!stack.empty()) {
+            Entry entry = stack.back();
+            stack.pop_back();
+            if (entry.distance >= nearestDistance) {
+                continue;
+            }
+
+            const Node& node = nodes[entry.node];
+            if (node.IsLeaf()) {
+                for (uint32_t i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                    float distance = DistanceSquared(point, items[i].boundsMin, items[i].boundsMax);
+                    if (distance < nearestDistance) {
+                        nearestDistance = distance;
+                        nearest = items[i].index;
+                    }
+                }
+                continue;
+            }
+
+            // 近い子を先に調べると遠い子を枝刈りしやすい
+            Entry left = { node.leftFirst, DistanceSquared(point, nodes[node.leftFirst].boundsMin, nodes[node.leftFirst].boundsMax) };
+            Entry right = { node.leftFirst + 1, DistanceSquared(point, nodes[node.leftFirst + 1].boundsMin, nodes[node.leftFirst + 1].boundsMax) };
+            if (left.distance <= right.distance) {
+                stack.push_back(right);
+                stack.push_back(left);
+            } else {
+                stack.push_back(left);
+                stack.push_back(right);
+            }
+        }
+        return nearest;
+    }
+
+    float SceneBVH::DistanceSquared(const Vector3& point, const Vector3& boundsMin, const Vector3& boundsMax) {
+        float dx = (std::max)((std::max)(boundsMin.x - point.x, 0.0f), point.x - boundsMax.x);
+        float dy = (std::max)((std::max)(boundsMin.y - point.y, 0.0f), point.y - boundsMax.y);
+        float dz = (std::max)((std::max)(boundsMin.z - point.z, 0.0f), point.z - boundsMax.z);
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    bool SceneBVH::IntersectRay(const Vector3& origin, const Vector3& direction,
+                                const Vector3& boundsMin, const Vector3& boundsMax, float& outDistance) {
+        float tMin = 0.0f;
+        float tMax = FLT_MAX;
+        for (int axis = 0; axis < 3; ++axis) {
+            float o = Axis(origin, axis);
+            float d = Axis(direction, axis);
+            float low = Axis(boundsMin, axis);
+            float high = Axis(boundsMax, axis);
+
+            // 軸に平行なレイはスラブの内側にある場合のみ交差する（0 * inf の NaN を避ける）
+            if (d == 0.0f) {
+                if (o < low || o > high) {
+                    return false;
+                }
+                continue;
+            }
+
+            float inverse = 1.0f / d;
+            float t1 = (low - o) * inverse;
+            float t2 = (high - o) * inverse;
+            tMin = (std::max)(tMin, (std::min)(t1, t2));
+            tMax = (std::min)(tMax, (std::max)(t1, t2));
+            if (tMax < tMin) {
+                return false;
+            }
+        }
+        outDistance = tMin;
+        return true;
+    }
+
+} // namespace Athena
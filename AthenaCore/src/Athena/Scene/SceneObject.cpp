@@ -1,17 +1,70 @@
 #include "Athena/Scene/SceneObject.h"
 #include "Athena/Utils/Logger.h"
+#include <algorithm>
 #include <cmath>
 
 namespace Athena {
 
     Matrix4x4 Transform::GetWorldMatrix() const {
-        Matrix4x4 scaleMatrix = Matrix4x4::CreateScale(scale.x, scale.y, scale.z);
-        Matrix4x4 rotationX = Matrix4x4::CreateRotationX(rotation.x * PI / 180.0f);
-        Matrix4x4 rotationY = Matrix4x4::CreateRotationY(rotation.y * PI / 180.0f);
-        Matrix4x4 rotationZ = Matrix4x4::CreateRotationZ(rotation.z * PI / 180.0f);
-        Matrix4x4 rotationMatrix = rotationZ * rotationX * rotationY;
-        Matrix4x4 translationMatrix = Matrix4x4::CreateTranslation(position.x, position.y, position.z);
-        return scaleMatrix * rotationMatrix * translationMatrix;
+        // Translation * RotationZ * RotationX * RotationY * Scaling を行列積なしで展開
+        float sx = std::sin(rotation.x * PI / 180.0f), cx = std::cos(rotation.x * PI / 180.0f);
+        float sy = std::sin(rotation.y * PI / 180.0f), cy = std::cos(rotation.y * PI / 180.0f);
+        float sz = std::sin(rotation.z * PI / 180.0f), cz = std::cos(rotation.z * PI / 180.0f);
+
+        Matrix4x4 matrix;
+        matrix.m[0][0] = (cz * cy - sz * sx * sy) * scale.x;
+        matrix.m[0][1] = -sz * cx * scale.y;
+        matrix.m[0][2] = (cz * sy + sz * sx * cy) * scale.z;
+        matrix.m[0][3] = position.x;
+        matrix.m[1][0] = (sz * cy + cz * sx * sy) * scale.x;
+        matrix.m[1][1] = cz * cx * scale.y;
+        matrix.m[1][2] = (sz * sy - cz * sx * cy) * scale.z;
+        matrix.m[1][3] = position.y;
+        matrix.m[2][0] = -cx * sy * scale.x;
+        matrix.m[2][1] = sx * scale.y;
+        matrix.m[2][2] = cx * cy * scale.z;
+        matrix.m[2][3] = position.z;
+        return matrix;
+    }
+
+    Transform Transform::FromMatrix(const Matrix4x4& matrix) {
+        const auto& m = matrix.m;
+        Transform transform;
+        transform.position = Vector3(m[0][3], m[1][3], m[2][3]);
+
+        // 各列の長さがスケール。行列式が負（鏡像）の場合は X のスケールを負にする
+        Vector3 columns[3];
+        for (int j = 0; j < 3; ++j) {
+            columns[j] = Vector3(m[0][j], m[1][j], m[2][j]);
+        }
+        transform.scale = Vector3(columns[0].Length(), columns[1].Length(), columns[2].Length());
+        if (columns[0].Dot(columns[1].Cross(columns[2])) < 0.0f) {
+            transform.scale.x = -transform.scale.x;
+        }
+
+        float r[3][3];
+        for (int j = 0; j < 3; ++j) {
+            float s = (j == 0) ? transform.scale.x : (j == 1) ? transform.scale.y : transform.scale.z;
+            float inverse = (s != 0.0f) ? 1.0f / s : 0.0f;
+            for (int i = 0; i < 3; ++i) {
+                r[i][j] = m[i][j] * inverse;
+            }
+        }
+
+        // R = Rz * Rx * Ry: r[2][1] = sin(x), r[2][0] = -cos(x)sin(y), r[2][2] = cos(x)cos(y)
+        float sx = (std::max)(-1.0f, (std::min)(1.0f, r[2][1]));
+        float x = std::asin(sx);
+        float y, z;
+        if (std::fabs(sx) < 0.9999f) {
+            y = std::atan2(-r[2][0], r[2][2]);
+            z = std::atan2(-r[0][1], r[1][1]);
+        } else {
+            // ジンバルロック（Y と Z が同じ軸になる）は Y を 0 とする
+            y = 0.0f;
+            z = std::atan2(r[1][0], r[0][0]);
+        }
+        transform.rotation = Vector3(x, y, z) * (180.0f / PI);
+        return transform;
     }
 
     SceneObject::SceneObject(const std::string& name) : name(name) {
@@ -76,30 +129,67 @@ namespace Athena {
     ModelObject::ModelObject(const std::string& name) : name(name) {
     }
 
-    std::vector<std::shared_ptr<SceneObject>> ModelObject::CreateSceneObjects() const {
-        std::vector<std::shared_ptr<SceneObject>> sceneObjects;
+    std::vector<ModelSceneNode> ModelObject::CreateSceneObjects() const {
+        std::vector<ModelSceneNode> sceneNodes;
         
         if (!model) {
-            return sceneObjects;
+            return sceneNodes;
         }
         
-        sceneObjects.reserve(model->meshes.size());
-        
-        for (size_t i = 0; i < model->meshes.size(); ++i) {
-            auto sceneObject = std::make_shared<SceneObject>(name + "_Mesh_" + std::to_string(i));
-            sceneObject->SetMesh(model->meshes[i]);
-            sceneObject->GetTransform() = transform;
+        auto createMeshObject = [this](uint32_t meshIndex, const std::string& objectName) {
+            auto sceneObject = std::make_shared<SceneObject>(objectName);
+            sceneObject->SetMesh(model->meshes[meshIndex]);
             
-            uint32_t materialIndex = model->meshes[i]->GetMaterialIndex();
+            uint32_t materialIndex = model->meshes[meshIndex]->GetMaterialIndex();
             if (materialIndex < model->materials.size()) {
                 sceneObject->SetMaterial(model->materials[materialIndex]);
             }
             
             sceneObject->SetVisible(visible);
-            sceneObjects.push_back(sceneObject);
+            return sceneObject;
+        };
+        
+        // ルートにモデル全体の Transform を持たせ、子はファイル内の変換のまま親からの相対で置く
+        auto root = std::make_shared<SceneObject>(name);
+        root->GetTransform() = transform;
+        root->SetVisible(visible);
+        sceneNodes.push_back({ root, ModelSceneNode::InvalidParent });
+        
+        if (model->nodes.empty()) {
+            // ノード階層を持たないモデルは Mesh をルートの直下に並べる
+            for (uint32_t i = 0; i < static_cast<uint32_t>(model->meshes.size()); ++i) {
+                sceneNodes.push_back({ createMeshObject(i, name + "_Mesh_" + std::to_string(i)), 0 });
+            }
+            return sceneNodes;
+        }
+        
+        std::vector<uint32_t> sceneIndices(model->nodes.size());
+        for (size_t nodeIndex = 0; nodeIndex < model->nodes.size(); ++nodeIndex) {
+            const ModelNode& node = model->nodes[nodeIndex];
+            uint32_t parent = (node.parent == ModelNode::InvalidParent) ? 0 : sceneIndices[node.parent];
+            std::string nodeName = name + "_" + (node.name.empty() ? "Node" + std::to_string(nodeIndex) : node.name);
+            
+            std::shared_ptr<SceneObject> nodeObject;
+            if (node.meshes.size() == 1) {
+                nodeObject = createMeshObject(node.meshes[0], nodeName);
+            } else {
+                nodeObject = std::make_shared<SceneObject>(nodeName);
+                nodeObject->SetVisible(visible);
+            }
+            nodeObject->GetTransform() = Transform::FromMatrix(node.localMatrix);
+            
+            sceneIndices[nodeIndex] = static_cast<uint32_t>(sceneNodes.size());
+            sceneNodes.push_back({ nodeObject, parent });
+            
+            if (node.meshes.size() > 1) {
+                for (uint32_t meshIndex : node.meshes) {
+                    sceneNodes.push_back({ createMeshObject(meshIndex, name + "_Mesh_" + std::to_string(meshIndex)),
+                                           sceneIndices[nodeIndex] });
+                }
+            }
         }
         
-        return sceneObjects;
+        return sceneNodes;
     }
 
     void ModelObject::GetWorldBounds(Vector3& outMin, Vector3& outMax) const {
@@ -1,11 +1,39 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <cstring>
+#include <float.h>
+#include <filesystem>
+#include <fstream>
+#include "Athena/Core/CommandListPool.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Core/JobSystem.h"
 #include "Athena/Scene/Scene.h"
 #include "Athena/Scene/Camera.h"
+#include "Athena/Scene/DrawQueue.h"
 #include "Athena/Scene/CameraController.h"
 #include "Athena/Scene/ModelLoader.h"
 #include "Athena/Scene/SceneObject.h"
+#include "Athena/Scene/SceneBVH.h"
+#include "Athena/Scene/FrustumCuller.h"
+#include "Athena/Core/DeferredReleaseQueue.h"
+#include "Athena/Core/DescriptorIndexAllocator.h"
+#include "Athena/Core/TransientDescriptorAllocator.h"
+#include "Athena/RenderGraph/RenderGraph.h"
+#include "Athena/RenderGraph/RenderModeSelector.h"
+#include "Athena/Resources/FrameLinearAllocator.h"
+#include "Athena/Resources/MemoryBudgetManager.h"
+#include "Athena/Resources/RingBufferAllocator.h"
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Resources/RootSignatureCache.h"
+#include "Athena/Resources/ShaderArchive.h"
+#include "Athena/Resources/ShaderCache.h"
+#include "Athena/Resources/ShaderPermutation.h"
+#include "Athena/Resources/StreamingUploadQueue.h"
+#include "Athena/Resources/TlsfAllocator.h"
 #include "Athena/Utils/Logger.h"
 #include "Athena/Utils/Math.h"
 
@@ -26,6 +54,26 @@ public:
     }
 };
 
+// Deterministic pseudo-random numbers (LCG) so that tests see the same data on every run
+class TestRandom {
+public:
+    explicit TestRandom(uint32_t seed) : state(seed) {}
+
+    // 24 random bits
+    uint32_t Next() {
+        state = state * 1664525u + 1013904223u;
+        return state >> 8;
+    }
+
+    // Uniform in [0, range)
+    float NextFloat(float range) {
+        return Next() * (range / 16777216.0f);
+    }
+
+private:
+    uint32_t state;
+};
+
 // Test Assimp Library Integration
 bool TestAssimpIntegration(std::shared_ptr<Device> device) {
     Logger::Info("=== Testing Assimp Library Integration ===");
@@ -208,6 +256,1488 @@ bool TestMultiMeshRendering(std::shared_ptr<Device> device) {
     }
 }
 
+// Test Upload Ring Buffer Allocation (no device required)
+bool TestRingBufferAllocator() {
+    Logger::Info("=== Testing Ring Buffer Allocator ===");
+
+    RingBufferAllocator allocator(4096);
+    bool passed = true;
+
+    // Aligned sub-allocation
+    uint64_t a = allocator.Allocate(100, 256);
+    uint64_t b = allocator.Allocate(100, 512);
+    passed &= (a == 0 && b == 512);
+
+    // Batch 1 retired at fence 1
+    allocator.FinishBatch(1);
+    uint64_t c = allocator.Allocate(3000, 256);
+    passed &= (c == 768);
+    allocator.FinishBatch(2);
+
+    // Ring is full until fence 1 completes
+    passed &= (allocator.Allocate(512, 256) == RingBufferAllocator::InvalidOffset);
+
+    // After fence 1, the allocation wraps to the head of the buffer
+    allocator.ReleaseCompleted(1);
+    uint64_t d = allocator.Allocate(512, 256);
+    passed &= (d == 0);
+    allocator.FinishBatch(3);
+
+    // Everything completed: the ring restarts from offset 0
+    allocator.ReleaseCompleted(3);
+    passed &= (allocator.GetUsedSize() == 0 && !allocator.HasPendingBatches());
+    passed &= (allocator.Allocate(4096, 512) == 0);
+
+    // Oversized requests are rejected (caller falls back to a dedicated buffer)
+    allocator.Reset(4096);
+    passed &= (allocator.Allocate(8192, 256) == RingBufferAllocator::InvalidOffset);
+
+    if (passed) {
+        Logger::Info("OK - Ring buffer allocator test completed successfully");
+    } else {
+        Logger::Error("ERROR - Ring buffer allocator test failed");
+    }
+    return passed;
+}
+
+bool TestTlsfAllocator() {
+    Logger::Info("=== Testing TLSF Allocator ===");
+
+    TlsfAllocator allocator(1024 * 1024, 4096);
+    bool passed = true;
+
+    // Sizes are rounded up to the granularity, offsets honour the alignment
+    auto a = allocator.Allocate(1000, 4096);
+    auto b = allocator.Allocate(65536, 4096);
+    auto c = allocator.Allocate(4096, 4096);
+    auto e = allocator.Allocate(1000, 65536);
+    passed &= (a.IsValid() && a.offset == 0 && a.size == 4096);
+    passed &= (b.IsValid() && b.offset == 4096 && c.offset == 69632);
+    passed &= (e.IsValid() && e.offset % 65536 == 0 && e.size == 4096);
+    passed &= allocator.Validate();
+
+    // Freeing the middle block leaves a hole: free space is fragmented
+    allocator.Free(b);
+    auto stats = allocator.GetStats();
+    passed &= (stats.allocationCount == 3 && stats.GetFragmentation() > 0.0f);
+    passed &= allocator.Validate();
+
+    // The hole is reused for a block that fits
+    auto d = allocator.Allocate(65536, 4096);
+    passed &= (d.IsValid() && d.offset == 4096);
+
+    // Oversized requests fail
+    passed &= !allocator.Allocate(2 * 1024 * 1024).IsValid();
+
+    // Freeing everything coalesces back into a single block
+    allocator.Free(a);
+    allocator.Free(c);
+    allocator.Free(d);
+    allocator.Free(e);
+    stats = allocator.GetStats();
+    passed &= (allocator.IsEmpty() && stats.freeBlockCount == 1 && stats.largestFreeBlock == 1024 * 1024);
+    passed &= allocator.Validate();
+
+    if (passed) {
+        Logger::Info("OK - TLSF allocator test completed successfully");
+    } else {
+        Logger::Error("ERROR - TLSF allocator test failed");
+    }
+    return passed;
+}
+
+bool TestDescriptorIndexAllocator() {
+    Logger::Info("=== Testing Descriptor Index Allocator ===");
+
+    DescriptorIndexAllocator allocator(200);
+    bool passed = true;
+
+    // Single allocations come from the lowest free index
+    uint32_t a = allocator.Allocate();
+    uint32_t b = allocator.Allocate();
+    passed &= (a == 0 && b == 1);
+
+    // Contiguous ranges skip holes that are too small and may span bitmap words
+    allocator.Free(a);
+    uint32_t table = allocator.AllocateRange(100);
+    passed &= (table == 2 && allocator.IsAllocated(101) && !allocator.IsAllocated(102));
+    passed &= (allocator.Allocate() == 0);
+    passed &= (allocator.GetFreeCount() == 200 - 102);
+
+    // Freed ranges are reused, oversized ranges fail
+    allocator.Free(table, 100);
+    passed &= (allocator.AllocateRange(150) == 2);
+    passed &= (allocator.AllocateRange(100) == DescriptorIndexAllocator::InvalidIndex);
+
+    // Lock-free variant: ranges stay within a 64-entry word
+    ConcurrentDescriptorIndexAllocator concurrent(100);
+    uint32_t first = concurrent.AllocateRange(60);
+    uint32_t second = concurrent.AllocateRange(10);
+    passed &= (first == 0 && second == 64);
+    concurrent.Free(first, 60);
+    passed &= (concurrent.Allocate() == 0 && concurrent.GetFreeCount() == 100 - 11);
+
+    if (passed) {
+        Logger::Info("OK - Descriptor index allocator test completed successfully");
+    } else {
+        Logger::Error("ERROR - Descriptor index allocator test failed");
+    }
+    return passed;
+}
+
+bool TestTransientDescriptorAllocator(std::shared_ptr<Device> device) {
+    Logger::Info("=== Testing Transient Descriptor Allocator ===");
+
+    try {
+        TransientDescriptorAllocator allocator;
+        allocator.Initialize(device->GetD3D12Device(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 4, 2);
+        bool passed = true;
+
+        // Tables are contiguous inside partition 0; a table that does not fit throws
+        DescriptorHandle a = allocator.Allocate(3);
+        bool threw = false;
+        try {
+            allocator.Allocate(2);
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        passed &= threw;
+        DescriptorHandle b = allocator.Allocate(1);
+        passed &= (a.index == 0 && b.index == 3 && allocator.GetUsedCount() == 4);
+        passed &= (b.gpu.ptr > a.gpu.ptr && b.cpu.ptr > a.cpu.ptr);
+        allocator.EndFrame(1);
+
+        // The next frame uses the second partition
+        allocator.BeginFrame(0);
+        passed &= (allocator.Allocate(1).index == 4 && allocator.GetUsedCount() == 1);
+        allocator.EndFrame(2);
+
+        // Partition 0 cannot be reused until fence 1 completes, and a failed BeginFrame keeps the current one
+        passed &= !allocator.CanBeginFrame(0);
+        threw = false;
+        try {
+            allocator.BeginFrame(0);
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        passed &= (threw && allocator.GetUsedCount() == 1);
+
+        allocator.BeginFrame(1);
+        passed &= (allocator.Allocate(4).index == 0 && allocator.GetPeakUsedCount() == 4);
+
+        allocator.Shutdown();
+
+        if (passed) {
+            Logger::Info("OK - Transient descriptor allocator test completed successfully");
+        } else {
+            Logger::Error("ERROR - Transient descriptor allocator test failed");
+        }
+        return passed;
+
+    } catch (const std::exception& e) {
+        Logger::Error("ERROR - Transient descriptor allocator test failed: %s", e.what());
+        return false;
+    }
+}
+
+bool TestFrameLinearAllocator() {
+    Logger::Info("=== Testing Frame Linear Allocator ===");
+
+    FrameLinearAllocator allocator(1024, 2);
+    bool passed = true;
+
+    // Per-draw constants are bump-allocated at 256-byte boundaries inside partition 0
+    uint64_t a = allocator.Allocate(200, 256);
+    uint64_t b = allocator.Allocate(256, 256);
+    uint64_t c = allocator.Allocate(256, 256);
+    passed &= (a == 0 && b == 256 && c == 512);
+    passed &= (allocator.Allocate(512, 256) == FrameLinearAllocator::InvalidOffset);
+    allocator.EndFrame(1);
+
+    // The next frame uses the second partition
+    allocator.BeginFrame(0);
+    passed &= (allocator.Allocate(100, 256) == 1024 && allocator.GetUsedSize() == 100);
+    allocator.EndFrame(2);
+
+    // Partition 0 cannot be reused until fence 1 completes
+    passed &= !allocator.CanBeginFrame(0);
+    bool threw = false;
+    try {
+        allocator.BeginFrame(0);
+    } catch (const std::exception&) {
+        threw = true;
+    }
+    passed &= threw;
+
+    allocator.BeginFrame(1);
+    passed &= (allocator.Allocate(1024, 256) == 0 && allocator.GetPeakUsedSize() == 1024);
+
+    if (passed) {
+        Logger::Info("OK - Frame linear allocator test completed successfully");
+    } else {
+        Logger::Error("ERROR - Frame linear allocator test failed");
+    }
+    return passed;
+}
+
+bool TestDeferredReleaseQueue() {
+    Logger::Info("=== Testing Deferred Release Queue ===");
+
+    DeferredReleaseQueue queue;
+    bool passed = true;
+
+    // Objects released while recording frame 1 stay alive until fence 1 completes
+    auto first = std::make_shared<int>(1);
+    std::weak_ptr<int> firstRef = first;
+    queue.Release(std::move(first));
+    queue.FinishBatch(1);
+
+    auto second = std::make_unique<int>(2);
+    int* secondPtr = second.get();
+    queue.Release(std::move(second));
+    queue.FinishBatch(2);
+
+    queue.ReleaseCompleted(0);
+    passed &= (!firstRef.expired() && *secondPtr == 2 && queue.GetPendingCount() == 2);
+
+    queue.ReleaseCompleted(1);
+    passed &= (firstRef.expired() && queue.GetPendingCount() == 1);
+
+    // Global routing: without a registered queue the object is destroyed immediately
+    auto third = std::make_shared<int>(3);
+    std::weak_ptr<int> thirdRef = third;
+    DeferredReleaseQueue::DeferRelease(std::move(third));
+    passed &= thirdRef.expired();
+
+    auto fourth = std::make_shared<int>(4);
+    std::weak_ptr<int> fourthRef = fourth;
+    DeferredReleaseQueue::SetGlobal(&queue);
+    DeferredReleaseQueue::DeferRelease(std::move(fourth));
+    DeferredReleaseQueue::SetGlobal(nullptr);
+    passed &= !fourthRef.expired();
+
+    // Flush releases everything, including the unfinished batch
+    queue.Flush();
+    passed &= (fourthRef.expired() && queue.GetPendingCount() == 0);
+
+    if (passed) {
+        Logger::Info("OK - Deferred release queue test completed successfully");
+    } else {
+        Logger::Error("ERROR - Deferred release queue test failed");
+    }
+    return passed;
+}
+
+bool TestCommandListPool(std::shared_ptr<Device> device) {
+    Logger::Info("=== Testing Command List Pool ===");
+
+    try {
+        CommandListPool pool;
+        pool.Initialize(device->GetD3D12Device(), D3D12_COMMAND_LIST_TYPE_DIRECT);
+        bool passed = true;
+
+        // Nothing is executed, so closing and resetting the lists is enough to exercise reuse
+        PooledCommandList& first = pool.Acquire(0);
+        first.commandList->Close();
+        pool.Release(first, 5);
+
+        // Submitted at fence 5: not handed out again before the fence completes
+        PooledCommandList& second = pool.Acquire(4);
+        passed &= (&second != &first && pool.GetCreatedCount() == 2 && pool.GetPendingCount() == 1);
+        second.commandList->Close();
+        pool.Release(second, 0);
+
+        // A list returned without submission is reusable right away
+        PooledCommandList& unsubmitted = pool.Acquire(4);
+        passed &= (&unsubmitted == &second && pool.GetCreatedCount() == 2);
+        unsubmitted.commandList->Close();
+        pool.Release(unsubmitted, 6);
+
+        // Once fence 5 completes the first list comes back
+        PooledCommandList& reused = pool.Acquire(5);
+        passed &= (&reused == &first && pool.GetCreatedCount() == 2 && pool.GetPendingCount() == 1);
+        reused.commandList->Close();
+        pool.Release(reused, 7);
+
+        // When every list is in flight the pool grows instead of waiting
+        PooledCommandList& grown = pool.Acquire(5);
+        passed &= (&grown != &first && &grown != &second && pool.GetCreatedCount() == 3);
+        grown.commandList->Close();
+        pool.Release(grown, 8);
+
+        pool.Shutdown();
+
+        if (passed) {
+            Logger::Info("OK - Command list pool test completed successfully");
+        } else {
+            Logger::Error("ERROR - Command list pool test failed");
+        }
+        return passed;
+
+    } catch (const std::exception& e) {
+        Logger::Error("ERROR - Command list pool test failed: %s", e.what());
+        return false;
+    }
+}
+
+bool TestMemoryBudgetManager() {
+    Logger::Info("=== Testing Memory Budget Manager ===");
+
+    struct FakeResidencyBackend : IResidencyBackend {
+        int evictions = 0;
+        int restores = 0;
+        bool Evict(void*) override { evictions++; return true; }
+        bool MakeResident(void*) override { restores++; return true; }
+    };
+
+    FakeMemoryBudgetSource source(1000, 500);
+    FakeResidencyBackend backend;
+    MemoryBudgetSettings settings;
+    settings.minIdleFrames = 4;
+
+    MemoryBudgetManager manager;
+    manager.Initialize(&source, &backend, settings);
+
+    int objects[4] = {};
+    uint32_t cold = manager.Register(&objects[0], BudgetCategory::Texture, 200, true);
+    uint32_t hot = manager.Register(&objects[1], BudgetCategory::Texture, 200, true);
+    uint32_t placed = manager.Register(&objects[2], BudgetCategory::Buffer, 200, false);
+    uint32_t target = manager.Register(&objects[3], BudgetCategory::RenderTarget, 200, true);
+    bool passed = true;
+
+    // Under budget: nothing is evicted
+    manager.Update(1);
+    manager.MarkUsed(cold);
+    manager.MarkUsed(hot);
+    manager.MarkUsed(placed);
+    manager.MarkUsed(target);
+    passed &= (manager.Update(2) == 0 && backend.evictions == 0);
+
+    // Over budget: only the idle, individually evictable resource goes
+    source.SetUsage(950);
+    for (uint64_t frame = 3; frame <= 8; ++frame) {
+        manager.Update(frame);
+        manager.MarkUsed(hot);
+    }
+    passed &= (!manager.IsResident(cold) && manager.IsResident(hot));
+    passed &= (manager.IsResident(placed) && manager.IsResident(target) && backend.evictions == 1);
+
+    // Touching an evicted resource makes it resident again
+    manager.MarkUsed(cold);
+    passed &= (manager.IsResident(cold) && backend.restores == 1);
+
+    MemoryBudgetManager::Stats stats = manager.GetStats();
+    passed &= (stats.categories[static_cast<size_t>(BudgetCategory::Texture)].count == 2);
+    passed &= (stats.totalEvictions == 1 && stats.totalRestores == 1);
+
+    manager.Unregister(cold);
+    passed &= (manager.GetStats().categories[static_cast<size_t>(BudgetCategory::Texture)].count == 1);
+
+    if (passed) {
+        Logger::Info("OK - Memory budget manager test completed successfully");
+    } else {
+        Logger::Error("ERROR - Memory budget manager test failed");
+    }
+    return passed;
+}
+
+bool TestStreamingUploadQueue() {
+    Logger::Info("=== Testing Streaming Upload Queue ===");
+
+    StreamingUploadSettings settings;
+    settings.bytesPerFrame = 1000;
+    settings.millisecondsPerFrame = 1000.0;
+
+    StreamingUploadQueue queue;
+    queue.SetSettings(settings);
+
+    auto makeChunks = [](uint32_t count, uint64_t size) {
+        std::vector<StreamingUploadQueue::UploadChunk> chunks(count);
+        for (auto& chunk : chunks) {
+            chunk.size = size;
+        }
+        return chunks;
+    };
+
+    int backgroundDone = 0;
+    int visibleDone = 0;
+    auto background = queue.Enqueue(UploadPriority::Background, makeChunks(2, 400), [&]() { backgroundDone++; });
+    auto visible = queue.Enqueue(UploadPriority::Visible, makeChunks(3, 400), [&]() { visibleDone++; });
+    bool passed = true;
+
+    // Frame 1: visible work goes first and stops at the byte budget
+    passed &= (queue.ProcessFrame(nullptr) == 2);
+    passed &= (queue.GetStats().pendingBytes[static_cast<size_t>(UploadPriority::Visible)] == 400);
+    passed &= (visibleDone == 0 && queue.IsPending(visible));
+
+    // Frame 2: the rest of the visible request, then background fills the budget
+    passed &= (queue.ProcessFrame(nullptr) == 2);
+    passed &= (visibleDone == 1 && !queue.IsPending(visible) && backgroundDone == 0);
+
+    // A chunk larger than the budget still makes progress on its own
+    queue.Enqueue(UploadPriority::Prefetch, makeChunks(1, 5000));
+    passed &= (queue.ProcessFrame(nullptr) == 1);
+    passed &= (queue.GetStats().lastFrameBytes == 5000 && queue.IsPending(background));
+
+    passed &= (queue.ProcessFrame(nullptr) == 1);
+    passed &= (backgroundDone == 1 && queue.IsEmpty() && queue.GetStats().completedRequests == 3);
+
+    if (passed) {
+        Logger::Info("OK - Streaming upload queue test completed successfully");
+    } else {
+        Logger::Error("ERROR - Streaming upload queue test failed");
+    }
+    return passed;
+}
+
+bool TestRenderModeSelector() {
+    Logger::Info("=== Testing Render Mode Selector ===");
+
+    RenderModeSelectorSettings settings;
+    settings.switchThreshold = 0.15f;
+    settings.confirmFrames = 3;
+    settings.minFramesBetweenSwitches = 5;
+    settings.calibrationSmoothing = 0.5f;
+
+    RenderModeSelector selector(GeometryPass::RenderMode::Forward, settings);
+    bool passed = true;
+
+    // With the default cost model forward wins with one light, deferred with many
+    RenderModeFrameInfo fewLights;
+    fewLights.width = 1920;
+    fewLights.height = 1080;
+    fewLights.lightCount = 1;
+    RenderModeFrameInfo manyLights = fewLights;
+    manyLights.lightCount = 16;
+    passed &= (selector.PredictCost(GeometryPass::RenderMode::Forward, fewLights) <
+               selector.PredictCost(GeometryPass::RenderMode::Deferred, fewLights));
+    passed &= (selector.PredictCost(GeometryPass::RenderMode::Deferred, manyLights) <
+               selector.PredictCost(GeometryPass::RenderMode::Forward, manyLights));
+
+    // Confirmation: a single cheaper frame in between restarts the count
+    selector.Update(manyLights);
+    selector.Update(manyLights);
+    selector.Update(fewLights);
+    selector.Update(manyLights);
+    passed &= (selector.Update(manyLights) == GeometryPass::RenderMode::Forward);
+    passed &= (selector.Update(manyLights) == GeometryPass::RenderMode::Deferred && selector.GetSwitchCount() == 1);
+
+    // Hysteresis: even after confirmation the mode is held for minFramesBetweenSwitches
+    for (int i = 0; i < 4; ++i) {
+        passed &= (selector.Update(fewLights) == GeometryPass::RenderMode::Deferred);
+    }
+    passed &= (selector.Update(fewLights) == GeometryPass::RenderMode::Forward && selector.GetSwitchCount() == 2);
+
+    // A cost difference below switchThreshold never starts a switch (deferred is ~9% cheaper at 4 lights)
+    RenderModeFrameInfo closeCosts = fewLights;
+    closeCosts.lightCount = 4;
+    passed &= (selector.PredictCost(GeometryPass::RenderMode::Deferred, closeCosts) <
+               selector.PredictCost(GeometryPass::RenderMode::Forward, closeCosts));
+    for (int i = 0; i < 20; ++i) {
+        passed &= (selector.Update(closeCosts) == GeometryPass::RenderMode::Forward);
+    }
+
+    // Calibration: measurements move the scale of the measured mode only
+    selector.Reset(GeometryPass::RenderMode::Forward);
+    float forwardCost = selector.PredictCost(GeometryPass::RenderMode::Forward, fewLights);
+    float deferredCost = selector.PredictCost(GeometryPass::RenderMode::Deferred, fewLights);
+
+    RenderModeFrameInfo measured = fewLights;
+    measured.measuredMode = GeometryPass::RenderMode::Forward;
+    measured.geometryPassMs = forwardCost * 3.0f;
+    selector.Update(measured);
+    passed &= (std::abs(selector.PredictCost(GeometryPass::RenderMode::Forward, fewLights) - forwardCost * 2.0f) < forwardCost * 0.01f);
+    passed &= (selector.PredictCost(GeometryPass::RenderMode::Deferred, fewLights) == deferredCost);
+
+    // Frames without a measurement keep the current calibration
+    RenderModeFrameInfo unmeasured = fewLights;
+    unmeasured.measuredMode = GeometryPass::RenderMode::Deferred;
+    selector.Update(unmeasured);
+    passed &= (selector.PredictCost(GeometryPass::RenderMode::Deferred, fewLights) == deferredCost);
+
+    // Forward measured three times slower than predicted makes deferred the better choice
+    for (int i = 0; i < 8; ++i) {
+        selector.Update(measured);
+    }
+    passed &= (selector.GetMode() == GeometryPass::RenderMode::Deferred && selector.GetSwitchCount() == 1);
+
+    if (passed) {
+        Logger::Info("OK - Render mode selector test completed successfully");
+    } else {
+        Logger::Error("ERROR - Render mode selector test failed");
+    }
+    return passed;
+}
+
+bool TestRenderGraphCompileAsync() {
+    Logger::Info("=== Testing Render Graph Background Compile ===");
+
+    // Records which thread runs Setup(); the graph never touches the GPU without resources
+    struct SetupRecordingPass : RenderPass {
+        std::thread::id callerThread;
+        int setupCount = 0;
+        bool setupOffCaller = false;
+
+        SetupRecordingPass(const std::string& name, std::thread::id caller)
+            : RenderPass(name), callerThread(caller) {}
+
+        void Setup(PassSetupData&) override {
+            setupCount++;
+            setupOffCaller |= (std::this_thread::get_id() != callerThread);
+        }
+        void Execute(const PassExecuteData&) override {}
+    };
+
+    // Enough passes that the worker is normally still busy right after CompileAsync() returns
+    constexpr uint32_t kPassCount = 4096;
+    RenderGraph graph(nullptr);
+    std::vector<SetupRecordingPass*> recorders;
+    for (uint32_t i = 0; i < kPassCount; ++i) {
+        auto pass = std::make_unique<SetupRecordingPass>("Pass" + std::to_string(i), std::this_thread::get_id());
+        recorders.push_back(pass.get());
+        graph.AddPass(std::move(pass));
+    }
+    bool passed = graph.Compile();
+
+    std::shared_ptr<const CompiledRenderGraph> previous = graph.GetCompiledGraph();
+    std::weak_ptr<const CompiledRenderGraph> previousRef = previous;
+    uint64_t previousVersion = graph.GetStats().compiledVersion;
+    passed &= (previous && previous->passes.size() == kPassCount);
+
+    // A second request while the worker runs is rejected; the running graph stays installed.
+    // If the worker wins the race the second call simply starts another compile, so retry
+    graph.SetPassEnabled(0, false);
+    graph.InvalidatePassSetup();
+    bool rejected = false;
+    for (int attempt = 0; attempt < 8 && !rejected; ++attempt) {
+        graph.WaitForCompile();
+        passed &= graph.CompileAsync();
+        rejected = !graph.CompileAsync();
+    }
+    passed &= rejected;
+    passed &= (graph.GetCompiledGraph() == previous);
+
+    // The finished graph is swapped in only at the frame boundary
+    passed &= graph.WaitForCompile();
+    passed &= (graph.GetCompiledGraph() == previous);
+    passed &= graph.ApplyPendingCompile();
+    passed &= !graph.ApplyPendingCompile();
+
+    std::shared_ptr<const CompiledRenderGraph> current = graph.GetCompiledGraph();
+    passed &= (current != previous && current->passes.size() == kPassCount - 1);
+    passed &= (graph.GetStats().compiledVersion > previousVersion && current->version > previous->version);
+
+    // A frame still holding the old graph keeps it intact until it lets go
+    passed &= (previous->passes.size() == kPassCount && previous->passes.front().pass != nullptr);
+    previous.reset();
+    passed &= previousRef.expired();
+
+    // Setup() ran again for the invalidated passes, always on the calling thread
+    for (SetupRecordingPass* recorder : recorders) {
+        passed &= (recorder->setupCount == 2 && !recorder->setupOffCaller);
+    }
+
+    if (passed) {
+        Logger::Info("OK - Render graph background compile test completed successfully");
+    } else {
+        Logger::Error("ERROR - Render graph background compile test failed");
+    }
+    return passed;
+}
+
+bool TestShaderCacheKey() {
+    Logger::Info("=== Testing Shader Cache Key ===");
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "AthenaShaderCacheTest";
+    std::filesystem::create_directories(directory);
+    auto writeFile = [&](const char* name, const char* text) {
+        std::ofstream(directory / name, std::ios::binary | std::ios::trunc) << text;
+    };
+
+    writeFile("Common.hlsli", "float4 Tint() { return 1; }\n");
+    writeFile("Test.hlsl", "#include \"Common.hlsli\"\nfloat4 main() : SV_Target { return Tint(); }\n");
+
+    ShaderCache cache;
+    ShaderDesc desc;
+    desc.filepath = (directory / "Test.hlsl").wstring();
+    desc.target = "ps_5_1";
+
+    bool passed = true;
+    uint64_t base = cache.ComputeHash(desc);
+    passed &= (cache.ComputeHash(desc) == base);
+
+    // Defines and target are part of the key
+    ShaderDesc withDefine = desc;
+    withDefine.defines.push_back({ "USE_TEXTURE", "1" });
+    passed &= (cache.ComputeHash(withDefine) != base);
+
+    ShaderDesc otherTarget = desc;
+    otherTarget.target = "ps_6_0";
+    passed &= (cache.ComputeHash(otherTarget) != base);
+
+    // Editing an included file invalidates the entry (per-file hashes are reused until the write time changes)
+    auto lastWriteTime = std::filesystem::last_write_time(directory / "Common.hlsli");
+    writeFile("Common.hlsli", "float4 Tint() { return 0.5; }\n");
+    std::filesystem::last_write_time(directory / "Common.hlsli", lastWriteTime + std::chrono::seconds(1));
+    uint64_t edited = cache.ComputeHash(desc);
+    passed &= (edited != base);
+
+    // A rewrite that keeps the write time is only picked up after an explicit reload
+    lastWriteTime = std::filesystem::last_write_time(directory / "Common.hlsli");
+    writeFile("Common.hlsli", "float4 Tint() { return 0.25; }\n");
+    std::filesystem::last_write_time(directory / "Common.hlsli", lastWriteTime);
+    passed &= (cache.ComputeHash(desc) == edited);
+    cache.ReloadSources();
+    passed &= (cache.ComputeHash(desc) != edited);
+
+    // Includes in comments and #if 0 blocks are not followed, and a missing include does not throw
+    writeFile("Inactive.hlsl",
+        "// #include \"Missing.hlsli\"\n"
+        "/* #include \"Missing.hlsli\" */\n"
+        "#if 0\n#include \"Missing.hlsli\"\n#else\n#include \"Common.hlsli\"\n#endif\n");
+    writeFile("Optional.hlsl", "#ifdef USE_EXTRA\n#include \"Missing.hlsli\"\n#endif\n");
+    ShaderDesc inactive = desc;
+    inactive.filepath = (directory / "Inactive.hlsl").wstring();
+    ShaderDesc optional = desc;
+    optional.filepath = (directory / "Optional.hlsl").wstring();
+    try {
+        uint64_t inactiveHash = cache.ComputeHash(inactive);
+        uint64_t optionalHash = cache.ComputeHash(optional);
+        writeFile("Missing.hlsli", "float4 Extra() { return 0; }\n");
+        passed &= (cache.ComputeHash(inactive) == inactiveHash);
+        passed &= (cache.ComputeHash(optional) != optionalHash);
+    }
+    catch (const std::exception&) {
+        passed = false;
+    }
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+
+    if (passed) {
+        Logger::Info("OK - Shader cache key test completed successfully");
+    } else {
+        Logger::Error("ERROR - Shader cache key test failed");
+    }
+    return passed;
+}
+
+bool TestPipelineCacheKey() {
+    Logger::Info("=== Testing Pipeline Cache Key ===");
+
+    const uint8_t vsBytes[] = { 1, 2, 3, 4 };
+    const uint8_t psBytes[] = { 5, 6, 7, 8 };
+    D3D12_INPUT_ELEMENT_DESC inputLayout[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+    };
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
+    desc.VS = { vsBytes, sizeof(vsBytes) };
+    desc.PS = { psBytes, sizeof(psBytes) };
+    desc.BlendState.RenderTarget[0].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+    desc.SampleMask = UINT_MAX;
+    desc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
+    desc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
+    desc.InputLayout = { inputLayout, 1 };
+    desc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+    desc.NumRenderTargets = 1;
+    desc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
+    desc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
+    desc.SampleDesc.Count = 1;
+
+    bool passed = true;
+    uint64_t base = PipelineCache::ComputeHash(desc);
+
+    // Shaders and semantics are compared by content, not by pointer
+    std::vector<uint8_t> vsCopy(vsBytes, vsBytes + sizeof(vsBytes));
+    std::string semanticCopy = "POSITION";
+    D3D12_INPUT_ELEMENT_DESC layoutCopy = inputLayout[0];
+    layoutCopy.SemanticName = semanticCopy.c_str();
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC copied = desc;
+    copied.VS = { vsCopy.data(), vsCopy.size() };
+    copied.InputLayout = { &layoutCopy, 1 };
+    passed &= (PipelineCache::ComputeHash(copied) == base);
+
+    // Unused render target slots are ignored
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC unusedSlot = desc;
+    unusedSlot.RTVFormats[3] = DXGI_FORMAT_D32_FLOAT;
+    passed &= (PipelineCache::ComputeHash(unusedSlot) == base);
+
+    // Formats, state and shader stages change the key
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC otherFormat = desc;
+    otherFormat.RTVFormats[0] = DXGI_FORMAT_R32G32B32_FLOAT;
+    passed &= (PipelineCache::ComputeHash(otherFormat) != base);
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC otherCull = desc;
+    otherCull.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
+    passed &= (PipelineCache::ComputeHash(otherCull) != base);
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC swapped = desc;
+    std::swap(swapped.VS, swapped.PS);
+    passed &= (PipelineCache::ComputeHash(swapped) != base);
+
+    passed &= (PipelineCache::MakePipelineName(base) == PipelineCache::MakePipelineName(PipelineCache::ComputeHash(copied)));
+    passed &= (PipelineCache::MakePipelineName(base).size() == 16);
+
+    if (passed) {
+        Logger::Info("OK - Pipeline cache key test completed successfully");
+    } else {
+        Logger::Error("ERROR - Pipeline cache key test failed");
+    }
+    return passed;
+}
+
+bool TestPipelineDescStorage() {
+    Logger::Info("=== Testing Pipeline Desc Storage ===");
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
+    uint64_t originalHash = 0;
+    auto storage = std::make_unique<GraphicsPipelineDescStorage>();
+    {
+        // The caller's shaders and input layout go away right after the request
+        std::vector<uint8_t> vsBytes = { 1, 2, 3, 4, 5 };
+        std::vector<uint8_t> psBytes = { 6, 7, 8 };
+        std::string semantic = "TEXCOORD";
+        D3D12_INPUT_ELEMENT_DESC inputLayout[] = {
+            {semantic.c_str(), 0, DXGI_FORMAT_R32G32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0},
+        };
+
+        desc.VS = { vsBytes.data(), vsBytes.size() };
+        desc.PS = { psBytes.data(), psBytes.size() };
+        desc.InputLayout = { inputLayout, 1 };
+        desc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+        desc.NumRenderTargets = 1;
+        desc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
+        desc.SampleDesc.Count = 1;
+
+        originalHash = PipelineCache::ComputeHash(desc);
+        storage->Assign(desc);
+    }
+
+    bool passed = true;
+    passed &= (PipelineCache::ComputeHash(storage->Get()) == originalHash);
+    passed &= (strcmp(storage->Get().InputLayout.pInputElementDescs[0].SemanticName, "TEXCOORD") == 0);
+
+    // Prewarm list round trip
+    std::vector<char> bytes;
+    storage->Serialize(bytes);
+    storage.reset();
+
+    GraphicsPipelineDescStorage restored;
+    const char* cursor = bytes.data();
+    passed &= restored.Deserialize(cursor, bytes.data() + bytes.size());
+    passed &= (cursor == bytes.data() + bytes.size());
+    passed &= (PipelineCache::ComputeHash(restored.Get()) == originalHash);
+    passed &= (restored.Get().pRootSignature == nullptr);
+
+    // Truncated data is rejected
+    GraphicsPipelineDescStorage truncated;
+    cursor = bytes.data();
+    passed &= !truncated.Deserialize(cursor, bytes.data() + bytes.size() - 1);
+
+    if (passed) {
+        Logger::Info("OK - Pipeline desc storage test completed successfully");
+    } else {
+        Logger::Error("ERROR - Pipeline desc storage test failed");
+    }
+    return passed;
+}
+
+bool TestShaderPermutationArchive() {
+    Logger::Info("=== Testing Shader Permutation Archive ===");
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "AthenaShaderArchiveTest";
+    std::filesystem::create_directories(directory);
+    auto writeSource = [&](const char* text) {
+        std::ofstream(directory / "Test.hlsl", std::ios::binary | std::ios::trunc) << text;
+    };
+    writeSource("float4 main() : SV_Target { return USE_TEXTURE; }\n");
+
+    ShaderPermutationDesc desc;
+    desc.filepath = (directory / "Test.hlsl").wstring();
+    desc.target = "ps_5_1";
+    desc.keywords = { "DEFERRED", "USE_TEXTURE" };
+
+    bool passed = true;
+    ShaderPermutationSet set;
+    set.Initialize(desc);
+    passed &= (set.GetPermutationCount() == 4);
+    passed &= (set.GetKeywordMask("DEFERRED") == 1u);
+    passed &= (set.GetKeywordMask("USE_TEXTURE") == 2u);
+
+    // Every keyword is defined, so the shader can use #if instead of #ifdef
+    std::vector<ShaderDefine> defines = set.MakeDefines(2);
+    passed &= (defines.size() == 2 && defines[0].value == "0" && defines[1].value == "1");
+
+    // Fake bytecode for each variant (the offline build compiles these), added out of order
+    ShaderArchiveWriter writer;
+    writer.AddSet(set.GetId(), ShaderCache::ComputeSourceHash(desc.filepath));
+    for (ShaderPermutationKey key = 4; key-- > 0;) {
+        uint8_t bytecode[5] = { 0xDB, 0xC0, uint8_t(key), uint8_t(key), uint8_t(key) };
+        writer.AddShader(set.GetId(), key, bytecode, 4 + (key & 1));
+    }
+    std::vector<char> bytes = writer.Build();
+
+    ShaderArchive archive;
+    passed &= archive.OpenMemory(bytes.data(), bytes.size());
+    passed &= (archive.GetShaderCount() == 4);
+
+    D3D12_SHADER_BYTECODE found = archive.Find(set.GetId(), 1);
+    passed &= (found.BytecodeLength == 5 && static_cast<const uint8_t*>(found.pShaderBytecode)[2] == 1);
+    passed &= (archive.Find(set.GetId(), 4).pShaderBytecode == nullptr);
+    passed &= (archive.Find(set.GetId() + 1, 0).pShaderBytecode == nullptr);
+
+    // Variants come from the archive without compiling
+    ShaderPermutationSet archived;
+    archived.Initialize(desc, &archive);
+    passed &= archived.IsLoaded(0) && archived.IsLoaded(3);
+    passed &= (archived.Get(1).pShaderBytecode == found.pShaderBytecode);
+
+    // Editing the source makes the archive stale
+    writeSource("float4 main() : SV_Target { return 0.5; }\n");
+    ShaderPermutationSet stale;
+    stale.Initialize(desc, &archive);
+    passed &= !stale.IsLoaded(1);
+
+    // Truncated or foreign data is rejected
+    ShaderArchive truncated;
+    passed &= !truncated.OpenMemory(bytes.data(), bytes.size() - 1);
+    passed &= !truncated.OpenMemory(bytes.data(), sizeof(ShaderArchive::Header) + 1);
+    bytes[0] ^= 0xFF;
+    passed &= !truncated.OpenMemory(bytes.data(), bytes.size());
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+
+    if (passed) {
+        Logger::Info("OK - Shader permutation archive test completed successfully");
+    } else {
+        Logger::Error("ERROR - Shader permutation archive test failed");
+    }
+    return passed;
+}
+
+bool TestRootSignatureKey() {
+    Logger::Info("=== Testing Root Signature Key ===");
+
+    // Two passes describing the same CBV + SRV table + sampler layout with their own arrays
+    struct Layout {
+        D3D12_DESCRIPTOR_RANGE range = {};
+        D3D12_ROOT_PARAMETER parameters[2] = {};
+        D3D12_STATIC_SAMPLER_DESC sampler = {};
+        D3D12_ROOT_SIGNATURE_DESC desc = {};
+
+        Layout() {
+            parameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+            parameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+            range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+            range.NumDescriptors = 1;
+            parameters[1].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            parameters[1].DescriptorTable.NumDescriptorRanges = 1;
+            parameters[1].DescriptorTable.pDescriptorRanges = &range;
+            parameters[1].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+            sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
+            sampler.MaxLOD = D3D12_FLOAT32_MAX;
+            sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+            desc.NumParameters = 2;
+            desc.pParameters = parameters;
+            desc.NumStaticSamplers = 1;
+            desc.pStaticSamplers = &sampler;
+        }
+    };
+
+    Layout a;
+    Layout b;
+    bool passed = true;
+    uint64_t base = RootSignatureCache::ComputeHash(a.desc);
+    passed &= (RootSignatureCache::ComputeHash(b.desc) == base);
+
+    // The table size, sampler register and flags are part of the key
+    b.range.NumDescriptors = 3;
+    passed &= (RootSignatureCache::ComputeHash(b.desc) != base);
+    b.range.NumDescriptors = 1;
+
+    b.sampler.ShaderRegister = 1;
+    passed &= (RootSignatureCache::ComputeHash(b.desc) != base);
+    b.sampler.ShaderRegister = 0;
+
+    b.desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+    passed &= (RootSignatureCache::ComputeHash(b.desc) != base);
+    b.desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
+
+    b.parameters[0].Descriptor.ShaderRegister = 1;
+    passed &= (RootSignatureCache::ComputeHash(b.desc) != base);
+
+    if (passed) {
+        Logger::Info("OK - Root signature key test completed successfully");
+    } else {
+        Logger::Error("ERROR - Root signature key test failed");
+    }
+    return passed;
+}
+
+// Test Scene Component Storage (no device required)
+bool TestSceneStorage() {
+    Logger::Info("=== Testing Scene Component Storage ===");
+
+    Scene scene("StorageTest");
+    bool passed = true;
+
+    SceneObject objectA("A");
+    objectA.SetPosition(Vector3(1.0f, 0.0f, 0.0f));
+    SceneObject objectB("B");
+    objectB.SetPosition(Vector3(2.0f, 0.0f, 0.0f));
+    SceneObject objectC("C");
+    objectC.SetPosition(Vector3(3.0f, 0.0f, 0.0f));
+
+    SceneHandle a = scene.AddObject(objectA);
+    SceneHandle b = scene.AddObject(objectB);
+    SceneHandle c = scene.AddObject(objectC);
+    passed &= (scene.GetObjectCount() == 3);
+    passed &= (scene.FindObject("B") == b);
+
+    // Same material is stored once
+    passed &= (scene.GetMaterials().size() == 1);
+
+    // Removing from the middle keeps the arrays packed and the other handles valid
+    scene.RemoveObject(a);
+    passed &= !scene.IsAlive(a);
+    passed &= !scene.FindObject("A").IsValid();
+    passed &= (scene.GetObjectCount() == 2);
+    passed &= (scene.GetComponentIndex(c) == 0);
+    passed &= (scene.GetPosition(c).x == 3.0f && scene.GetPosition(b).x == 2.0f);
+
+    // The freed slot is reused with a new generation, so the stale handle stays invalid
+    SceneObject objectD("D");
+    SceneHandle d = scene.AddObject(objectD);
+    passed &= (d.index == a.index && d.generation != a.generation);
+    passed &= !scene.IsAlive(a);
+    try {
+        scene.GetPosition(a);
+        passed = false;
+    } catch (const std::invalid_argument&) {
+    }
+
+    // World bounds follow the transform after the update pass
+    scene.SetPosition(b, Vector3(0.0f, 5.0f, 0.0f));
+    scene.UpdateTransforms();
+    Vector3 boundsMin, boundsMax;
+    scene.GetWorldBounds(b, boundsMin, boundsMax);
+    passed &= (boundsMin.y == 5.0f && boundsMax.y == 5.0f);
+    passed &= (scene.FindNearestObject(Vector3(0.0f, 4.0f, 0.0f)) == b);
+
+    std::vector<SceneHandle> hits = scene.RayIntersect(Vector3(-10.0f, 0.0f, 0.0f), Vector3(1.0f, 0.0f, 0.0f));
+    passed &= (hits.size() == 2 && hits[0] == d && hits[1] == c);
+
+    scene.SetVisible(c, false);
+    passed &= (scene.GetVisibleObjects(nullptr).size() == 2);
+
+    scene.ClearObjects();
+    passed &= (scene.GetObjectCount() == 0 && !scene.IsAlive(b) && !scene.FindObject("B").IsValid());
+
+    if (passed) {
+        Logger::Info("OK - Scene storage test completed successfully");
+    } else {
+        Logger::Error("ERROR - Scene storage test failed");
+    }
+    return passed;
+}
+
+// Test Scene BVH Queries (no device required)
+bool TestSceneBVH() {
+    Logger::Info("=== Testing Scene BVH ===");
+
+    // Deterministic pseudo-random boxes
+    TestRandom random(12345);
+
+    const uint32_t count = 2000;
+    std::vector<Vector3> boundsMin(count);
+    std::vector<Vector3> boundsMax(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        Vector3 center(random.NextFloat(200.0f), random.NextFloat(200.0f), random.NextFloat(200.0f));
+        Vector3 half(0.5f + random.NextFloat(2.0f), 0.5f + random.NextFloat(2.0f), 0.5f + random.NextFloat(2.0f));
+        boundsMin[i] = center - half;
+        boundsMax[i] = center + half;
+    }
+
+    // Axis-aligned box region expressed as six inward-facing planes
+    Vector4 planes[6] = {
+        Vector4(1.0f, 0.0f, 0.0f, -50.0f), Vector4(-1.0f, 0.0f, 0.0f, 120.0f),
+        Vector4(0.0f, 1.0f, 0.0f, -30.0f), Vector4(0.0f, -1.0f, 0.0f, 150.0f),
+        Vector4(0.0f, 0.0f, 1.0f, 0.0f), Vector4(0.0f, 0.0f, -1.0f, 90.0f),
+    };
+    Vector3 rayOrigin(-10.0f, 100.0f, 100.0f);
+    Vector3 point(80.0f, 60.0f, 140.0f);
+
+    // Compares every query against a linear scan
+    auto matchesLinearScan = [&](const SceneBVH& bvh) {
+        std::vector<uint32_t> visible;
+        bvh.QueryFrustum(planes, visible);
+        std::sort(visible.begin(), visible.end());
+        std::vector<uint32_t> expectedVisible;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (boundsMax[i].x >= 50.0f && boundsMin[i].x <= 120.0f &&
+                boundsMax[i].y >= 30.0f && boundsMin[i].y <= 150.0f &&
+                boundsMax[i].z >= 0.0f && boundsMin[i].z <= 90.0f) {
+                expectedVisible.push_back(i);
+            }
+        }
+
+        // Aim at the first object so the ray hits at least once
+        Vector3 rayDirection = (boundsMin[0] + boundsMax[0]) * 0.5f - rayOrigin;
+        std::vector<std::pair<float, uint32_t>> hits;
+        bvh.QueryRay(rayOrigin, rayDirection, hits);
+        std::vector<uint32_t> hitIndices;
+        for (const auto& hit : hits) {
+            hitIndices.push_back(hit.second);
+        }
+        std::sort(hitIndices.begin(), hitIndices.end());
+        std::vector<uint32_t> expectedHits;
+        float nearestDistance = FLT_MAX;
+        for (uint32_t i = 0; i < count; ++i) {
+            float distance;
+            if (SceneBVH::IntersectRay(rayOrigin, rayDirection, boundsMin[i], boundsMax[i], distance)) {
+                expectedHits.push_back(i);
+            }
+            nearestDistance = (std::min)(nearestDistance, SceneBVH::DistanceSquared(point, boundsMin[i], boundsMax[i]));
+        }
+
+        uint32_t nearest = bvh.FindNearest(point);
+        return visible == expectedVisible && !expectedVisible.empty() &&
+               hitIndices == expectedHits && !expectedHits.empty() &&
+               nearest != SceneBVH::InvalidIndex &&
+               SceneBVH::DistanceSquared(point, boundsMin[nearest], boundsMax[nearest]) == nearestDistance;
+    };
+
+    SceneBVH bvh;
+    bvh.Build(boundsMin.data(), boundsMax.data(), count);
+    bool passed = true;
+    passed &= (bvh.GetItemCount() == count && bvh.GetNodes().size() < 2 * count);
+    passed &= matchesLinearScan(bvh);
+
+    // Small moves are absorbed by a refit without losing much quality
+    for (uint32_t i = 0; i < count; i += 10) {
+        Vector3 delta(random.NextFloat(2.0f) - 1.0f, random.NextFloat(2.0f) - 1.0f, random.NextFloat(2.0f) - 1.0f);
+        boundsMin[i] += delta;
+        boundsMax[i] += delta;
+    }
+    bvh.Refit(boundsMin.data(), boundsMax.data());
+    passed &= matchesLinearScan(bvh);
+    passed &= !bvh.NeedsRebuild();
+
+    // Scattering every object keeps refit correct but asks for a rebuild
+    for (uint32_t i = 0; i < count; ++i) {
+        Vector3 center(random.NextFloat(200.0f), random.NextFloat(200.0f), random.NextFloat(200.0f));
+        Vector3 half = (boundsMax[i] - boundsMin[i]) * 0.5f;
+        boundsMin[i] = center - half;
+        boundsMax[i] = center + half;
+    }
+    bvh.Refit(boundsMin.data(), boundsMax.data());
+    passed &= matchesLinearScan(bvh);
+    passed &= bvh.NeedsRebuild();
+
+    // Coincident objects are still split into small leaves
+    std::vector<Vector3> samePoint(100, Vector3(1.0f, 2.0f, 3.0f));
+    bvh.Build(samePoint.data(), samePoint.data(), 100);
+    uint32_t largestLeaf = 0;
+    for (const SceneBVH::Node& node : bvh.GetNodes()) {
+        largestLeaf = (std::max)(largestLeaf, node.count);
+    }
+    passed &= (largestLeaf <= SceneBVH::ForcedLeafSize);
+
+    if (passed) {
+        Logger::Info("OK - Scene BVH test completed successfully");
+    } else {
+        Logger::Error("ERROR - Scene BVH test failed");
+    }
+    return passed;
+}
+
+// Test Frustum Culling Kernels (no device required)
+bool TestFrustumCulling() {
+    Logger::Info("=== Testing Frustum Culling ===");
+
+    bool passed = true;
+
+    // Default camera: at the origin looking down +Z, 45 degree FOV, far plane at 1000
+    DummyCamera camera;
+    Vector4 planes[6];
+    FrustumCuller::ExtractPlanes(camera.GetViewMatrix() * camera.GetProjectionMatrix(), planes);
+    auto pointInside = [&planes](const Vector3& point) {
+        return FrustumCuller::Intersects(planes, point, point);
+    };
+    passed &= pointInside(Vector3(0.0f, 0.0f, 10.0f));
+    passed &= !pointInside(Vector3(0.0f, 0.0f, -1.0f));
+    passed &= !pointInside(Vector3(0.0f, 0.0f, 2000.0f));
+    passed &= !pointInside(Vector3(100.0f, 0.0f, 10.0f));
+    passed &= !pointInside(Vector3(0.0f, -100.0f, 10.0f));
+
+    // Every SIMD kernel matches the scalar test, including the partial last block
+    TestRandom random(777);
+    const uint32_t count = 1003;
+    std::vector<Vector3> boundsMin(count);
+    std::vector<Vector3> boundsMax(count);
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < count; ++i) {
+        Vector3 center(random.NextFloat(400.0f) - 200.0f, random.NextFloat(400.0f) - 200.0f, random.NextFloat(400.0f) - 100.0f);
+        Vector3 half(random.NextFloat(5.0f), random.NextFloat(5.0f), random.NextFloat(5.0f));
+        boundsMin[i] = center - half;
+        boundsMax[i] = center + half;
+        if (FrustumCuller::Intersects(planes, boundsMin[i], boundsMax[i])) {
+            expected.push_back(i);
+        }
+    }
+    passed &= !expected.empty() && expected.size() < count;
+
+    FrustumCuller culler;
+    culler.Assign(boundsMin.data(), boundsMax.data(), count);
+    for (FrustumCuller::Kernel kernel : { FrustumCuller::Kernel::Scalar, FrustumCuller::Kernel::SSE,
+                                          FrustumCuller::Kernel::AVX, FrustumCuller::Kernel::NEON }) {
+        if (!FrustumCuller::IsKernelSupported(kernel)) {
+            continue;
+        }
+        std::vector<uint32_t> visible(count);
+        visible.resize(culler.Cull(planes, visible.data(), kernel));
+        if (visible != expected) {
+            Logger::Error("Culling kernel %s disagrees with the scalar test", FrustumCuller::GetKernelName(kernel));
+            passed = false;
+        }
+    }
+    Logger::Info("Culling kernel: %s", FrustumCuller::GetKernelName(FrustumCuller::GetBestKernel()));
+
+    // Scene uses the camera frustum for its visible list
+    Scene scene("CullingTest");
+    SceneObject front("Front");
+    front.SetPosition(Vector3(0.0f, 0.0f, 10.0f));
+    SceneObject behind("Behind");
+    behind.SetPosition(Vector3(0.0f, 0.0f, -10.0f));
+    SceneHandle frontHandle = scene.AddObject(front);
+    scene.AddObject(behind);
+    scene.UpdateTransforms();
+    std::vector<SceneHandle> visibleObjects = scene.GetVisibleObjects(&camera);
+    passed &= (visibleObjects.size() == 1 && visibleObjects[0] == frontHandle);
+
+    // Moving an object updates the culling bounds in place
+    scene.SetPosition(frontHandle, Vector3(0.0f, 0.0f, -20.0f));
+    scene.UpdateTransforms();
+    passed &= scene.GetVisibleObjects(&camera).empty();
+
+    if (passed) {
+        Logger::Info("OK - Frustum culling test completed successfully");
+    } else {
+        Logger::Error("ERROR - Frustum culling test failed");
+    }
+    return passed;
+}
+
+// Test Job System and Parallel Culling (no device required)
+bool TestParallelCulling() {
+    Logger::Info("=== Testing Parallel Culling ===");
+
+    bool passed = true;
+    JobSystem jobSystem;
+    jobSystem.Initialize(3);
+
+    // Every job index runs exactly once, nested calls run inline
+    std::vector<uint32_t> runCounts(1000, 0);
+    std::atomic<uint32_t> nestedJobs{ 0 };
+    jobSystem.ParallelFor(static_cast<uint32_t>(runCounts.size()), [&](uint32_t job) {
+        runCounts[job]++;
+        if (job % 100 == 0) {
+            jobSystem.ParallelFor(4, [&](uint32_t) { nestedJobs++; });
+        }
+    });
+    passed &= std::all_of(runCounts.begin(), runCounts.end(), [](uint32_t count) { return count == 1; });
+    passed &= (nestedJobs.load() == 40);
+
+    // The first exception is rethrown on the calling thread after all jobs finish
+    std::atomic<uint32_t> finishedJobs{ 0 };
+    try {
+        jobSystem.ParallelFor(64, [&](uint32_t job) {
+            if (job == 7) {
+                throw std::runtime_error("job failed");
+            }
+            finishedJobs++;
+        });
+        passed = false;
+    } catch (const std::runtime_error&) {
+        passed &= (finishedJobs.load() == 63);
+    }
+
+    // Visible lists are identical with and without workers, across several chunks
+    Scene scene("ParallelCullingTest");
+    TestRandom random(4242);
+    for (uint32_t i = 0; i < 20000; ++i) {
+        SceneObject object("Object" + std::to_string(i));
+        object.SetPosition(Vector3(random.NextFloat(200.0f) - 100.0f, random.NextFloat(200.0f) - 100.0f, random.NextFloat(200.0f) - 50.0f));
+        SceneHandle handle = scene.AddObject(object);
+        scene.SetVisible(handle, i % 7 != 0);
+        scene.SetTransparent(handle, i % 3 == 0);
+    }
+    scene.UpdateTransforms();
+
+    DummyCamera camera;
+    std::vector<SceneHandle> sequentialVisible = scene.GetVisibleObjects(&camera);
+    std::vector<SceneHandle> sequentialTransparent = scene.GetTransparentObjects(&camera);
+    JobSystem::SetGlobal(&jobSystem);
+    std::vector<SceneHandle> parallelVisible = scene.GetVisibleObjects(&camera);
+    std::vector<SceneHandle> parallelTransparent = scene.GetTransparentObjects(&camera);
+    JobSystem::SetGlobal(nullptr);
+
+    passed &= !sequentialVisible.empty() && sequentialVisible.size() < scene.GetObjectCount();
+    passed &= (parallelVisible == sequentialVisible);
+    passed &= !sequentialTransparent.empty() && (parallelTransparent == sequentialTransparent);
+    for (size_t i = 1; i < parallelVisible.size(); ++i) {
+        passed &= scene.GetComponentIndex(parallelVisible[i - 1]) < scene.GetComponentIndex(parallelVisible[i]);
+    }
+
+    if (passed) {
+        Logger::Info("OK - Parallel culling test completed successfully");
+    } else {
+        Logger::Error("ERROR - Parallel culling test failed");
+    }
+    return passed;
+}
+
+// Test Scene Hierarchy (no device required)
+bool TestSceneHierarchy() {
+    Logger::Info("=== Testing Scene Hierarchy ===");
+
+    bool passed = true;
+    auto nearlyEqual = [](float a, float b) { return std::fabs(a - b) < 1e-4f; };
+    auto sameMatrix = [&](const Matrix4x4& a, const Matrix4x4& b) {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                if (!nearlyEqual(a.m[i][j], b.m[i][j])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    // The expanded local matrix matches T * Rz * Rx * Ry * S, and decomposing it gives the same matrix back
+    Transform transform;
+    transform.position = Vector3(1.0f, -2.0f, 3.0f);
+    transform.rotation = Vector3(30.0f, -45.0f, 60.0f);
+    transform.scale = Vector3(2.0f, 0.5f, 1.5f);
+    const float toRadians = PI / 180.0f;
+    Matrix4x4 expected = Matrix4x4::Translation(transform.position) *
+                         Matrix4x4::RotationZ(transform.rotation.z * toRadians) *
+                         Matrix4x4::RotationX(transform.rotation.x * toRadians) *
+                         Matrix4x4::RotationY(transform.rotation.y * toRadians) *
+                         Matrix4x4::Scaling(transform.scale);
+    passed &= sameMatrix(transform.GetWorldMatrix(), expected);
+    passed &= sameMatrix(Transform::FromMatrix(expected).GetWorldMatrix(), expected);
+
+    // Children are placed in the parent's space
+    Scene scene("HierarchyTest");
+    SceneObject parentObject("Parent");
+    parentObject.SetPosition(Vector3(10.0f, 0.0f, 0.0f));
+    SceneObject childObject("Child");
+    childObject.SetPosition(Vector3(1.0f, 0.0f, 0.0f));
+    SceneObject grandchildObject("Grandchild");
+    grandchildObject.SetPosition(Vector3(0.0f, 1.0f, 0.0f));
+    SceneObject otherObject("Other");
+
+    SceneHandle parent = scene.AddObject(parentObject);
+    SceneHandle child = scene.AddObject(childObject, parent);
+    SceneHandle grandchild = scene.AddObject(grandchildObject, child);
+    SceneHandle other = scene.AddObject(otherObject);
+    scene.UpdateTransforms();
+    passed &= nearlyEqual(scene.GetWorldMatrix(child).m[0][3], 11.0f);
+    passed &= nearlyEqual(scene.GetWorldMatrix(grandchild).m[1][3], 1.0f);
+    passed &= (scene.GetParent(grandchild) == child);
+    passed &= (scene.GetChildren(parent) == std::vector<SceneHandle>{ child });
+
+    // Changing the parent moves only its subtree
+    const SceneComponents& components = scene.GetComponents();
+    scene.SetScale(parent, Vector3(2.0f, 2.0f, 2.0f));
+    scene.UpdateTransforms();
+    auto worldChanged = [&](SceneHandle handle) {
+        return (components.flags[scene.GetComponentIndex(handle)] & SceneComponents::WorldChanged) != 0;
+    };
+    passed &= nearlyEqual(scene.GetWorldMatrix(child).m[0][3], 12.0f);
+    passed &= nearlyEqual(scene.GetWorldMatrix(grandchild).m[1][3], 2.0f);
+    passed &= worldChanged(parent) && worldChanged(child) && worldChanged(grandchild) && !worldChanged(other);
+    Vector3 boundsMin, boundsMax;
+    scene.GetWorldBounds(grandchild, boundsMin, boundsMax);
+    passed &= nearlyEqual(boundsMin.x, 12.0f) && nearlyEqual(boundsMin.y, 2.0f);
+
+    // Nothing changed, so the next update clears the flags
+    scene.UpdateTransforms();
+    passed &= !worldChanged(parent) && !worldChanged(grandchild);
+
+    // Re-parenting under a later object reorders the arrays so parents stay in front
+    scene.SetPosition(other, Vector3(0.0f, 0.0f, 5.0f));
+    scene.SetParent(parent, other);
+    scene.UpdateTransforms();
+    passed &= scene.GetComponentIndex(other) < scene.GetComponentIndex(parent);
+    passed &= scene.GetComponentIndex(child) < scene.GetComponentIndex(grandchild);
+    for (uint32_t i = 0; i < components.Size(); ++i) {
+        passed &= (components.parents[i] == SceneComponents::InvalidId || components.parents[i] < i);
+    }
+    passed &= nearlyEqual(scene.GetWorldMatrix(grandchild).m[2][3], 5.0f);
+    passed &= (scene.FindObject("Child") == child);
+
+    // A descendant cannot become the parent
+    try {
+        scene.SetParent(other, grandchild);
+        passed = false;
+    } catch (const std::invalid_argument&) {
+    }
+
+    // Removing a node removes its subtree
+    scene.RemoveObject(parent);
+    passed &= !scene.IsAlive(parent) && !scene.IsAlive(child) && !scene.IsAlive(grandchild);
+    passed &= scene.IsAlive(other) && (scene.GetObjectCount() == 1);
+    passed &= !scene.FindObject("Grandchild").IsValid();
+
+    // Model nodes keep their file hierarchy under a root carrying the model transform
+    auto model = std::make_shared<Model>();
+    ModelNode rootNode;
+    rootNode.name = "Root";
+    rootNode.localMatrix = Matrix4x4::Translation(0.0f, 3.0f, 0.0f);
+    ModelNode armNode;
+    armNode.name = "Arm";
+    armNode.localMatrix = Matrix4x4::Translation(4.0f, 0.0f, 0.0f);
+    armNode.parent = 0;
+    model->nodes = { rootNode, armNode };
+
+    auto modelObject = std::make_shared<ModelObject>("Robot");
+    modelObject->SetModel(model);
+    modelObject->GetTransform().position = Vector3(0.0f, 0.0f, -1.0f);
+    std::vector<SceneHandle> modelHandles = scene.AddModel(modelObject);
+    scene.UpdateTransforms();
+    passed &= (modelHandles.size() == 3);
+    if (modelHandles.size() == 3) {
+        passed &= (scene.GetParent(modelHandles[2]) == modelHandles[1]);
+        const Matrix4x4& arm = scene.GetWorldMatrix(modelHandles[2]);
+        passed &= nearlyEqual(arm.m[0][3], 4.0f) && nearlyEqual(arm.m[1][3], 3.0f) && nearlyEqual(arm.m[2][3], -1.0f);
+        passed &= (scene.GetObjectName(modelHandles[2]) == "Robot_Arm");
+    }
+
+    if (passed) {
+        Logger::Info("OK - Scene hierarchy test completed successfully");
+    } else {
+        Logger::Error("ERROR - Scene hierarchy test failed");
+    }
+    return passed;
+}
+
+// Test Draw Sort Keys and Radix Sort (no device required)
+bool TestDrawSortKeys() {
+    Logger::Info("=== Testing Draw Sort Keys ===");
+
+    bool passed = true;
+
+    // Depth quantization keeps the order of view depths; behind the camera and NaN map to 0
+    uint32_t previousDepth = 0;
+    for (float depth = 0.01f; depth < 10000.0f; depth *= 1.37f) {
+        uint32_t quantized = DrawQueue::QuantizeDepth(depth);
+        passed &= (quantized >= previousDepth) && (quantized < (1u << DrawQueue::DepthBits));
+        previousDepth = quantized;
+    }
+    passed &= (DrawQueue::QuantizeDepth(-1.0f) == 0) && (DrawQueue::QuantizeDepth(std::nanf("")) == 0);
+
+    // Opaque keys group by state first and go front to back inside a state; transparent keys go back to front
+    uint32_t nearDepth = DrawQueue::QuantizeDepth(2.0f);
+    uint32_t farDepth = DrawQueue::QuantizeDepth(200.0f);
+    passed &= DrawQueue::MakeOpaqueKey(0, 5, 1, nearDepth) < DrawQueue::MakeOpaqueKey(0, 5, 1, farDepth);
+    passed &= DrawQueue::MakeOpaqueKey(0, 5, 1, farDepth) < DrawQueue::MakeOpaqueKey(0, 5, 2, nearDepth);
+    passed &= DrawQueue::MakeOpaqueKey(0, 9, 9, farDepth) < DrawQueue::MakeOpaqueKey(1, 0, 0, nearDepth);
+    passed &= DrawQueue::MakeTransparentKey(3, 9, 9, farDepth) < DrawQueue::MakeTransparentKey(0, 0, 0, nearDepth);
+
+    // The radix sort gives the same order as a stable comparison sort for several key distributions
+    TestRandom random(777);
+    for (uint32_t distribution = 0; distribution < 4; ++distribution) {
+        DrawQueue queue;
+        for (uint32_t i = 0; i < 5000; ++i) {
+            uint64_t key = 0;
+            if (distribution == 0) {
+                key = (static_cast<uint64_t>(random.Next()) << 40) ^ (static_cast<uint64_t>(random.Next()) << 16) ^ random.Next();
+            } else if (distribution == 1) {
+                key = DrawQueue::MakeOpaqueKey(random.Next() % 4, random.Next() % 50, random.Next() % 300,
+                                               DrawQueue::QuantizeDepth(static_cast<float>(random.Next() % 10000) * 0.1f));
+            } else if (distribution == 2) {
+                // Varying bits scattered over the whole key (more bit runs than the sort extracts at once)
+                for (uint32_t bit = 0; bit < 64; bit += 9) {
+                    key |= static_cast<uint64_t>(random.Next() & 1) << bit;
+                }
+            } else {
+                key = 42;
+            }
+            queue.Push(key, i);
+        }
+
+        std::vector<DrawQueue::Item> expected = queue.GetItems();
+        std::stable_sort(expected.begin(), expected.end(),
+            [](const DrawQueue::Item& a, const DrawQueue::Item& b) { return a.key < b.key; });
+        queue.Sort();
+        for (uint32_t i = 0; i < queue.Size(); ++i) {
+            passed &= (queue.GetItems()[i].key == expected[i].key) &&
+                      (queue.GetItems()[i].componentIndex == expected[i].componentIndex);
+        }
+    }
+
+    // Scene draw lists: meshless objects are skipped, opaque draws share state runs, transparent draws go far to near
+    Scene scene("DrawSortTest");
+    std::shared_ptr<Mesh> cube = MeshGenerator::CreateCube(1.0f);
+    std::shared_ptr<Mesh> sphere = MeshGenerator::CreateSphere(0.5f, 8, 4);
+    MaterialData red;
+    red.name = "Red";
+    MaterialData blue;
+    blue.name = "Blue";
+    std::vector<SceneHandle> transparentHandles;
+    for (uint32_t i = 0; i < 12; ++i) {
+        SceneObject object("Draw" + std::to_string(i));
+        object.SetPosition(Vector3(0.0f, 0.0f, 5.0f + static_cast<float>((i * 7) % 12) * 3.0f));
+        object.SetMesh(i % 2 == 0 ? cube : sphere);
+        object.SetMaterial(i % 3 == 0 ? red : blue);
+        SceneHandle handle = scene.AddObject(object);
+        if (i % 4 == 3) {
+            scene.SetTransparent(handle, true);
+            transparentHandles.push_back(handle);
+        }
+    }
+    scene.AddObject(SceneObject("Empty"));
+    scene.UpdateTransforms();
+
+    DummyCamera camera;
+    DrawQueue opaque;
+    DrawQueue transparent;
+    scene.BuildDrawQueues(&camera, opaque, transparent);
+    passed &= (opaque.Size() == 9) && (transparent.Size() == transparentHandles.size());
+
+    const SceneComponents& components = scene.GetComponents();
+    uint32_t stateChanges = 0;
+    for (uint32_t i = 1; i < opaque.Size(); ++i) {
+        uint32_t previous = opaque.GetItems()[i - 1].componentIndex;
+        uint32_t current = opaque.GetItems()[i].componentIndex;
+        bool sameState = components.materialIds[previous] == components.materialIds[current] &&
+                         components.meshIds[previous] == components.meshIds[current];
+        stateChanges += sameState ? 0 : 1;
+        if (sameState) {
+            passed &= components.positions[previous].z <= components.positions[current].z;
+        }
+    }
+    passed &= (stateChanges == 3);    // 2 materials x 2 meshes
+    for (uint32_t i = 1; i < transparent.Size(); ++i) {
+        passed &= components.positions[transparent.GetItems()[i - 1].componentIndex].z >=
+                  components.positions[transparent.GetItems()[i].componentIndex].z;
+    }
+
+    if (passed) {
+        Logger::Info("OK - Draw sort key test completed successfully");
+    } else {
+        Logger::Error("ERROR - Draw sort key test failed");
+    }
+    return passed;
+}
+
 // Run all feature tests
 bool RunFeatureTests(std::shared_ptr<Device> device) {
     Logger::Info("Starting all feature tests...");
@@ -228,6 +1758,116 @@ bool RunFeatureTests(std::shared_ptr<Device> device) {
     if (!TestMultiMeshRendering(device)) {
         allTestsPassed = false;
     }
+
+    // Test 4: Upload Ring Buffer Allocation
+    if (!TestRingBufferAllocator()) {
+        allTestsPassed = false;
+    }
+
+    // Test 5: TLSF Placed Resource Allocation
+    if (!TestTlsfAllocator()) {
+        allTestsPassed = false;
+    }
+
+    // Test 6: Descriptor Index Allocation
+    if (!TestDescriptorIndexAllocator()) {
+        allTestsPassed = false;
+    }
+
+    // Test 7: Per-Frame Shader-Visible Descriptor Tables
+    if (!TestTransientDescriptorAllocator(device)) {
+        allTestsPassed = false;
+    }
+
+    // Test 8: Per-Frame Linear Constant Allocation
+    if (!TestFrameLinearAllocator()) {
+        allTestsPassed = false;
+    }
+
+    // Test 9: Fence-Keyed Deferred Release
+    if (!TestDeferredReleaseQueue()) {
+        allTestsPassed = false;
+    }
+
+    // Test 10: Fence-Keyed Command List Reuse
+    if (!TestCommandListPool(device)) {
+        allTestsPassed = false;
+    }
+
+    // Test 11: Memory Budget Eviction
+    if (!TestMemoryBudgetManager()) {
+        allTestsPassed = false;
+    }
+
+    // Test 12: Time-Sliced Streaming Uploads
+    if (!TestStreamingUploadQueue()) {
+        allTestsPassed = false;
+    }
+
+    // Test 13: Render Mode Selector (confirmation, hysteresis, calibration)
+    if (!TestRenderModeSelector()) {
+        allTestsPassed = false;
+    }
+
+    // Test 14: Render Graph Background Compile (rejected overlap, frame-boundary swap, setup thread)
+    if (!TestRenderGraphCompileAsync()) {
+        allTestsPassed = false;
+    }
+
+    // Test 15: Shader Cache Key (source, includes, defines, target)
+    if (!TestShaderCacheKey()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 16: Pipeline Cache Key (shader contents, formats, state)
+    if (!TestPipelineCacheKey()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 17: Pipeline Desc Storage (async request copy, prewarm list)
+    if (!TestPipelineDescStorage()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 18: Shader Permutation Archive (keyword keys, offline bytecode, staleness)
+    if (!TestShaderPermutationArchive()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 19: Root Signature Key (shared layouts across passes)
+    if (!TestRootSignatureKey()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 20: Scene Component Storage (generational handles, packed arrays, name index)
+    if (!TestSceneStorage()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 21: Scene BVH (SAH build, refit, queries against a linear scan)
+    if (!TestSceneBVH()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 22: Frustum Culling (plane extraction, SIMD kernels against the scalar test)
+    if (!TestFrustumCulling()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 23: Parallel Culling (job system, deterministic visible lists across threads)
+    if (!TestParallelCulling()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 24: Scene Hierarchy (parent-first order, dirty propagation, model nodes)
+    if (!TestSceneHierarchy()) {
+        allTestsPassed = false;
+    }
+    
+    // Test 25: Draw Sort Keys (state buckets, depth order, radix sort against a comparison sort)
+    if (!TestDrawSortKeys()) {
+        allTestsPassed = false;
+    }
     
     if (allTestsPassed) {
         Logger::Info("=== ALL FEATURE TESTS PASSED ===");
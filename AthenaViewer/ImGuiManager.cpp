@@ -10,6 +10,7 @@ namespace Athena {
         frameTimeIndex = 0;
         initialized = false;
         enableDeferredRendering = false;
+        autoRenderingMode = false;
         renderingModeChanged = false;
         cameraResetRequested = false;
         mouseCaptured = false;
@@ -167,9 +168,21 @@ namespace Athena {
 
         // Rendering mode toggle
         bool oldDeferredMode = enableDeferredRendering;
+        if (ImGui::Checkbox("Auto (cost model)", &autoRenderingMode)) {
+            renderingModeChanged = true;
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("(?)");
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Choose Forward or Deferred automatically\n"
+                            "from measured pass timings, light count and resolution");
+        }
+
+        ImGui::BeginDisabled(autoRenderingMode);
         if (ImGui::Checkbox("Deferred Rendering", &enableDeferredRendering)) {
             renderingModeChanged = true;
         }
+        ImGui::EndDisabled();
         ImGui::SameLine();
         ImGui::TextDisabled("(?)");
         if (ImGui::IsItemHovered()) {
@@ -180,7 +193,8 @@ namespace Athena {
 
         // Current rendering state display
         ImGui::Spacing();
-        ImGui::Text("Current Mode: %s", enableDeferredRendering ? "Deferred" : "Forward");
+        ImGui::Text("Current Mode: %s%s", enableDeferredRendering ? "Deferred" : "Forward",
+                    autoRenderingMode ? " (auto)" : "");
     }
 
     void ImGuiManager::RenderPerformanceStats() {
@@ -67,6 +67,8 @@ namespace Athena {
         // UI state getters
         bool IsRenderingModeChanged() const { return renderingModeChanged; }
         bool IsDeferredRenderingEnabled() const { return enableDeferredRendering; }
+        bool IsAutoRenderingModeEnabled() const { return autoRenderingMode; }
+        void SetDeferredRenderingEnabled(bool enabled) { enableDeferredRendering = enabled; }
         
         bool IsCameraResetRequested() const { return cameraResetRequested; }
         bool IsMouseCaptureChanged() const { return mouseCaptureChanged; }
@@ -90,6 +92,7 @@ namespace Athena {
         
         // UI control state
         bool enableDeferredRendering;
+        bool autoRenderingMode;
         bool renderingModeChanged;
         bool cameraResetRequested;
         bool mouseCaptured;
@@ -4,8 +4,13 @@
 #include "Athena/RenderGraph/LightingPass.h"
 #include "Athena/RenderGraph/ToneMappingPass.h"
 #include "Athena/RenderGraph/RenderPass.h"
+#include "Athena/RenderGraph/RenderModeSelector.h"
 #include "Athena/Core/Device.h"
+#include "Athena/Core/SwapChain.h"
 #include "Athena/Core/DescriptorHeap.h"
+#include "Athena/Core/GpuTimer.h"
+#include "Athena/Core/TransientDescriptorAllocator.h"
+#include "Athena/Resources/ConstantBufferAllocator.h"
 #include "Athena/Resources/Texture.h"
 #include "Athena/Utils/Logger.h"
 #include <memory>
@@ -44,6 +49,18 @@ public:
             // G-Bufferデスクリプタヒープを作成
             CreateGBufferDescriptorHeaps();
 
+            // パスごとのSRVテーブルはフレーム単位の線形アロケータから割り当てる
+            // パーティション数はスワップチェーンのフレーム数に合わせる
+            transientDescriptors.Initialize(device->GetD3D12Device(),
+                D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                TransientDescriptorAllocator::DefaultDescriptorsPerFrame,
+                SwapChain::BufferCount);
+
+            // 描画ごとの定数もフレーム単位の線形アロケータから割り当てる
+            constantAllocator.Initialize(device->GetD3D12Device(),
+                ConstantBufferAllocator::DefaultBytesPerFrame,
+                SwapChain::BufferCount);
+
             // RenderGraphを構築
             BuildRenderGraph();
 
@@ -71,10 +88,13 @@ public:
         }
 
         try {
+            gpuTimer.BeginFrame();
+
             // 実行データを準備
             PassExecuteData executeData;
             executeData.commandList = commandList;
             executeData.srvHeap = srvHeap;
+            executeData.constantAllocator = &constantAllocator;
 
             if (useDeferredRendering) {
                 // ディファードレンダリングパイプライン
@@ -88,7 +108,9 @@ public:
                     geometryPass->SetGBufferRTVHandles(gbufferRTVHandles);
                     geometryPass->SetGBufferDSVHandle(gbufferDSVHandle);
                     Logger::Info("RenderGraphExample: Executing GeometryPass (G-Buffer generation)");
+                    uint32_t scope = gpuTimer.BeginScope(commandList, "GBuffer");
                     geometryPass->Execute(executeData);
+                    gpuTimer.EndScope(commandList, scope);
                 }
                 
                 // LightingPass実行（G-Bufferからライティング）
@@ -96,13 +118,17 @@ public:
                     // レンダーターゲットを最終出力（スワップチェーン）に設定
                     commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
                     
-                    // G-Buffer SRVヒープに変更
+                    // G-Buffer SRVをこのフレームのテーブルにコピーして使用
+                    DescriptorHandle gbufferTable = transientDescriptors.CopyTable(gbufferSRVHeap->GetHandle(0).cpu, 3);
                     PassExecuteData lightingData = executeData;
-                    lightingData.srvHeap = gbufferSRVHeap->GetD3D12DescriptorHeap();
+                    lightingData.srvHeap = transientDescriptors.GetD3D12DescriptorHeap();
+                    lightingData.srvTable = gbufferTable.gpu;
                     
                     lightingPass->SetGBuffer(gbufferAlbedo, gbufferNormal, gbufferDepth);
                     Logger::Info("RenderGraphExample: Executing LightingPass (Deferred Lighting)");
+                    uint32_t scope = gpuTimer.BeginScope(commandList, "DeferredLighting");
                     lightingPass->Execute(lightingData);
+                    gpuTimer.EndScope(commandList, scope);
                 }
             } else {
                 // フォワードレンダリングパイプライン
@@ -114,10 +140,14 @@ public:
                 if (geometryPass) {
                     geometryPass->SetRenderMode(GeometryPass::RenderMode::Forward);
                     Logger::Info("RenderGraphExample: Executing GeometryPass (Forward rendering)");
+                    uint32_t scope = gpuTimer.BeginScope(commandList, "Forward");
                     geometryPass->Execute(executeData);
+                    gpuTimer.EndScope(commandList, scope);
                 }
             }
 
+            gpuTimer.EndFrame(commandList);
+
             Logger::Info("RenderGraphExample: Frame rendered");
         }
         catch (const std::exception& e) {
@@ -167,6 +197,15 @@ public:
         }
     }
 
+    /**
+     * @brief 頂点/インデックスバッファ用のGPUメモリアロケータを設定
+     */
+    void SetMemoryAllocator(GpuMemoryAllocator* allocator) {
+        if (geometryPass) {
+            geometryPass->SetMemoryAllocator(allocator);
+        }
+    }
+
     /**
      * @brief オブジェクトIDの設定
      */
@@ -183,6 +222,75 @@ public:
         deferredMode = useDeferred;
     }
 
+    /**
+     * @brief フレーム開始（完了済みパーティションのデスクリプタと定数を再利用）
+     */
+    void BeginFrame(uint64_t completedFenceValue) {
+        transientDescriptors.BeginFrame(completedFenceValue);
+        constantAllocator.BeginFrame(completedFenceValue);
+    }
+
+    /**
+     * @brief フレーム終了（送信したフレームのフェンス値を記録）
+     */
+    void EndFrame(uint64_t fenceValue) {
+        transientDescriptors.EndFrame(fenceValue);
+        constantAllocator.EndFrame(fenceValue);
+    }
+
+    /**
+     * @brief パス単位のGPU計測を有効化
+     *
+     * コマンドキューはタイムスタンプ周波数の取得に使用する。
+     */
+    bool InitializeGpuTiming(ID3D12CommandQueue* commandQueue) {
+        if (!device) return false;
+
+        try {
+            gpuTimer.Initialize(device->GetD3D12Device(), commandQueue);
+            return true;
+        }
+        catch (const std::exception& e) {
+            Logger::Warning("RenderGraphExample: GPU timing unavailable: %s", e.what());
+            return false;
+        }
+    }
+
+    /**
+     * @brief コストモデルでフォワード／ディファードを自動選択
+     *
+     * 読み戻したフレームの計測値・ライト数・解像度を RenderModeSelector に渡す。
+     *
+     * @return ディファードを使用する場合true
+     */
+    bool UpdateAutoRenderingMode() {
+        RenderModeFrameInfo info;
+        info.width = width;
+        info.height = height;
+        info.lightCount = lightingPass ? lightingPass->GetLightCount() : 1;
+
+        // 計測値は frameLatency フレーム前のものなので、切り替え直後は現在のモードと一致しない。
+        // 読み戻したフレームに含まれる区間から計測時のモードを判定する
+        float gbufferMs = gpuTimer.GetScopeMs("GBuffer");
+        if (gbufferMs >= 0.0f) {
+            info.measuredMode = GeometryPass::RenderMode::Deferred;
+            info.geometryPassMs = gbufferMs;
+            info.lightingPassMs = gpuTimer.GetScopeMs("DeferredLighting");
+        } else {
+            info.measuredMode = GeometryPass::RenderMode::Forward;
+            info.geometryPassMs = gpuTimer.GetScopeMs("Forward");
+        }
+
+        return modeSelector.Update(info) == GeometryPass::RenderMode::Deferred;
+    }
+
+    /**
+     * @brief 自動選択の状態を現在のモードに合わせてリセット
+     */
+    void ResetAutoRenderingMode(bool useDeferred) {
+        modeSelector.Reset(useDeferred ? GeometryPass::RenderMode::Deferred : GeometryPass::RenderMode::Forward);
+    }
+
     /**
      * @brief G-Bufferテクスチャを取得
      */
@@ -299,10 +407,9 @@ private:
             gbufferDSVHeap = std::make_unique<DescriptorHeap>();
             gbufferDSVHeap->Initialize(device->GetD3D12Device(), D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 1, false);
             
-            // SRVヒープ作成 (G-Buffer読み取り用)
+            // SRVヒープ作成 (G-Buffer読み取り用、描画時にシェーダー可視ヒープへコピーする)
             gbufferSRVHeap = std::make_unique<DescriptorHeap>();
-            gbufferSRVHeap->Initialize(device->GetD3D12Device(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 3, true);
-            gbufferSRVGPUStart = gbufferSRVHeap->GetD3D12DescriptorHeap()->GetGPUDescriptorHandleForHeapStart();
+            gbufferSRVHeap->Initialize(device->GetD3D12Device(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 3, false);
             
             // RTVを作成
             auto albedoHandle = gbufferRTVHeap->Allocate();
@@ -365,10 +472,17 @@ private:
     std::unique_ptr<DescriptorHeap> gbufferSRVHeap;
     D3D12_CPU_DESCRIPTOR_HANDLE gbufferRTVHandles[3] = {};
     D3D12_CPU_DESCRIPTOR_HANDLE gbufferDSVHandle = {};
-    D3D12_GPU_DESCRIPTOR_HANDLE gbufferSRVGPUStart = {};
     
     // レンダリングモード
     bool deferredMode = false;
+
+    // パス単位のGPU計測とモード自動選択
+    GpuTimer gpuTimer;
+    RenderModeSelector modeSelector;
+
+    // フレーム単位のシェーダー可視デスクリプタと定数バッファ
+    TransientDescriptorAllocator transientDescriptors;
+    ConstantBufferAllocator constantAllocator;
 };
 
 } // namespace Athena
@@ -381,6 +495,12 @@ void RenderWithRenderGraph(ID3D12GraphicsCommandList* commandList,
                           D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle,
                           bool useDeferredRendering = false);
 void SetRenderGraphMode(bool useDeferred);
+bool InitializeRenderGraphGpuTiming(ID3D12CommandQueue* commandQueue);
+bool UpdateRenderGraphAutoMode();
+void ResetRenderGraphAutoMode(bool useDeferred);
+void SetRenderGraphMemoryAllocator(Athena::GpuMemoryAllocator* allocator);
+void BeginRenderGraphFrame(uint64_t completedFenceValue);
+void EndRenderGraphFrame(uint64_t fenceValue);
 void SetRenderGraphSceneData(const Athena::Matrix4x4& world, const Athena::Matrix4x4& view, const Athena::Matrix4x4& proj,
                            const Athena::Vector3& cameraPos, const Athena::Vector3& lightDir, const Athena::Vector3& lightColor);
 
@@ -408,6 +528,20 @@ void SetRenderGraphMode(bool useDeferred) {
     }
 }
 
+bool InitializeRenderGraphGpuTiming(ID3D12CommandQueue* commandQueue) {
+    return g_renderGraphExample ? g_renderGraphExample->InitializeGpuTiming(commandQueue) : false;
+}
+
+bool UpdateRenderGraphAutoMode() {
+    return g_renderGraphExample ? g_renderGraphExample->UpdateAutoRenderingMode() : false;
+}
+
+void ResetRenderGraphAutoMode(bool useDeferred) {
+    if (g_renderGraphExample) {
+        g_renderGraphExample->ResetAutoRenderingMode(useDeferred);
+    }
+}
+
 void SetRenderGraphSceneData(const Athena::Matrix4x4& world, const Athena::Matrix4x4& view, const Athena::Matrix4x4& proj,
                            const Athena::Vector3& cameraPos, const Athena::Vector3& lightDir, const Athena::Vector3& lightColor) {
     if (g_renderGraphExample) {
@@ -452,4 +586,22 @@ void SetRenderGraphObjectID(uint32_t objectID) {
     if (g_renderGraphExample) {
         g_renderGraphExample->SetObjectID(objectID);
     }
+}
+
+void SetRenderGraphMemoryAllocator(Athena::GpuMemoryAllocator* allocator) {
+    if (g_renderGraphExample) {
+        g_renderGraphExample->SetMemoryAllocator(allocator);
+    }
+}
+
+void BeginRenderGraphFrame(uint64_t completedFenceValue) {
+    if (g_renderGraphExample) {
+        g_renderGraphExample->BeginFrame(completedFenceValue);
+    }
+}
+
+void EndRenderGraphFrame(uint64_t fenceValue) {
+    if (g_renderGraphExample) {
+        g_renderGraphExample->EndFrame(fenceValue);
+    }
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Athena/RenderGraph/RenderGraph.h"
 #include "Athena/RenderGraph/RenderGraphBuilder.h"
+#include "Athena/RenderGraph/RenderModeSelector.h"
 #include "Athena/Core/Device.h"
 #include "Athena/Utils/Logger.h"
 #include <memory>
@@ -128,6 +129,96 @@ bool TestRenderPassFunctionality() {
     return true;
 }
 
+// 静的パイプライン：宣言順（Lighting, Geometry）と依存順が逆になるよう定義し、
+// 順序・ライフタイムがコンパイル時に確定することを確認する
+constexpr auto kTestStaticPipelineDesc = MakeStaticPipeline(
+    std::array<const char*, 2>{ "Lighting", "Geometry" },
+    std::array<StaticResourceDesc, 2>{
+        StaticResourceDesc{ "GBuffer", ResourceType::Texture2D,
+            ResourceUsage::RenderTarget | ResourceUsage::ShaderResource, 1280, 720, DXGI_FORMAT_R8G8B8A8_UNORM },
+        StaticResourceDesc{ "Lit", ResourceType::Texture2D,
+            ResourceUsage::RenderTarget, 1280, 720, DXGI_FORMAT_R8G8B8A8_UNORM, false, true } },
+    std::array<StaticEdge, 3>{
+        StaticEdge{ 0, 0, false },   // Lighting reads GBuffer
+        StaticEdge{ 0, 1, true },    // Lighting writes Lit
+        StaticEdge{ 1, 0, true } }); // Geometry writes GBuffer
+
+using TestStaticPipeline = StaticRenderPipeline<kTestStaticPipelineDesc>;
+
+static_assert(TestStaticPipeline::Schedule.order[0] == 1 && TestStaticPipeline::Schedule.order[1] == 0,
+    "Geometry must be scheduled before Lighting");
+static_assert(TestStaticPipeline::Schedule.lifetimes[0].firstPass == 0 && TestStaticPipeline::Schedule.lifetimes[0].lastPass == 1,
+    "GBuffer must live from Geometry to Lighting");
+static_assert(TestStaticPipeline::Schedule.lifetimes[1].lastPass == 2,
+    "Final output lifetime must extend to the end of the graph");
+
+bool TestStaticPipelineSchedule(std::shared_ptr<Device> device) {
+    Logger::Info("=== Static Pipeline Test Start ===");
+
+    try {
+        RenderGraph graph(device);
+
+        std::vector<std::unique_ptr<RenderPass>> passes;
+        passes.push_back(std::make_unique<TestRenderPass>());
+        passes.push_back(std::make_unique<TestRenderPass>());
+
+        bool result = graph.ImportStaticSchedule(TestStaticPipeline::Schedule.View(), std::move(passes));
+        Logger::Info("Import result: %s", result ? "SUCCESS" : "FAILED");
+        Logger::Info("  - Precomputed barriers: %u", TestStaticPipeline::Schedule.barrierCount);
+        Logger::Info("  - Total passes: %u", graph.GetStats().totalPasses);
+
+        Logger::Info("=== Static Pipeline Test Complete ===");
+        return result;
+
+    } catch (const std::exception& e) {
+        Logger::Error("Static pipeline test error: %s", e.what());
+        return false;
+    }
+}
+
+bool TestRenderModeSelector() {
+    Logger::Info("=== Render Mode Selector Test Start ===");
+
+    RenderModeSelectorSettings settings;
+    settings.confirmFrames = 5;
+    settings.minFramesBetweenSwitches = 20;
+    RenderModeSelector selector(GeometryPass::RenderMode::Forward, settings);
+
+    RenderModeFrameInfo info;
+    info.width = 1920;
+    info.height = 1080;
+
+    // 1灯：フォワードのまま
+    info.lightCount = 1;
+    for (int i = 0; i < 100; ++i) {
+        info.measuredMode = selector.GetMode();
+        selector.Update(info);
+    }
+    bool result = (selector.GetMode() == GeometryPass::RenderMode::Forward);
+
+    // 多数のライト：ディファードへ切り替わり、往復しない
+    info.lightCount = 64;
+    for (int i = 0; i < 100; ++i) {
+        info.measuredMode = selector.GetMode();
+        selector.Update(info);
+    }
+    result &= (selector.GetMode() == GeometryPass::RenderMode::Deferred);
+    result &= (selector.GetSwitchCount() == 1);
+
+    // 損益分岐点付近で交互に変化しても切り替えは起きない
+    uint32_t switchesBefore = selector.GetSwitchCount();
+    for (int i = 0; i < 100; ++i) {
+        info.lightCount = (i % 4 == 0) ? 1 : 6;
+        info.measuredMode = selector.GetMode();
+        selector.Update(info);
+    }
+    result &= (selector.GetSwitchCount() == switchesBefore);
+
+    Logger::Info("  - Switches: %u, final mode: %s", selector.GetSwitchCount(), selector.IsDeferred() ? "Deferred" : "Forward");
+    Logger::Info("=== Render Mode Selector Test Complete: %s ===", result ? "SUCCESS" : "FAILED");
+    return result;
+}
+
 bool RunAllRenderGraphTests(std::shared_ptr<Device> device) {
     Logger::Info("===== RenderGraph Integration Test Start =====");
     
@@ -136,6 +227,8 @@ bool RunAllRenderGraphTests(std::shared_ptr<Device> device) {
     result &= TestResourceHandle();
     result &= TestRenderPassFunctionality();
     result &= TestRenderGraphBasics(device);
+    result &= TestStaticPipelineSchedule(device);
+    result &= TestRenderModeSelector();
     
     Logger::Info("===== RenderGraph Integration Test Complete: {} =====", result ? "SUCCESS" : "FAILED");
     
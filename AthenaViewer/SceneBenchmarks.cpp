@@ -0,0 +1,340 @@
+#include "Athena/Core/JobSystem.h"
+#include "Athena/Scene/DrawQueue.h"
+#include "Athena/Scene/FrustumCuller.h"
+#include "Athena/Scene/Scene.h"
+#include "Athena/Scene/SceneBVH.h"
+#include "Athena/Utils/Logger.h"
+#include "Athena/Utils/Math.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <float.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Athena;
+
+namespace {
+    using Clock = std::chrono::high_resolution_clock;
+
+    double ElapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    /**
+     * @brief 一辺が objectCount の立方根に比例する空間にランダムな AABB を配置（密度を一定に保つ）
+     */
+    struct BenchmarkScene {
+        std::vector<Vector3> boundsMin;
+        std::vector<Vector3> boundsMax;
+        float extent = 0.0f;
+
+        BenchmarkScene(uint32_t objectCount, std::mt19937& random) {
+            extent = 10.0f * std::cbrt(static_cast<float>(objectCount));
+            std::uniform_real_distribution<float> position(0.0f, extent);
+            std::uniform_real_distribution<float> size(0.5f, 4.0f);
+            boundsMin.resize(objectCount);
+            boundsMax.resize(objectCount);
+            for (uint32_t i = 0; i < objectCount; ++i) {
+                Vector3 center(position(random), position(random), position(random));
+                Vector3 half(size(random), size(random), size(random));
+                boundsMin[i] = center - half * 0.5f;
+                boundsMax[i] = center + half * 0.5f;
+            }
+        }
+    };
+
+    // 内側が正の6平面で表した直方体（各軸で中央の半分の範囲、全体の約 1/8）
+    void MakeBoxPlanes(float extent, Vector4 planes[6]) {
+        float low = extent * 0.25f;
+        float high = extent * 0.75f;
+        planes[0] = Vector4(1.0f, 0.0f, 0.0f, -low);
+        planes[1] = Vector4(-1.0f, 0.0f, 0.0f, high);
+        planes[2] = Vector4(0.0f, 1.0f, 0.0f, -low);
+        planes[3] = Vector4(0.0f, -1.0f, 0.0f, high);
+        planes[4] = Vector4(0.0f, 0.0f, 1.0f, -low);
+        planes[5] = Vector4(0.0f, 0.0f, -1.0f, high);
+    }
+
+    void BenchmarkBVH(uint32_t objectCount) {
+        std::mt19937 random(1234);
+        BenchmarkScene scene(objectCount, random);
+
+        SceneBVH bvh;
+        auto start = Clock::now();
+        bvh.Build(scene.boundsMin.data(), scene.boundsMax.data(), objectCount);
+        double buildMs = ElapsedMs(start);
+
+        // 10% のオブジェクトを移動してリフィット
+        std::uniform_int_distribution<uint32_t> pick(0, objectCount - 1);
+        std::uniform_real_distribution<float> offset(-5.0f, 5.0f);
+        for (uint32_t i = 0; i < objectCount / 10; ++i) {
+            uint32_t index = pick(random);
+            Vector3 delta(offset(random), offset(random), offset(random));
+            scene.boundsMin[index] += delta;
+            scene.boundsMax[index] += delta;
+        }
+        start = Clock::now();
+        bvh.Refit(scene.boundsMin.data(), scene.boundsMax.data());
+        double refitMs = ElapsedMs(start);
+
+        Vector4 planes[6];
+        MakeBoxPlanes(scene.extent, planes);
+        std::vector<uint32_t> visible;
+        visible.reserve(objectCount);
+        start = Clock::now();
+        bvh.QueryFrustum(planes, visible);
+        double frustumMs = ElapsedMs(start);
+
+        // レイ・最近傍は BVH と全要素の線形探索を比較する
+        constexpr uint32_t QueryCount = 1000;
+        constexpr uint32_t LinearQueryCount = 16;
+        std::uniform_real_distribution<float> position(0.0f, scene.extent);
+        std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+        std::vector<Vector3> origins(QueryCount);
+        std::vector<Vector3> directions(QueryCount);
+        for (uint32_t i = 0; i < QueryCount; ++i) {
+            origins[i] = Vector3(position(random), position(random), position(random));
+            directions[i] = Vector3(direction(random), direction(random), direction(random));
+        }
+
+        std::vector<std::pair<float, uint32_t>> hits;
+        size_t hitCount = 0;
+        start = Clock::now();
+        for (uint32_t i = 0; i < QueryCount; ++i) {
+            hits.clear();
+            bvh.QueryRay(origins[i], directions[i], hits);
+            hitCount += hits.size();
+        }
+        double rayUs = ElapsedMs(start) * 1000.0 / QueryCount;
+
+        start = Clock::now();
+        for (uint32_t i = 0; i < LinearQueryCount; ++i) {
+            for (uint32_t j = 0; j < objectCount; ++j) {
+                float distance;
+                hitCount += SceneBVH::IntersectRay(origins[i], directions[i], scene.boundsMin[j], scene.boundsMax[j], distance);
+            }
+        }
+        double linearRayUs = ElapsedMs(start) * 1000.0 / LinearQueryCount;
+
+        uint64_t nearestSum = 0;
+        start = Clock::now();
+        for (uint32_t i = 0; i < QueryCount; ++i) {
+            nearestSum += bvh.FindNearest(origins[i]);
+        }
+        double nearestUs = ElapsedMs(start) * 1000.0 / QueryCount;
+
+        start = Clock::now();
+        for (uint32_t i = 0; i < LinearQueryCount; ++i) {
+            uint32_t nearest = 0;
+            float nearestDistance = FLT_MAX;
+            for (uint32_t j = 0; j < objectCount; ++j) {
+                float distance = SceneBVH::DistanceSquared(origins[i], scene.boundsMin[j], scene.boundsMax[j]);
+                if (distance < nearestDistance) {
+                    nearestDistance = distance;
+                    nearest = j;
+                }
+            }
+            nearestSum += nearest;
+        }
+        double linearNearestUs = ElapsedMs(start) * 1000.0 / LinearQueryCount;
+
+        Logger::Info("BVH %7u objects: build %.2f ms, refit %.2f ms (cost %.2f -> %.2f), frustum %.3f ms (%zu visible)",
+                     objectCount, buildMs, refitMs, bvh.GetBuildCost(), bvh.GetCost(), frustumMs, visible.size());
+        Logger::Info("    ray %.2f us (linear %.2f us), nearest %.2f us (linear %.2f us) [%zu, %llu]",
+                     rayUs, linearRayUs, nearestUs, linearNearestUs, hitCount,
+                     static_cast<unsigned long long>(nearestSum));
+    }
+
+    void BenchmarkCulling(uint32_t objectCount) {
+        std::mt19937 random(5678);
+        BenchmarkScene scene(objectCount, random);
+
+        // 空間の手前の面の中央から奥を向いたカメラ
+        float center = scene.extent * 0.5f;
+        Matrix4x4 view = Matrix4x4::LookAt(Vector3(center, center, -10.0f), Vector3(center, center, scene.extent),
+                                           Vector3(0.0f, 1.0f, 0.0f));
+        Matrix4x4 projection = Matrix4x4::Perspective(3.14159f / 4.0f, 16.0f / 9.0f, 0.1f, scene.extent);
+        Vector4 planes[6];
+        FrustumCuller::ExtractPlanes(view * projection, planes);
+
+        // SoA への写し直しは配列を使い回す2回目（毎フレームの更新と同じ条件）を測る
+        FrustumCuller culler;
+        culler.Assign(scene.boundsMin.data(), scene.boundsMax.data(), objectCount);
+        auto start = Clock::now();
+        culler.Assign(scene.boundsMin.data(), scene.boundsMax.data(), objectCount);
+        double assignMs = ElapsedMs(start);
+
+        constexpr uint32_t Repeats = 20;
+        std::vector<uint32_t> visible(objectCount);
+        for (FrustumCuller::Kernel kernel : { FrustumCuller::Kernel::Scalar, FrustumCuller::Kernel::SSE,
+                                              FrustumCuller::Kernel::AVX, FrustumCuller::Kernel::NEON }) {
+            if (!FrustumCuller::IsKernelSupported(kernel)) {
+                continue;
+            }
+            uint32_t visibleCount = 0;
+            start = Clock::now();
+            for (uint32_t i = 0; i < Repeats; ++i) {
+                visibleCount = culler.Cull(planes, visible.data(), kernel);
+            }
+            Logger::Info("Culling %7u objects: %-6s %.3f ms (%u visible)",
+                         objectCount, FrustumCuller::GetKernelName(kernel), ElapsedMs(start) / Repeats, visibleCount);
+        }
+
+        SceneBVH bvh;
+        bvh.Build(scene.boundsMin.data(), scene.boundsMax.data(), objectCount);
+        std::vector<uint32_t> bvhVisible;
+        bvhVisible.reserve(objectCount);
+        start = Clock::now();
+        for (uint32_t i = 0; i < Repeats; ++i) {
+            bvhVisible.clear();
+            bvh.QueryFrustum(planes, bvhVisible);
+        }
+        Logger::Info("    BVH frustum query %.3f ms, SoA copy %.3f ms",
+                     ElapsedMs(start) / Repeats, assignMs);
+    }
+
+    /**
+     * @brief 指定した点を向くだけのカメラ
+     */
+    class BenchmarkCamera : public Camera {
+    public:
+        BenchmarkCamera(const Vector3& eye, const Vector3& target) : target(target) {
+            SetPosition(eye);
+        }
+
+        void Update(float) override {}
+
+    protected:
+        void UpdateViewMatrix() override {
+            viewMatrix = Matrix4x4::LookAt(position, target, Vector3(0.0f, 1.0f, 0.0f));
+        }
+
+    private:
+        Vector3 target;
+    };
+
+    void BenchmarkParallelCulling(uint32_t objectCount) {
+        std::mt19937 random(9012);
+        BenchmarkScene boxes(objectCount, random);
+
+        Scene scene("CullingBenchmark");
+        for (uint32_t i = 0; i < objectCount; ++i) {
+            SceneObject object("Object" + std::to_string(i));
+            object.SetPosition((boxes.boundsMin[i] + boxes.boundsMax[i]) * 0.5f);
+            SceneHandle handle = scene.AddObject(object);
+            scene.SetTransparent(handle, i % 10 == 0);
+        }
+        scene.UpdateTransforms();
+
+        float center = boxes.extent * 0.5f;
+        BenchmarkCamera camera(Vector3(center, center, -10.0f), Vector3(center, center, boxes.extent));
+
+        // 1 スレッドの結果を基準に、スレッド数を変えても同じ結果になることも確かめる
+        constexpr uint32_t Repeats = 20;
+        std::vector<SceneHandle> reference;
+        std::vector<SceneHandle> referenceTransparent;
+        double singleThreadMs = 0.0;
+        uint32_t maxThreads = (std::max)(1u, std::thread::hardware_concurrency());
+        for (uint32_t threadCount = 1; threadCount <= maxThreads; ++threadCount) {
+            JobSystem jobSystem;
+            jobSystem.Initialize(threadCount - 1);
+            JobSystem::SetGlobal(&jobSystem);
+
+            std::vector<SceneHandle> visible = scene.GetVisibleObjects(&camera);
+            auto start = Clock::now();
+            for (uint32_t i = 0; i < Repeats; ++i) {
+                visible = scene.GetVisibleObjects(&camera);
+            }
+            double visibleMs = ElapsedMs(start) / Repeats;
+
+            std::vector<SceneHandle> transparent;
+            start = Clock::now();
+            for (uint32_t i = 0; i < Repeats; ++i) {
+                transparent = scene.GetTransparentObjects(&camera);
+            }
+            double transparentMs = ElapsedMs(start) / Repeats;
+
+            JobSystem::SetGlobal(nullptr);
+
+            if (threadCount == 1) {
+                reference = visible;
+                referenceTransparent = transparent;
+                singleThreadMs = visibleMs;
+            }
+            bool deterministic = visible == reference && transparent == referenceTransparent;
+            Logger::Info("Visible list %7u objects, %2u threads: %.3f ms (x%.2f), transparent %.3f ms, %zu visible%s",
+                         objectCount, threadCount, visibleMs, singleThreadMs / visibleMs, transparentMs,
+                         visible.size(), deterministic ? "" : " [RESULT DIFFERS FROM 1 THREAD]");
+        }
+    }
+
+    void BenchmarkDrawSort(uint32_t drawCount) {
+        // 状態の種類はゲームの1フレームでありがちな程度（パイプライン 8、マテリアル 500、メッシュ 2000）
+        std::mt19937 random(3456);
+        std::uniform_real_distribution<float> viewDepth(0.5f, 1000.0f);
+        std::vector<DrawQueue::Item> opaqueItems(drawCount);
+        std::vector<DrawQueue::Item> transparentItems(drawCount);
+        for (uint32_t i = 0; i < drawCount; ++i) {
+            uint32_t pipelineId = random() % 8;
+            uint32_t materialId = random() % 500;
+            uint32_t meshId = random() % 2000;
+            uint32_t depth = DrawQueue::QuantizeDepth(viewDepth(random));
+            opaqueItems[i] = { DrawQueue::MakeOpaqueKey(pipelineId, materialId, meshId, depth), i };
+            transparentItems[i] = { DrawQueue::MakeTransparentKey(pipelineId, materialId, meshId, depth), i };
+        }
+
+        constexpr uint32_t Repeats = 20;
+        for (const auto* source : { &opaqueItems, &transparentItems }) {
+            // 作業領域を確保した後の2回目以降（毎フレームの条件）を測る
+            DrawQueue queue;
+            queue.GetItems() = *source;
+            queue.Sort();
+            double radixMs = 0.0;
+            for (uint32_t i = 0; i < Repeats; ++i) {
+                queue.GetItems() = *source;
+                auto start = Clock::now();
+                queue.Sort();
+                radixMs += ElapsedMs(start);
+            }
+
+            std::vector<DrawQueue::Item> sorted;
+            double comparisonMs = 0.0;
+            for (uint32_t i = 0; i < Repeats; ++i) {
+                sorted = *source;
+                auto start = Clock::now();
+                std::stable_sort(sorted.begin(), sorted.end(),
+                    [](const DrawQueue::Item& a, const DrawQueue::Item& b) { return a.key < b.key; });
+                comparisonMs += ElapsedMs(start);
+            }
+
+            bool same = std::equal(sorted.begin(), sorted.end(), queue.GetItems().begin(),
+                [](const DrawQueue::Item& a, const DrawQueue::Item& b) {
+                    return a.key == b.key && a.componentIndex == b.componentIndex;
+                });
+            Logger::Info("Draw sort %7u %-11s: radix %.3f ms, std::stable_sort %.3f ms%s",
+                         drawCount, source == &opaqueItems ? "opaque" : "transparent",
+                         radixMs / Repeats, comparisonMs / Repeats, same ? "" : " [ORDER DIFFERS]");
+        }
+    }
+}
+
+// シーンの空間処理のベンチマーク（--benchmark-scene）
+int RunSceneBenchmarks() {
+    Logger::Info("=== Scene Benchmarks ===");
+    for (uint32_t objectCount : { 10000u, 100000u, 1000000u }) {
+        BenchmarkBVH(objectCount);
+    }
+    for (uint32_t objectCount : { 10000u, 100000u, 1000000u }) {
+        BenchmarkCulling(objectCount);
+    }
+    for (uint32_t objectCount : { 100000u, 1000000u }) {
+        BenchmarkParallelCulling(objectCount);
+    }
+    for (uint32_t drawCount : { 10000u, 100000u }) {
+        BenchmarkDrawSort(drawCount);
+    }
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <memory>
 #include <chrono>
+#include <cstring>
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include <d3dcompiler.h>
@@ -13,14 +14,27 @@
 #include "Athena/Core/Device.h"
 #include "Athena/Core/CommandQueue.h"
 #include "Athena/Core/SwapChain.h"
+#include "Athena/Core/FrameContext.h"
+#include "Athena/Core/JobSystem.h"
 #include "Athena/Core/DescriptorHeap.h"
 #include "Athena/Resources/Buffer.h"
+#include "Athena/Resources/ConstantBufferAllocator.h"
 #include "Athena/Resources/Texture.h"
 #include "Athena/Resources/UploadContext.h"
+#include "Athena/Resources/UploadScheduler.h"
+#include "Athena/Resources/StreamingUploadQueue.h"
+#include "Athena/Resources/ShaderCache.h"
+#include "Athena/Resources/PipelineCache.h"
+#include "Athena/Resources/RootSignatureCache.h"
+#include "Athena/Resources/ShaderArchive.h"
+#include "Athena/Resources/GpuMemoryAllocator.h"
+#include "Athena/Resources/MemoryBudgetManager.h"
+#include "Athena/Resources/D3D12Residency.h"
 #include "Athena/Utils/Math.h"
 #include "Athena/Scene/Camera.h"
 #include "Athena/Scene/ModelLoader.h"
 #include "Athena/Scene/CameraController.h"
+#include "Athena/RenderGraph/GeometryPass.h"
 #include "ImGuiManager.h"
 //#include "MemoryTracker.h"
 //#include "RenderingStats.h"
@@ -32,6 +46,9 @@ bool RunFeatureTests(std::shared_ptr<Athena::Device> device);
 // RenderGraphテスト関数の宣言
 bool RunAllRenderGraphTests(std::shared_ptr<Athena::Device> device);
 
+// シーンのベンチマーク関数の宣言
+int RunSceneBenchmarks();
+
 // RenderGraphExample関数の宣言
 bool InitializeRenderGraphExample(std::shared_ptr<Athena::Device> device, uint32_t width, uint32_t height);
 void RenderWithRenderGraph(ID3D12GraphicsCommandList* commandList, 
@@ -45,6 +62,12 @@ void SetRenderGraphVertexData(const void* vertices, uint32_t vertexCount, const
 void SetRenderGraphTexture(std::shared_ptr<Athena::Texture> texture);
 void SetRenderGraphObjectID(uint32_t objectID);
 void SetRenderGraphMode(bool useDeferred);
+bool InitializeRenderGraphGpuTiming(ID3D12CommandQueue* commandQueue);
+bool UpdateRenderGraphAutoMode();
+void ResetRenderGraphAutoMode(bool useDeferred);
+void SetRenderGraphMemoryAllocator(Athena::GpuMemoryAllocator* allocator);
+void BeginRenderGraphFrame(uint64_t completedFenceValue);
+void EndRenderGraphFrame(uint64_t fenceValue);
 
 using namespace Athena;
 using Microsoft::WRL::ComPtr;
@@ -53,6 +76,7 @@ using Microsoft::WRL::ComPtr;
 HWND g_hwnd = nullptr;
 const uint32_t WINDOW_WIDTH = 1280;
 const uint32_t WINDOW_HEIGHT = 720;
+const wchar_t* SHADER_ARCHIVE_PATH = L"../ShaderCache/ShaderPermutations.bin";
 
 // G-Bufferモードとカメラ管理
 enum class RenderingMode {
@@ -190,38 +214,52 @@ bool CreateAppWindow(HINSTANCE hInstance) {
 }
 
 
-// シェーダーコンパイル
+// シェーダー取得（ShaderCache のキャッシュになければコンパイル）
 ComPtr<ID3DBlob> CompileShader(const std::wstring& filepath, const std::string& entryPoint, const std::string& target) {
-    UINT compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-
-    ComPtr<ID3DBlob> shader;
-    ComPtr<ID3DBlob> error;
-
-    HRESULT hr = D3DCompileFromFile(
-        filepath.c_str(),
-        nullptr, nullptr,
-        entryPoint.c_str(),
-        target.c_str(),
-        compileFlags, 0,
-        &shader, &error
-    );
+    return ShaderCache::LoadShader(filepath, entryPoint, target);
+}
 
-    if (FAILED(hr)) {
-        if (error) {
-            Logger::Error("Shader compilation failed: %s", (char*)error->GetBufferPointer());
-        }
-        Logger::Error("Failed to compile shader: %S", filepath.c_str());
-        throw std::runtime_error("Failed to compile shader");
-    }
+// シェーダーの全バリアントを事前コンパイルしてアーカイブに書き出す（--build-shader-archive）
+int BuildShaderArchive() {
+    ShaderCache shaderCache;
+    ShaderCache::Settings shaderCacheSettings;
+    shaderCacheSettings.cacheDirectory = L"../ShaderCache";
+    shaderCache.Initialize(shaderCacheSettings);
+    ShaderCache::SetGlobal(&shaderCache);
+
+    ShaderArchiveWriter writer;
+    ShaderPermutationSet geometryPixelShaders;
+    geometryPixelShaders.Initialize(GeometryPass::GetPixelShaderPermutations());
+    geometryPixelShaders.CompileAll(writer);
+
+    ShaderCache::SetGlobal(nullptr);
+    shaderCache.LogStats();
 
-    Logger::Info("✓ Shader compiled: %S", filepath.c_str());
-    return shader;
+    if (!writer.Write(SHADER_ARCHIVE_PATH)) {
+        Logger::Error("Failed to write shader archive: %S", SHADER_ARCHIVE_PATH);
+        return 1;
+    }
+    Logger::Info("✓ Shader archive written: %S (%zu shaders)", SHADER_ARCHIVE_PATH, writer.GetShaderCount());
+    return 0;
 }
 
 // メイン関数
-int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
+int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR lpCmdLine, int) {
     try {
         Logger::Initialize();
+
+        // オフラインの事前コンパイル（ウィンドウ・デバイスは作成しない）
+        if (lpCmdLine && strstr(lpCmdLine, "--build-shader-archive")) {
+            int result = BuildShaderArchive();
+            Logger::Shutdown();
+            return result;
+        }
+        if (lpCmdLine && strstr(lpCmdLine, "--benchmark-scene")) {
+            int result = RunSceneBenchmarks();
+            Logger::Shutdown();
+            return result;
+        }
+
         Logger::Info("==========================================================");
         Logger::Info("  Athena Renderer - RenderGraph + Camera Integration");
         Logger::Info("==========================================================");
@@ -244,6 +282,38 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         devicePtr->Initialize(true);
         Logger::Info("✓ Device initialized");
 
+        // シェーダーキャッシュ（起動・モード切り替え時にHLSLを再コンパイルしない）
+        ShaderCache shaderCache;
+        ShaderCache::Settings shaderCacheSettings;
+        shaderCacheSettings.cacheDirectory = L"../ShaderCache";
+        shaderCache.Initialize(shaderCacheSettings);
+        ShaderCache::SetGlobal(&shaderCache);
+
+        // PSOキャッシュ（パイプラインライブラリを保存し、次回起動時のドライバーコンパイルを省略）
+        PipelineCache pipelineCache;
+        PipelineCache::Settings pipelineCacheSettings;
+        pipelineCacheSettings.libraryPath = L"../ShaderCache/PipelineLibrary.bin";
+        pipelineCacheSettings.prewarmPath = L"../ShaderCache/PipelinePrewarm.bin";
+        pipelineCache.Initialize(devicePtr->GetD3D12Device(), pipelineCacheSettings);
+        PipelineCache::SetGlobal(&pipelineCache);
+        pipelineCache.Prewarm();  // 前回使用したPSOをワーカースレッドで先に作成
+
+        // ルートシグネチャのレジストリ（同じレイアウトは1つにまとめ、パス間で共有）
+        RootSignatureCache rootSignatureCache;
+        rootSignatureCache.Initialize(devicePtr->GetD3D12Device());
+        RootSignatureCache::SetGlobal(&rootSignatureCache);
+
+        // 事前コンパイル済みシェーダー（--build-shader-archive で作成、なければ実行時にコンパイル）
+        ShaderArchive shaderArchive;
+        if (shaderArchive.Open(SHADER_ARCHIVE_PATH)) {
+            ShaderArchive::SetGlobal(&shaderArchive);
+        }
+
+        // シーンのカリングなどを分担するワーカースレッド
+        JobSystem jobSystem;
+        jobSystem.Initialize(JobSystem::GetDefaultWorkerCount());
+        JobSystem::SetGlobal(&jobSystem);
+
         // カメラ初期化
         g_camera = std::make_unique<FPSCamera>();
         g_camera->SetPerspective(3.14159f / 4.0f, static_cast<float>(WINDOW_WIDTH) / WINDOW_HEIGHT, 0.1f, 1000.0f);
@@ -342,6 +412,11 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         commandQueue.Initialize(devicePtr->GetD3D12Device(), D3D12_COMMAND_LIST_TYPE_DIRECT);
         Logger::Info("✓ CommandQueue initialized");
 
+        // RenderGraphのパス計測（フォワード／ディファード自動選択用）
+        if (renderGraphExampleResult) {
+            InitializeRenderGraphGpuTiming(commandQueue.GetD3D12CommandQueue());
+        }
+
         // スワップチェーン
         SwapChain swapChain;
         swapChain.Initialize(
@@ -404,34 +479,56 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         depthTexture.CreateDSV(devicePtr->GetD3D12Device(), dsvHandle.cpu);
         Logger::Info("✓ Depth buffer created");
 
-        // コマンドアロケータ
-        ComPtr<ID3D12CommandAllocator> commandAllocator;
-        devicePtr->GetD3D12Device()->CreateCommandAllocator(
-            D3D12_COMMAND_LIST_TYPE_DIRECT,
-            IID_PPV_ARGS(&commandAllocator)
-        );
+        // フレームコンテキスト（スワップチェーンのバッファ数だけフレームを並行処理）
+        FrameContextRing frameRing;
+        frameRing.Initialize(devicePtr->GetD3D12Device(), &commandQueue, SwapChain::BufferCount);
+
+        // Buffer / Texture の解放はフレームのフェンス完了まで遅らせる
+        DeferredReleaseQueue::SetGlobal(&frameRing.GetReleaseQueue());
 
         ComPtr<ID3D12GraphicsCommandList> commandList;
         devicePtr->GetD3D12Device()->CreateCommandList(
             0,
             D3D12_COMMAND_LIST_TYPE_DIRECT,
-            commandAllocator.Get(),
+            frameRing.GetCurrentFrame().commandAllocator.Get(),
             nullptr,
             IID_PPV_ARGS(&commandList)
         );
         commandList->Close();
-        Logger::Info("✓ Command allocator and list created");
+        Logger::Info("✓ Frame contexts and command list created");
 
         // UploadContext
         UploadContext uploadContext;
         uploadContext.Initialize(devicePtr->GetD3D12Device(), commandQueue.GetD3D12CommandQueue());
 
+        // 実行中のアップロードはコピーキューで非同期に行う
+        UploadScheduler uploadScheduler;
+        uploadScheduler.Initialize(devicePtr->GetD3D12Device(), commandQueue.GetD3D12CommandQueue());
+
+        // 実行中に読み込むリソースは予算内で数フレームに分けて転送する
+        StreamingUploadQueue streamingUploads;
+
+        // テクスチャ・頂点バッファはヒープブロックに配置して作成する
+        GpuMemoryAllocator gpuMemoryAllocator;
+        gpuMemoryAllocator.Initialize(devicePtr->GetD3D12Device());
+        SetRenderGraphMemoryAllocator(&gpuMemoryAllocator);
+
+        // GPUメモリ予算の管理（予算を超えた場合は使われていないリソースを退避）
+        DxgiMemoryBudgetSource memoryBudgetSource(devicePtr->GetAdapter());
+        D3D12ResidencyBackend residencyBackend(devicePtr->GetD3D12Device());
+        MemoryBudgetManager memoryBudget;
+        memoryBudget.Initialize(&memoryBudgetSource, &residencyBackend);
+        memoryBudget.SetTrimCallback([&gpuMemoryAllocator]() { gpuMemoryAllocator.TrimEmptyBlocks(); });
+        MemoryBudgetManager::SetGlobal(&memoryBudget);
+        uint64_t frameNumber = 0;
+
         // 🎨 画像ファイルからテクスチャ読み込み
         Logger::Info("==========================================================");
         Logger::Info("  Loading texture from file...");
         Logger::Info("==========================================================");
 
         Texture mainTexture;
+        mainTexture.SetMemoryAllocator(&gpuMemoryAllocator);
 
         // テクスチャファイルのパス
         // 例: ../assets/test_texture.png
@@ -474,23 +571,17 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         }
 
         // デスクリプタ割り当て
-        auto cbvHandle = cbvSrvHeap.Allocate();
         auto textureSrvHandle = cbvSrvHeap.Allocate();
 
         Logger::Info("✓ Descriptors allocated:");
-        Logger::Info("  - CBV at index %u", cbvHandle.index);
         Logger::Info("  - SRV at index %u", textureSrvHandle.index);
 
         // 頂点データ（Vector2統一でテクスチャ座標を適切に設定）
         // RenderGraphが独自のジオメトリデータを使用する
 
-        Buffer constantBuffer;
-        constantBuffer.Initialize(
-            devicePtr->GetD3D12Device(),
-            256,
-            BufferType::Constant,
-            D3D12_HEAP_TYPE_UPLOAD
-        );
+        // 定数はフレームごとのパーティションに書く（処理中のフレームが読んでいる領域を上書きしない）
+        ConstantBufferAllocator frameConstants;
+        frameConstants.Initialize(devicePtr->GetD3D12Device(), 64 * 1024, SwapChain::BufferCount);
         
         // メモリ使用量の記録は削除（SimpleStatsでは不要）
         
@@ -499,14 +590,6 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         Logger::Info("Vector3 size: %zu bytes", sizeof(Vector3));
         Logger::Info("Vector2 size: %zu bytes", sizeof(Vector2));
 
-        // CBV作成
-        D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = {};
-        cbvDesc.BufferLocation = constantBuffer.GetGPUVirtualAddress();
-        cbvDesc.SizeInBytes = 256;
-        devicePtr->GetD3D12Device()->CreateConstantBufferView(&cbvDesc, cbvHandle.cpu);
-        Logger::Info("✓ CBV created");
-        
-
         // SRV作成
         mainTexture.CreateSRV(devicePtr->GetD3D12Device(), textureSrvHandle.cpu);
         Logger::Info("✓ Texture SRV created");
@@ -574,63 +657,8 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         auto vertexShader = CompileShader(L"../shaders/TexturedVS.hlsl", "main", "vs_5_1");
         auto pixelShader = CompileShader(L"../shaders/TexturedPS.hlsl", "main", "ps_5_1");
 
-        // ルートシグネチャ
-        D3D12_DESCRIPTOR_RANGE ranges[2] = {};
-        ranges[0].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
-        ranges[0].NumDescriptors = 1;
-        ranges[0].BaseShaderRegister = 0;
-        ranges[0].RegisterSpace = 0;
-        ranges[0].OffsetInDescriptorsFromTableStart = 0;
-
-        ranges[1].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-        ranges[1].NumDescriptors = 1;
-        ranges[1].BaseShaderRegister = 0;
-        ranges[1].RegisterSpace = 0;
-        ranges[1].OffsetInDescriptorsFromTableStart = 1;
-
-        D3D12_ROOT_PARAMETER rootParams[1] = {};
-        rootParams[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
-        rootParams[0].DescriptorTable.NumDescriptorRanges = 2;
-        rootParams[0].DescriptorTable.pDescriptorRanges = ranges;
-        rootParams[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
-
-        D3D12_STATIC_SAMPLER_DESC sampler = {};
-        sampler.Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
-        sampler.AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
-        sampler.MipLODBias = 0.0f;
-        sampler.MaxAnisotropy = 1;
-        sampler.ComparisonFunc = D3D12_COMPARISON_FUNC_NEVER;
-        sampler.BorderColor = D3D12_STATIC_BORDER_COLOR_OPAQUE_WHITE;
-        sampler.MinLOD = 0.0f;
-        sampler.MaxLOD = D3D12_FLOAT32_MAX;
-        sampler.ShaderRegister = 0;
-        sampler.RegisterSpace = 0;
-        sampler.ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
-
-        D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
-        rootSigDesc.NumParameters = 1;
-        rootSigDesc.pParameters = rootParams;
-        rootSigDesc.NumStaticSamplers = 1;
-        rootSigDesc.pStaticSamplers = &sampler;
-        rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
-
-        ComPtr<ID3DBlob> signature;
-        ComPtr<ID3DBlob> error;
-        HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1, &signature, &error);
-        if (FAILED(hr)) {
-            if (error) Logger::Error("Root signature error: %s", (char*)error->GetBufferPointer());
-            throw std::runtime_error("Failed to serialize root signature");
-        }
-
-        ComPtr<ID3D12RootSignature> rootSignature;
-        devicePtr->GetD3D12Device()->CreateRootSignature(
-            0,
-            signature->GetBufferPointer(),
-            signature->GetBufferSize(),
-            IID_PPV_ARGS(&rootSignature)
-        );
+        // ルートシグネチャ（RenderGraph のパスと共通）
+        ComPtr<ID3D12RootSignature> rootSignature = rootSignatureCache.GetGlobalRootSignature();
         Logger::Info("✓ Root signature created");
 
         // PSO作成
@@ -659,11 +687,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         psoDesc.DSVFormat = DXGI_FORMAT_D32_FLOAT;
         psoDesc.SampleDesc.Count = 1;
 
-        ComPtr<ID3D12PipelineState> pipelineState;
-        hr = devicePtr->GetD3D12Device()->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState));
-        if (FAILED(hr)) {
-            throw std::runtime_error("Failed to create pipeline state");
-        }
+        ComPtr<ID3D12PipelineState> pipelineState = PipelineCache::LoadGraphicsPipeline(devicePtr->GetD3D12Device(), psoDesc);
         Logger::Info("✓ Pipeline state created");
 
         Logger::Info("==========================================================");
@@ -722,6 +746,18 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
                                     RenderingMode::Deferred : RenderingMode::Forward;
                     const char* modeNames[] = { "Forward", "Deferred (G-Buffer)" };
                     Logger::Info("Rendering mode changed to: %s", modeNames[static_cast<int>(g_renderingMode)]);
+
+                    // 自動選択は現在のモードから開始する
+                    if (g_imguiManager->IsAutoRenderingModeEnabled()) {
+                        ResetRenderGraphAutoMode(g_renderingMode == RenderingMode::Deferred);
+                    }
+                }
+
+                // コストモデルによる自動選択（計測値・ライト数・解像度から毎フレーム判定）
+                if (g_imguiManager->IsAutoRenderingModeEnabled() && renderGraphExampleResult) {
+                    bool autoDeferred = UpdateRenderGraphAutoMode();
+                    g_renderingMode = autoDeferred ? RenderingMode::Deferred : RenderingMode::Forward;
+                    g_imguiManager->SetDeferredRenderingEnabled(autoDeferred);
                 }
                 
                 
@@ -781,10 +817,6 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
             Matrix4x4 mvp = world * view * proj;
             mvp = mvp.Transpose();
 
-            TransformBuffer cbData = {};
-            cbData.mvp = mvp;
-            constantBuffer.Upload(&cbData, sizeof(TransformBuffer));
-
             // RenderGraphにシーンデータを設定（カメラ統合）
             if (renderGraphExampleResult) {
                 Vector3 cameraPos = g_camera ? g_camera->GetPosition() : Vector3(-3.0f, 0.0f, 0.0f);
@@ -793,9 +825,26 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
                 SetRenderGraphSceneData(world, view, proj, cameraPos, lightDir, lightColor);
             }
 
-            // コマンド記録
-            commandAllocator->Reset();
-            commandList->Reset(commandAllocator.Get(), pipelineState.Get());
+            // コマンド記録（再利用するスロットのフレームが処理中の場合のみ待機）
+            FrameContext& frame = frameRing.BeginFrame();
+            commandList->Reset(frame.commandAllocator.Get(), pipelineState.Get());
+
+            // 予算を確認し、超えていれば使われていないリソースを退避
+            memoryBudget.Update(++frameNumber);
+
+            // 予算内のストリーミング転送を送信し、完了したアップロードを回収して
+            // 送信済みのものをグラフィックスキューへ移行
+            streamingUploads.ProcessFrame(&uploadScheduler);
+            uploadScheduler.ProcessCompletions();
+            uploadScheduler.AcquireUploads(commandList.Get());
+
+            // GPUが完了したフレームの一時デスクリプタと定数を再利用
+            BeginRenderGraphFrame(commandQueue.GetCompletedValue());
+            frameConstants.BeginFrame(commandQueue.GetCompletedValue());
+
+            TransformBuffer cbData = {};
+            cbData.mvp = mvp;
+            D3D12_GPU_VIRTUAL_ADDRESS transformAddress = frameConstants.Allocate(cbData).gpuAddress;
 
             D3D12_VIEWPORT viewport = {};
             viewport.Width = static_cast<float>(WINDOW_WIDTH);
@@ -859,6 +908,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
                         static std::shared_ptr<Texture> whiteTexture;
                         if (!whiteTexture) {
                             whiteTexture = std::make_shared<Texture>();
+                            whiteTexture->SetMemoryAllocator(&gpuMemoryAllocator);
                             const uint32_t whitePixel = 0xFFFFFFFF; // 白色
                             whiteTexture->CreateFromMemory(
                                 devicePtr->GetD3D12Device(),
@@ -866,7 +916,10 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
                                 DXGI_FORMAT_R8G8B8A8_UNORM,
                                 &whitePixel
                             );
-                            whiteTexture->UploadToGPU(&uploadContext);
+                            uploadScheduler.BeginBatch();
+                            whiteTexture->UploadToGPU(uploadScheduler);
+                            uploadScheduler.Submit();
+                            uploadScheduler.AcquireUploads(commandList.Get());
                             Logger::Info("Created white default texture for FBX models");
                         }
                         SetRenderGraphTexture(whiteTexture);
@@ -908,7 +961,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
                 
                 RenderWithRenderGraph(commandList.Get(), cbvSrvHeap.GetD3D12DescriptorHeap(), rtvHandle, dsvHandle.cpu, useDeferred);
                 
-                commandList->SetGraphicsRootSignature(rootSignature.Get());
+                // ルートシグネチャは共通なので設定し直さない（引数のみ設定し直す）
                 commandList->SetPipelineState(pipelineState.Get());
                 
                 ID3D12DescriptorHeap* mainHeaps[] = { cbvSrvHeap.GetD3D12DescriptorHeap() };
@@ -920,10 +973,10 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
             ID3D12DescriptorHeap* heaps[] = { cbvSrvHeap.GetD3D12DescriptorHeap() };
             commandList->SetDescriptorHeaps(1, heaps);
             
-            // デスクリプタテーブルはCBVから始まって2つのデスクリプタを含む
-            commandList->SetGraphicsRootDescriptorTable(0, cbvHandle.gpu);
+            commandList->SetGraphicsRootConstantBufferView(RootSignatureCache::Constants, transformAddress);
+            commandList->SetGraphicsRootDescriptorTable(RootSignatureCache::Textures, textureSrvHandle.gpu);
             if (firstFrame) {
-                Logger::Info("CBV GPU Handle: %llu, SRV GPU Handle: %llu", cbvHandle.gpu.ptr, textureSrvHandle.gpu.ptr);
+                Logger::Info("CB GPU Address: %llu, SRV GPU Handle: %llu", transformAddress, textureSrvHandle.gpu.ptr);
                 firstFrame = false;
             }
 
@@ -958,7 +1011,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
             commandQueue.ExecuteCommandLists(cmdLists, 1);
 
             swapChain.Present(true);
-            commandQueue.WaitForGPU();
+            uint64_t frameFenceValue = frameRing.EndFrame();
+            EndRenderGraphFrame(frameFenceValue);
+            frameConstants.EndFrame(frameFenceValue);
             
             // レンダリング完了後に統計情報を取得・更新
             if (g_imguiManager && g_simpleStats) {
@@ -973,15 +1028,27 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         Logger::Info("==========================================================");
         Logger::Info("  終了処理開始");
         Logger::Info("==========================================================");
-		commandQueue.WaitForGPU(); // GPUの処理完了を待機
+		frameRing.WaitForIdle(); // GPUの処理完了を待機
+		Logger::Info("Frame context stalls: %llu", static_cast<unsigned long long>(frameRing.GetStallCount()));
 
         // UploadContext解放
         uploadContext.Shutdown();
+        streamingUploads.LogStats();
+        uploadScheduler.Shutdown();
 
         // リソース解放（バッファ・テクスチャ）
-        constantBuffer.Shutdown();
+        frameConstants.Shutdown();
         mainTexture.Shutdown();
         depthTexture.Shutdown();
+        frameRing.WaitForIdle();  // 遅延解放中のリソースを解放
+        memoryBudget.LogStats();
+        shaderCache.LogStats();
+        pipelineCache.LogStats();
+        rootSignatureCache.LogStats();
+        pipelineCache.Shutdown();  // ライブラリを保存
+        gpuMemoryAllocator.LogStats();
+        SetRenderGraphMemoryAllocator(nullptr);
+        gpuMemoryAllocator.Shutdown();
 
         // デスクリプタヒープ解放
         cbvSrvHeap.Shutdown();
@@ -991,6 +1058,16 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int) {
         // スワップチェーン解放
         swapChain.Shutdown();
 
+        // フレームコンテキスト解放（以降の解放は即時）
+        MemoryBudgetManager::SetGlobal(nullptr);
+        ShaderCache::SetGlobal(nullptr);
+        PipelineCache::SetGlobal(nullptr);
+        RootSignatureCache::SetGlobal(nullptr);
+        ShaderArchive::SetGlobal(nullptr);
+        JobSystem::SetGlobal(nullptr);
+        DeferredReleaseQueue::SetGlobal(nullptr);
+        frameRing.Shutdown();
+
         // CommandQueue解放
         commandQueue.Shutdown();
 
@@ -1,8 +1,21 @@
 // GeometryPass Pixel Shader
 // 基本的な3Dオブジェクトのレンダリング用ピクセルシェーダー
+//
+// キーワード（ShaderPermutationSet が 0/1 で定義する）
+//   DEFERRED    : G-Buffer（MRT）に書き出す。0 の場合はフォワードでライティングする
+//   USE_TEXTURE : メインテクスチャをサンプリングする。0 の場合は白を使う
 
+#ifndef DEFERRED
+#define DEFERRED 0
+#endif
+#ifndef USE_TEXTURE
+#define USE_TEXTURE 1
+#endif
+
+#if USE_TEXTURE
 Texture2D    mainTexture : register(t0);
 SamplerState mainSampler : register(s0);
+#endif
 
 cbuffer GeometryConstants : register(b0)
 {
@@ -31,31 +44,78 @@ struct PSInput
     float3 lightDir     : TEXCOORD2;
 };
 
+float4 SampleAlbedo(float2 texcoord)
+{
+#if USE_TEXTURE
+    return mainTexture.Sample(mainSampler, texcoord);
+#else
+    return float4(1.0, 1.0, 1.0, 1.0);
+#endif
+}
+
+#if DEFERRED
+
+struct PSOutput
+{
+    float4 albedo    : SV_Target0;  // RGB: Albedo, A: Metallic
+    float4 normal    : SV_Target1;  // RGB: World Space Normal, A: Roughness
+    float4 material  : SV_Target2;  // R: AO, G: Unused, B: Unused, A: Object ID
+};
+
+PSOutput main(PSInput input)
+{
+    PSOutput output;
+
+    float4 albedoSample = SampleAlbedo(input.texcoord);
+    float3 worldNormal = normalize(input.normal);
+
+    // Target 0: Albedo + Metallic
+    output.albedo.rgb = albedoSample.rgb;
+    output.albedo.a = 0.0f; // Default metallic value (non-metallic)
+
+    // Target 1: World Normal + Roughness
+    // Pack normal from [-1,1] to [0,1] range
+    output.normal.rgb = worldNormal * 0.5f + 0.5f;
+    output.normal.a = 0.5f; // Default roughness value
+
+    // Target 2: Material parameters
+    output.material.r = 1.0f; // AO (full ambient occlusion)
+    output.material.g = 0.0f; // Unused
+    output.material.b = 0.0f; // Unused
+    output.material.a = float(objectID) / 255.0f; // Object ID normalized
+
+    return output;
+}
+
+#else
+
 float4 main(PSInput input) : SV_Target
 {
-    float4 albedo = mainTexture.Sample(mainSampler, input.texcoord);
-    
+    float4 albedo = SampleAlbedo(input.texcoord);
+
     float3 normal = normalize(input.normal);
     float3 lightDir = normalize(input.lightDir);
     float3 viewDir = normalize(input.viewDir);
-    
+
     float NdotL = max(0.0, dot(normal, lightDir));
     float3 diffuse = lightColor * NdotL;
-    
+
     float3 halfVector = normalize(lightDir + viewDir);
     float NdotH = max(0.0, dot(normal, halfVector));
     float specularPower = 32.0;
     float specular = pow(NdotH, specularPower);
-    
+
     float3 ambient = float3(0.1, 0.1, 0.1);
-    
+
     float3 idColor = float3(
         ((objectID & 1) > 0) ? 0.2 : 0.0,
         ((objectID & 2) > 0) ? 0.2 : 0.0,
         ((objectID & 4) > 0) ? 0.2 : 0.0
     );
-    
+
     float3 finalColor = albedo.rgb * (ambient + diffuse) + lightColor * specular * 0.3 + idColor;
-    
+
     return float4(finalColor, albedo.a);
-}
\ No newline at end of file
+}
+
+#endif
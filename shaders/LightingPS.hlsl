@@ -6,7 +6,7 @@ Texture2D gbufferAlbedo : register(t0);  // アルベド + メタリック
 Texture2D gbufferNormal : register(t1);  // 法線 + ラフネス
 Texture2D gbufferDepth  : register(t2);  // 深度
 
-SamplerState pointSampler : register(s0);
+SamplerState pointSampler : register(s1);  // 共通ルートシグネチャのポイント・クランプ
 
 // ライト構造体
 struct LightData
@@ -2,7 +2,7 @@
 // HDRからLDRへのトーンマッピング
 
 Texture2D hdrTexture : register(t0);
-SamplerState linearSampler : register(s0);
+SamplerState linearSampler : register(s2);  // 共通ルートシグネチャのリニア・クランプ
 
 cbuffer ToneMappingConstants : register(b0)
 {